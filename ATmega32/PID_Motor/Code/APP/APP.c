@@ -19,12 +19,14 @@
  *   if no user input is received within 5 seconds.
  *
  * The control loop runs periodically using TIMER2 interrupts. The PID output
- * is applied to a DC motor using PWM via TIMER0, and direction control is
- * managed through DIO. The resulting control signal is also output via PORTC
+ * is applied to a DC motor using PWM via TIMER0 (8-bit), or via TIMER1 Fast PWM
+ * with ICR1 top for a higher resolution at an ultrasonic frequency, and direction
+ * control is managed through DIO. The resulting control signal is also output via PORTC
  * for DAC-based visualization (e.g., using an R-2R ladder).
  *
  * Features:
  * - PID controller with anti-oscillation deadband
+ * - Derivative from an alpha-beta estimator of the feedback velocity (PID_DERIVATIVE)
  * - UART-based user interaction
  * - Real-time ADC-based gain and setpoint input
  * - Motor direction and PWM control
@@ -51,18 +53,29 @@ float64 kd;
 sint16 setpoint = 0;
 sint16 position = 0;
 sint16 last_position = 0;
+sint16 velocity = 0;
 sint16 error = 0;
 sint16 prev_error = 0;
 double proportional = 0;
 double integral = 0;
 double derivative = 0;
-const double dt = SAMPLE_MS / 1000.0;
+double dt = SAMPLE_MS / 1000.0;
 sint16 output = 0;
 uint16 timer_overflows;
 uint8 timer_initval;
 bool is_digital;
+
+// Runtime parameters (changed over UART by the PARAM protocol)
+float32 kp_max;
+float32 ki_max;
+float32 kd_max;
+uint16 deadband;
+uint16 sample_ms;
 Motor motor = { MOTOR_PORT, MOTOR_IN1, MOTOR_IN2 };
 
+// Filtered feedback position and velocity
+Estimator feedback;
+
 
 
 int abs(int x)
@@ -191,9 +204,9 @@ void Get_k_Values( float64 * kp_value , float64 * ki_value , float64 * kd_value
 /*
  * @brief Drives the motor based on the given signed speed.
  *
- * Sets direction and PWM duty cycle using Timer0.
+ * Sets direction and PWM duty cycle using Timer0 or Timer1 (MOTOR_PWM_OUTPUT).
  *
- * @param[in] speed Signed motor speed (-255 to 255).
+ * @param[in] speed Signed motor speed (-MOTOR_PWM_MAX to MOTOR_PWM_MAX).
  */
 void Motor_Drive(sint16 speed)
 {
@@ -216,7 +229,11 @@ void Motor_Drive(sint16 speed)
 	}
 
 	/* Set PWM duty cycle using absolute value of speed */
+#if   MOTOR_PWM_OUTPUT == MOTOR_PWM_TIMER0
 	TIMER0_SetCompareValue(abs(speed));
+#elif MOTOR_PWM_OUTPUT == MOTOR_PWM_TIMER1
+	TIMER1_SetCompare_A_Value(abs(speed));
+#endif
 }
 
 
@@ -236,6 +253,13 @@ void PID_Update()
 	/* Read the current position (feedback) from ADC channel */
 	position = ADC_Read_10_Bits(FEEDBACK_ADC);   // 0 to 1023
 
+#if PID_DERIVATIVE == PID_DERIVATIVE_ESTIMATOR
+	/* Filter the feedback and get its velocity (ADC counts per second) */
+	ESTIMATOR_Update(&feedback, position);
+	double velocity_per_s = FP_Q16_TO_FLOAT(ESTIMATOR_GetVelocity(&feedback)) / dt;
+	velocity = velocity_per_s;
+#endif
+
 	/* In analog mode: read setpoint and PID gains from ADC inputs */
 	if (is_digital == false)
 	{
@@ -243,16 +267,16 @@ void PID_Update()
 		setpoint = ADC_Read_10_Bits(SETPOINT_ADC);
 
 		/* Scale ADC readings to real gain values (based on defined max) */
-		kp = ( ADC_Read_10_Bits(KP_ADC) * KP_MAX ) / 1023.0;
-		ki = ( ADC_Read_10_Bits(KI_ADC) * KI_MAX ) / 1023.0;
-		kd = ( ADC_Read_10_Bits(KD_ADC) * KD_MAX ) / 1023.0;
+		kp = ( ADC_Read_10_Bits(KP_ADC) * kp_max ) / 1023.0;
+		ki = ( ADC_Read_10_Bits(KI_ADC) * ki_max ) / 1023.0;
+		kd = ( ADC_Read_10_Bits(KD_ADC) * kd_max ) / 1023.0;
 	}
 
 	/* Calculate current control error */
 	error = setpoint - position;
 
 	/* Deadband: ignore small errors to prevent oscillation */
-	if (abs(error) < DEADBAND)
+	if (abs(error) < deadband)
 	{
 		/* Reset integral to avoid wind-up */
 		integral = 0;
@@ -267,20 +291,29 @@ void PID_Update()
 		/* Accumulate integral term */
 		integral += ki * error * dt;
 
+#if PID_DERIVATIVE == PID_DERIVATIVE_ESTIMATOR
+		/* Derivative based on the filtered velocity */
+		derivative = -kd * velocity_per_s;
+#else
 		/* Derivative based on position change */
 		derivative = kd * (last_position - position) / dt;
+#endif
 
-		/* Compute total output */
-		output = proportional + integral + derivative;
+		/* Compute total output (gains are tuned for 8-bit range, so scale it to the PWM range) */
+		double total = (proportional + integral + derivative) * ((double)MOTOR_PWM_MAX / PID_OUTPUT_BASE);
 
-		/* Clamp output to PWM range (-255 to 255) */
-		if (output > 255)
+		/* Clamp output to PWM range (-MOTOR_PWM_MAX to MOTOR_PWM_MAX) */
+		if (total > MOTOR_PWM_MAX)
 		{
-			output = 255;
+			output = MOTOR_PWM_MAX;
 		}
-		else if (output < -255)
+		else if (total < -(double)MOTOR_PWM_MAX)
 		{
-			output = -255;
+			output = -MOTOR_PWM_MAX;
+		}
+		else
+		{
+			output = total;
 		}
 	}
 
@@ -290,8 +323,8 @@ void PID_Update()
 	/* Drive the motor based on signed output */
 	Motor_Drive(output);
 
-	/* Absolute value is sent to DAC output for visualization */
-	DIO_SetPortValue(DAC_PORT, (uint8)abs(output));
+	/* Absolute value scaled to 8 bits is sent to DAC output for visualization */
+	DIO_SetPortValue(DAC_PORT, (uint8)( ( (uint32)abs(output) * PID_OUTPUT_BASE ) / MOTOR_PWM_MAX ));
 }
 
 
@@ -302,7 +335,8 @@ void PID_Update()
  * @brief Timer2 overflow interrupt service routine callback.
  *
  * Counts overflows until the configured sampling interval elapses,
- * then resets the timer and triggers a PID update.
+ * then applies the changed runtime parameters, resets the timer and
+ * triggers a PID update.
  */
 void Control_ISR()
 {
@@ -314,11 +348,31 @@ void Control_ISR()
 		/* Reset counter when target time is reached (e.g. 20 ms) */
 		ovf_counter = 0;
 
+		/* Safe point: write the parameters received over UART between two PID updates */
+		if (PARAM_Apply())
+		{
+			/* The sampling interval may be changed, so calculate the timing again */
+			TIMER2_Calc_ISR_Timing_ms(sample_ms, &timer_overflows, &timer_initval);
+			dt = sample_ms / 1000.0;
+		}
+
 		/* Reload TIMER2 with initial value for consistent timing */
 		TIMER2_SetTimerValue(timer_initval);
 
 		/* Call PID update routine to compute control output */
 		PID_Update();
+
+		METRICS_INC32( METRIC_CONTROL_TICKS );
+
+		/* An overflow during the update means that the next tick is late (overrun) */
+		if (IS_BIT_SET(TIFR, TOV2))
+		{
+			METRICS_INC16( METRIC_CONTROL_OVERRUNS );
+		}
+		else
+		{
+			METRICS_HIST( METRIC_HIST_CONTROL_TICKS, (uint8)(TIMER2_GetTimerValue() - timer_initval) );
+		}
 	}
 }
 
@@ -326,6 +380,184 @@ void Control_ISR()
 
 
 
+#if PID_BENCHMARK == PID_BENCHMARK_ENABLE
+
+/* Buffer of the DataConvert benchmarks */
+static char bench_str[ 12 ];
+
+/* Benchmarked calls (functions without parameters for BENCH) */
+static void Bench_DIO_SetPinValue( void )
+{
+	DIO_SetPinValue( MOTOR_PORT , MOTOR_IN1 , LOW );
+}
+
+static void Bench_ADC_Read( void )
+{
+	ADC_Read_10_Bits( FEEDBACK_ADC );
+}
+
+static void Bench_DC_itoa( void )
+{
+	DC_itoa( -12345 , bench_str , 10 );
+}
+
+static void Bench_DC_ftoa( void )
+{
+	DC_ftoa( 3.14159 , bench_str , 3 );
+}
+
+static void Bench_Motor_Drive( void )
+{
+	Motor_Drive( 0 );
+}
+
+static void Bench_ESTIMATOR_Update( void )
+{
+	ESTIMATOR_Update( &feedback , 512 );
+}
+
+/* Operands of the fixed-point and float benchmarks (volatile, so the compiler does not calculate the results) */
+static volatile q15_16  bench_q16_a = FP_Q16_FROM_FLOAT( 3.14159 );
+static volatile q15_16  bench_q16_b = FP_Q16_FROM_FLOAT( -2.71828 );
+static volatile q15_16  bench_q16_result;
+static volatile q7_8    bench_q8_a = FP_Q8_FROM_FLOAT( 3.14 );
+static volatile q7_8    bench_q8_b = FP_Q8_FROM_FLOAT( -2.72 );
+static volatile q7_8    bench_q8_result;
+static volatile float32 bench_float_a = 3.14159;
+static volatile float32 bench_float_b = -2.71828;
+static volatile float32 bench_float_result;
+static volatile uint16  bench_angle = FP_ANGLE_FROM_DEG( 30 );
+
+static void Bench_FP_Q8_Mul( void )
+{
+	bench_q8_result = FP_Q8_Mul( bench_q8_a , bench_q8_b );
+}
+
+static void Bench_FP_Q16_Add( void )
+{
+	bench_q16_result = FP_Q16_Add( bench_q16_a , bench_q16_b );
+}
+
+static void Bench_Float_Add( void )
+{
+	bench_float_result = bench_float_a + bench_float_b;
+}
+
+static void Bench_FP_Q16_Mul( void )
+{
+	bench_q16_result = FP_Q16_Mul( bench_q16_a , bench_q16_b );
+}
+
+static void Bench_Float_Mul( void )
+{
+	bench_float_result = bench_float_a * bench_float_b;
+}
+
+static void Bench_FP_Q16_Recip( void )
+{
+	bench_q16_result = FP_Q16_Recip( bench_q16_a );
+}
+
+static void Bench_Float_Div( void )
+{
+	bench_float_result = 1.0f / bench_float_a;
+}
+
+static void Bench_FP_Q16_Sqrt( void )
+{
+	bench_q16_result = FP_Q16_Sqrt( bench_q16_a );
+}
+
+static void Bench_Float_Sqrt( void )
+{
+	bench_float_result = sqrt( bench_float_a );
+}
+
+static void Bench_FP_Sin( void )
+{
+	bench_q16_result = FP_Sin( bench_angle );
+}
+
+static void Bench_Float_Sin( void )
+{
+	bench_float_result = sin( bench_float_a );
+}
+
+
+
+
+
+/*
+ * @brief Sends the CPU cycles of the main functions over UART.
+ *
+ * Every function is measured with the Timer1 counter and reported as a
+ * "BENCH,<function>,<cycles>" line, the output of two builds can be compared
+ * to find the changes that make a function faster or slower.
+ */
+void Run_Benchmark(void)
+{
+	/* Timer1 is the cycle counter (BENCH_Init sets it to normal mode, no prescaler) */
+	BENCH_Init();
+
+	BENCH_Report( "DIO_SetPinValue" , Bench_DIO_SetPinValue );
+	BENCH_Report( "ADC_Read_10_Bits" , Bench_ADC_Read );
+	BENCH_Report( "DC_itoa" , Bench_DC_itoa );
+	BENCH_Report( "DC_ftoa" , Bench_DC_ftoa );
+	BENCH_Report( "Motor_Drive" , Bench_Motor_Drive );
+	BENCH_Report( "ESTIMATOR_Update" , Bench_ESTIMATOR_Update );
+	BENCH_Report( "PID_Update" , PID_Update );
+
+	/* Fixed-point functions next to the float operations they replace */
+	BENCH_Report( "FP_Q8_Mul" , Bench_FP_Q8_Mul );
+	BENCH_Report( "FP_Q16_Add" , Bench_FP_Q16_Add );
+	BENCH_Report( "float_add" , Bench_Float_Add );
+	BENCH_Report( "FP_Q16_Mul" , Bench_FP_Q16_Mul );
+	BENCH_Report( "float_mul" , Bench_Float_Mul );
+	BENCH_Report( "FP_Q16_Recip" , Bench_FP_Q16_Recip );
+	BENCH_Report( "float_div" , Bench_Float_Div );
+	BENCH_Report( "FP_Q16_Sqrt" , Bench_FP_Q16_Sqrt );
+	BENCH_Report( "sqrt" , Bench_Float_Sqrt );
+	BENCH_Report( "FP_Sin" , Bench_FP_Sin );
+	BENCH_Report( "sin" , Bench_Float_Sin );
+
+	/* PID_Update and ESTIMATOR_Update changed the control state, start the control from the current position again */
+	position = ADC_Read_10_Bits(FEEDBACK_ADC);
+	last_position = position;
+	integral = 0;
+	output = 0;
+	ESTIMATOR_Init(&feedback, feedback.alpha, feedback.beta, position);
+	Motor_Drive(0);
+}
+
+#endif
+
+
+
+
+
+/*
+ * @brief Registers the runtime parameters and loads the saved values.
+ *
+ * The parameters can be read, changed and saved over UART in analog mode
+ * (see the PARAM protocol), the new values are applied by Control_ISR.
+ */
+void Register_Parameters(void)
+{
+	PARAM_Register(PARAM_ID_KP_MAX, &kp_max, PARAM_FLOAT32, 0, GAIN_MAX_LIMIT, KP_MAX, PARAM_PERSISTENT);
+	PARAM_Register(PARAM_ID_KI_MAX, &ki_max, PARAM_FLOAT32, 0, GAIN_MAX_LIMIT, KI_MAX, PARAM_PERSISTENT);
+	PARAM_Register(PARAM_ID_KD_MAX, &kd_max, PARAM_FLOAT32, 0, GAIN_MAX_LIMIT, KD_MAX, PARAM_PERSISTENT);
+	PARAM_Register(PARAM_ID_DEADBAND, &deadband, PARAM_UINT16, 0, DEADBAND_LIMIT, DEADBAND, PARAM_PERSISTENT);
+	PARAM_Register(PARAM_ID_SAMPLE_MS, &sample_ms, PARAM_UINT16, SAMPLE_MS_MIN, SAMPLE_MS_MAX, SAMPLE_MS, PARAM_PERSISTENT);
+
+	/* Use the values saved by the last PARAM_CMD_SAVE request */
+	PARAM_Load();
+	dt = sample_ms / 1000.0;
+}
+
+
+
+
+
 /*
  * @brief Initializes the main application modules.
  *
@@ -343,6 +575,19 @@ void APP_Init(void)
 	/* Initialize ADC for reading feedback, setpoint, and PID gains */
 	ADC_Init();
 
+	/* Start the feedback estimator at the current position */
+	q15_16 alpha, beta;
+	ESTIMATOR_GainsFromTrackingIndex(FP_Q16_FROM_FLOAT(ESTIMATOR_TRACKING_INDEX), &alpha, &beta);
+	ESTIMATOR_Init(&feedback, alpha, beta, ADC_Read_10_Bits(FEEDBACK_ADC));
+
+	/* Set the runtime parameters to the saved (or default) values */
+	Register_Parameters();
+
+#if PID_BENCHMARK == PID_BENCHMARK_ENABLE
+	/* Send the cycles of the main functions before the control starts */
+	Run_Benchmark();
+#endif
+
 	/* Check if digital mode is selected via UART (within 5 seconds) */
 	is_digital = Is_Use_UART();
 
@@ -352,8 +597,12 @@ void APP_Init(void)
 		Get_k_Values(&kp,&ki,&kd);
 	}
 
-	/* Initialize Timer0 for PWM generation (motor speed control) */
+	/* Initialize the PWM timer (motor speed control) */
+#if   MOTOR_PWM_OUTPUT == MOTOR_PWM_TIMER0
 	TIMER0_Init();
+#elif MOTOR_PWM_OUTPUT == MOTOR_PWM_TIMER1
+	TIMER1_Init();
+#endif
 
 	/* Initialize Timer2 for periodic PID control ISR */
 	TIMER2_Init();
@@ -362,13 +611,24 @@ void APP_Init(void)
 	DIO_SetPortDirection(DAC_PORT, OUTPUT_PORT);
 
 	/* Calculate overflow count and preload value for TIMER2 to match sample time */
-	TIMER2_Calc_ISR_Timing_ms(SAMPLE_MS, &timer_overflows, &timer_initval);
+	TIMER2_Calc_ISR_Timing_ms(sample_ms, &timer_overflows, &timer_initval);
 
 	/* Set initial timer value for TIMER2 */
 	TIMER2_SetTimerValue(timer_initval);
 
 	/* Set the PID control function to be called on TIMER2 overflow interrupt */
 	TIMER2_SetCallback(TIMER2_OVF_ID, Control_ISR);
+
+	/* In analog mode the UART is free, so receive the parameter requests (digital mode reads the UART by polling) */
+	if(is_digital == false)
+	{
+		PARAM_Listen();
+
+#if METRICS_STATUS == METRICS_ENABLE
+		/* Send the names of the metrics once, the binary frames are sent by the main loop */
+		METRICS_ExportNames(UART_WriteByte);
+#endif
+	}
 }
 
 
@@ -386,6 +646,9 @@ void APP_main_loop(void)
 {
 	char input[10];
 	sint16 temp;
+#if METRICS_STATUS == METRICS_ENABLE
+	uint8 metrics_loops = 0;
+#endif
 
 	/* Control is interrupt-based; loop only handles UART interaction */
 	while(1)
@@ -394,7 +657,7 @@ void APP_main_loop(void)
 		if (is_digital == true)
 		{
 			/* If error changes significantly, display PID data */
-			if (abs(error - prev_error) > DEADBAND )
+			if (abs(error - prev_error) > deadband )
 			{
 				UART_WriteString("Error = ");
 				UART_WriteNumber(error);
@@ -412,7 +675,7 @@ void APP_main_loop(void)
 				UART_WriteString("\n\n");
 			}
 			/* If error is within the deadband, prompt user to enter new setpoint */
-			else if(abs(error) < DEADBAND)
+			else if(abs(error) < deadband)
 			{
 				while(1)
 				{
@@ -439,6 +702,9 @@ void APP_main_loop(void)
 		/* In analog mode: continuously report system status over UART */
 		else
 		{
+			/* Handle the parameter request received by the RX interrupt (if any) */
+			PARAM_Task();
+
 			UART_WriteString("Setpoint:");
 			UART_WriteNumber(setpoint);
 			UART_WriteByte(',');
@@ -447,7 +713,21 @@ void APP_main_loop(void)
 			UART_WriteByte(',');
 			UART_WriteString("Error:");
 			UART_WriteNumber(error);
+#if PID_DERIVATIVE == PID_DERIVATIVE_ESTIMATOR
+			UART_WriteByte(',');
+			UART_WriteString("Velocity:");
+			UART_WriteNumber(velocity);
+#endif
 			UART_WriteString("\r\n");
+
+#if METRICS_STATUS == METRICS_ENABLE
+			/* Send the metrics frame every METRICS_EXPORT_LOOPS status lines */
+			if (++metrics_loops >= METRICS_EXPORT_LOOPS)
+			{
+				metrics_loops = 0;
+				METRICS_Export(UART_WriteByte);
+			}
+#endif
 		}
 		/* Small delay to limit UART flooding */
 		_delay_ms(100);
@@ -47,10 +47,21 @@
 #include "../MCAL/DIO/DIO.h"
 #include "../MCAL/ADC/ADC.h"
 #include "../MCAL/TIMER0/TIMER0.h"
+#include "../MCAL/TIMER1/TIMER1.h"
 #include "../MCAL/TIMER2/TIMER2.h"
 #include "../MCAL/UART/UART.h"
 
 #include "../HAL/DC_MOTOR/MOTOR.h"
+#include "../HAL/PARAM/PARAM.h"
+
+#include "../LIB/METRICS/METRICS.h"
+#include "../LIB/FixedPoint/FixedPoint.h"
+#include "../LIB/ESTIMATOR/ESTIMATOR.h"
+
+#if PID_BENCHMARK == PID_BENCHMARK_ENABLE
+#include "../HAL/BENCH/BENCH.h"
+#include <math.h>
+#endif
 
 #include <util/delay.h>
 
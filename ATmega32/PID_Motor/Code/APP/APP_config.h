@@ -14,7 +14,7 @@
  * - ADC channels for feedback, setpoint, and analog PID tuning
  * - DAC output port for optional signal visualization
  * - Motor direction and PWM control pins
- * - Sampling interval and deadband threshold
+ * - Sampling interval and deadband threshold (defaults and ranges of the runtime parameters)
  * - Digital/Analog mode selection defaults
  *
  * @note
@@ -30,6 +30,8 @@
 #ifndef APP_CONFIG_H_
 #define APP_CONFIG_H_
 
+#include "APP_def.h"
+
 
 
 /*Maximum value for proportional gain (Kp) when use analog mode by KP_ADC channel*/
@@ -52,6 +54,21 @@
 #define DEADBAND			5
 
 
+/*Ranges of the runtime parameters (the values above are the defaults)
+ * the parameters can be changed over UART in analog mode while the loop is running
+ */
+#define GAIN_MAX_LIMIT		100
+#define DEADBAND_LIMIT		200
+#define SAMPLE_MS_MIN		5
+#define SAMPLE_MS_MAX		200
+
+
+/*Number of status lines (100 ms each) between two binary metrics frames in analog mode
+ * the metrics are enabled by METRICS_STATUS in `METRICS_config.h`
+ */
+#define METRICS_EXPORT_LOOPS	10
+
+
 /*Terminating character for UART string input*/
 #define STOP_CHAR			' '
 
@@ -95,6 +112,41 @@
 
 
 
+/*Set the motor PWM output stage:
+ * choose between:
+ * 1. MOTOR_PWM_TIMER0		<-- 8-bit PWM on OC0 (PB3)
+ * 2. MOTOR_PWM_TIMER1		<-- high resolution PWM on OC1A (PD5), frequency and TOP set by TIMER1_ICR1_PRELOAD
+ */
+#define MOTOR_PWM_OUTPUT	MOTOR_PWM_TIMER0
+
+
+
+/*Set the cycle benchmark:
+ * choose between:
+ * 1. PID_BENCHMARK_DISABLE
+ * 2. PID_BENCHMARK_ENABLE		<-- sends "BENCH,<function>,<cycles>" lines over UART at start,
+ * 								    needs TIMER1 in TIMER1_NORMAL_MODE with TIMER1_NO_PRESCALER
+ */
+#define PID_BENCHMARK		PID_BENCHMARK_DISABLE
+
+
+
+/*Set the source of the derivative term:
+ * choose between:
+ * 1. PID_DERIVATIVE_RAW
+ * 2. PID_DERIVATIVE_ESTIMATOR	<-- velocity of the alpha-beta estimator on the feedback samples
+ */
+#define PID_DERIVATIVE		PID_DERIVATIVE_ESTIMATOR
+
+
+/*Tracking index of the alpha-beta estimator (steady-state Kalman gains, from 0 to 100)
+ * smaller filters more and follows slower: 0.2 gives alpha = 0.47, beta = 0.15 and
+ * 6.8 times less velocity noise than the raw difference for a lag of 3 samples
+ */
+#define ESTIMATOR_TRACKING_INDEX	0.2
+
+
+
 /*Set the ADC channels:
  * choose between:
  * 1. ADC0
@@ -114,4 +166,40 @@
 
 
 
+
+
+/*Set Automatically*/
+/*MOTOR_PWM_MAX = maximum PWM compare value (full speed)*/
+#if   MOTOR_PWM_OUTPUT == MOTOR_PWM_TIMER0
+	#define MOTOR_PWM_MAX				255
+#elif MOTOR_PWM_OUTPUT == MOTOR_PWM_TIMER1
+	#define MOTOR_PWM_MAX				TIMER1_ICR1_PRELOAD
+#else
+	#error "Wrong \"MOTOR_PWM_OUTPUT\" configuration option"
+#endif
+
+#if   PID_BENCHMARK == PID_BENCHMARK_ENABLE
+	#if MOTOR_PWM_OUTPUT == MOTOR_PWM_TIMER1
+		#error "The benchmark uses TIMER1, select MOTOR_PWM_TIMER0"
+	#endif
+#elif PID_BENCHMARK != PID_BENCHMARK_DISABLE
+	#error "Wrong \"PID_BENCHMARK\" configuration option"
+#endif
+
+#if ( PID_DERIVATIVE != PID_DERIVATIVE_RAW ) && ( PID_DERIVATIVE != PID_DERIVATIVE_ESTIMATOR )
+	#error "Wrong \"PID_DERIVATIVE\" configuration option"
+#endif
+
+#if ( SAMPLE_MS < SAMPLE_MS_MIN ) || ( SAMPLE_MS > SAMPLE_MS_MAX ) || ( DEADBAND > DEADBAND_LIMIT )
+	#error "The default parameters must be in their ranges"
+#endif
+
+/*The UART, TIMER, ADC and EEPROM drivers use the ATmega32 registers and vector numbers
+ * (UART __vector_13/__vector_15 and one USART), the ATmega644P/1284P layer is only in SnakeGame (MCAL/DEVICE)*/
+#if defined(__AVR__) && !defined(__AVR_ATmega32__)
+	#error "The MCAL drivers of this project are for the ATmega32 only (build with -mmcu=atmega32)"
+#endif
+
+
+
 #endif /* APP_CONFIG_H_ */
@@ -0,0 +1,54 @@
+/****************************************************************************
+ * @file    APP_def.h
+ * @author  Boles Medhat
+ * @brief   Definitions Header File for PID Motor Control
+ * @version 1.0
+ * @date    [2024-05-20]
+ *
+ * @details
+ * This file contains the options used by `APP_config.h` to select the
+ * motor PWM output stage of the PID motor control application, and the ids
+ * of its runtime parameters.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ***************************************************************************/
+
+#ifndef APP_DEF_H_
+#define APP_DEF_H_
+
+
+/*------------------------------------------   modes    -----------------------------------------*/
+
+/*Motor PWM Output Stage*/
+#define MOTOR_PWM_TIMER0			0	/*8-bit Fast PWM on OC0 (PB3), 256 steps*/
+#define MOTOR_PWM_TIMER1			1	/*16-bit Fast PWM on OC1A (PD5) with TOP = ICR1 (TIMER1_ICR1_PRELOAD)*/
+
+/*Cycle Benchmark*/
+#define PID_BENCHMARK_DISABLE		0	/*Normal start*/
+#define PID_BENCHMARK_ENABLE		1	/*Send the CPU cycles of the main functions over UART at start (uses TIMER1)*/
+
+/*Derivative Term Source*/
+#define PID_DERIVATIVE_RAW			0	/*Difference of the last two feedback samples*/
+#define PID_DERIVATIVE_ESTIMATOR	1	/*Velocity of the alpha-beta estimator (less noise, see ESTIMATOR_TRACKING_INDEX)*/
+/*_______________________________________________________________________________________________*/
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Controller output range the PID gains are tuned for (8-bit PWM)*/
+#define PID_OUTPUT_BASE				255
+
+/*Runtime parameter ids (PARAM protocol)*/
+#define PARAM_ID_KP_MAX				0	/*float32: maximum Kp of the analog mode*/
+#define PARAM_ID_KI_MAX				1	/*float32: maximum Ki of the analog mode*/
+#define PARAM_ID_KD_MAX				2	/*float32: maximum Kd of the analog mode*/
+#define PARAM_ID_DEADBAND			3	/*uint16 : dead zone of the error*/
+#define PARAM_ID_SAMPLE_MS			4	/*uint16 : sampling interval in milliseconds*/
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* APP_DEF_H_ */
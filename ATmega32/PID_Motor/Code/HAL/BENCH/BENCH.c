@@ -0,0 +1,148 @@
+/****************************************************************************
+ * @file    BENCH.c
+ * @author  Boles Medhat
+ * @brief   Cycle Benchmark Source File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file implements the cycle benchmark with the Timer1 counter.
+ * The difference of two 16-bit counter values is correct even if the
+ * counter wraps once between them, so the counter is never reset.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include "BENCH.h"
+
+
+/* Timer1 ticks of measuring an empty function */
+static uint16 g_BENCH_Overhead = 0;
+
+
+
+
+
+/*
+ * @brief Empty function used to measure the cost of the measurement.
+ */
+static void BENCH_Empty( void )
+{
+}
+
+
+
+
+
+/*
+ * @brief Measures the smallest number of Timer1 ticks of a function call.
+ *
+ * @param function: Pointer to the function to measure.
+ *
+ * @return (uint16) Smallest number of ticks of BENCH_RUNS calls (with the measurement cost).
+ */
+static uint16 BENCH_Ticks( void (*function)(void) )
+{
+	uint16 best = BENCH_MAX_TICKS;
+
+	for ( uint8 run = 0 ; run < BENCH_RUNS ; run++ )
+	{
+		/* Save global interrupt flag and disable it, so no ISR is measured */
+		uint8 sreg = SREG;
+		CLR_BIT( SREG , I );
+
+		uint16 start = TIMER1_GetTimerValue();
+
+		function();
+
+		uint16 ticks = TIMER1_GetTimerValue() - start;
+
+		/* Restore global interrupt flag */
+		SREG = sreg;
+
+		if ( ticks < best )
+		{
+			best = ticks;
+		}
+	}
+
+	return best;
+}
+
+
+
+
+
+/*
+ * @brief Starts Timer1 as the cycle counter and measures the cost of the measurement itself (an empty function call).
+ */
+void BENCH_Init( void )
+{
+	/* Timer1 in normal mode (counts up to 0xFFFF and wraps), clocked by the CPU clock (no prescaler) */
+	TCCR1A = 0;
+	TCCR1B = ( 1 << CS10 );
+
+	g_BENCH_Overhead = BENCH_Ticks( BENCH_Empty );
+}
+
+
+
+
+
+/*
+ * @brief Measures the CPU cycles of one call of a function.
+ *
+ * @param function: Pointer to the function to measure (wrap the call with its
+ * 					arguments in a function without parameters).
+ *
+ * @return (uint32) Smallest number of CPU cycles of BENCH_RUNS calls.
+ */
+uint32 BENCH_Cycles( void (*function)(void) )
+{
+	/* Check that the pointer is valid */
+	if ( function == NULL )
+	{
+		return 0;
+	}
+
+	uint16 ticks = BENCH_Ticks( function );
+
+	/* Remove the cost of the call and the counter reads */
+	ticks = ( ticks > g_BENCH_Overhead ) ? ( ticks - g_BENCH_Overhead ) : 0;
+
+	/* Timer1 runs without a prescaler, every tick is one CPU cycle */
+	return ticks;
+}
+
+
+
+
+
+/*
+ * @brief Measures a function and sends the result over UART.
+ *
+ * Sends the line "BENCH,<name>,<cycles>\n".
+ *
+ * @param name:     Name of the measured function.
+ * @param function: Pointer to the function to measure.
+ */
+void BENCH_Report( const char * name , void (*function)(void) )
+{
+	uint32 cycles = BENCH_Cycles( function );
+
+	UART_WriteString( BENCH_REPORT_PREFIX );
+	UART_WriteString( name );
+	UART_WriteByte( BENCH_REPORT_SEPARATOR );
+	UART_WriteNumber( cycles );
+	UART_WriteByte( '\n' );
+}
+
+
+
+
+
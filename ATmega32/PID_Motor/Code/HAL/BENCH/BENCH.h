@@ -0,0 +1,73 @@
+/****************************************************************************
+ * @file    BENCH.h
+ * @author  Boles Medhat
+ * @brief   Cycle Benchmark Header File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file provides a way to measure how many CPU cycles a function costs
+ * on the real MCU (or on any simulator that runs the same firmware).
+ * The function is called BENCH_RUNS times with the interrupts disabled,
+ * the Timer1 counter is read before and after every call, the cost of the
+ * measurement itself (measured once by BENCH_Init) is subtracted and the
+ * smallest result is kept.
+ *
+ * The results are sent over UART as one line per function:
+ *     BENCH,<name>,<cycles>
+ * so the output can be saved and compared between two versions of the code.
+ *
+ * @note
+ * - ⚠️ IMPORTANT: You must initialize the UART module **before** calling BENCH_Report.
+ * - BENCH_Init sets Timer1 to normal mode without a prescaler, so Timer1
+ *   cannot be used for anything else while the benchmark runs (initialize
+ *   it again after the benchmark, for example for the motor PWM).
+ * - A measured call must be shorter than 65536 Timer1 ticks.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef BENCH_H_
+#define BENCH_H_
+
+#include "../../MCAL/TIMER1/TIMER1.h"
+#include "../../MCAL/UART/UART.h"
+#include "BENCH_config.h"
+
+
+/*
+ * @brief Starts Timer1 as the cycle counter and measures the cost of the measurement itself (an empty function call).
+ */
+void BENCH_Init( void );
+
+
+
+/*
+ * @brief Measures the CPU cycles of one call of a function.
+ *
+ * @param function: Pointer to the function to measure (wrap the call with its
+ * 					arguments in a function without parameters).
+ *
+ * @return (uint32) Smallest number of CPU cycles of BENCH_RUNS calls.
+ */
+uint32 BENCH_Cycles( void (*function)(void) );
+
+
+
+/*
+ * @brief Measures a function and sends the result over UART.
+ *
+ * Sends the line "BENCH,<name>,<cycles>\n".
+ *
+ * @param name:     Name of the measured function.
+ * @param function: Pointer to the function to measure.
+ */
+void BENCH_Report( const char * name , void (*function)(void) );
+
+
+#endif /* BENCH_H_ */
@@ -0,0 +1,40 @@
+/****************************************************************************
+ * @file    BENCH_config.h
+ * @author  Boles Medhat
+ * @brief   Cycle Benchmark Configuration Header File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @note
+ * - BENCH_Init sets Timer1 to normal mode without a prescaler (one cycle
+ *   per tick), whatever TIMER1_config.h selects. Initialize Timer1 again
+ *   after the benchmark if it is used for something else.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef BENCH_CONFIG_H_
+#define BENCH_CONFIG_H_
+
+#include "BENCH_def.h"
+#include "../../MCAL/TIMER1/TIMER1.h"
+
+
+/*Set the number of runs of every benchmark
+ * the smallest result is reported, so a run delayed by a busy peripheral
+ * (for example a UART byte still being sent) is not counted
+ */
+#define BENCH_RUNS							8
+
+
+#if BENCH_RUNS == 0 || BENCH_RUNS > 255
+	#error "BENCH_RUNS must be from 1 to 255"
+#endif
+
+
+#endif /* BENCH_CONFIG_H_ */
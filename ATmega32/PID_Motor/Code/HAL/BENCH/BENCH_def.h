@@ -0,0 +1,37 @@
+/****************************************************************************
+ * @file    BENCH_def.h
+ * @author  Boles Medhat
+ * @brief   Cycle Benchmark Definitions Header File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the macro definitions and constants used by the cycle
+ * benchmark (CPU cycles per call measured with the Timer1 counter).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef BENCH_DEF_H_
+#define BENCH_DEF_H_
+
+#include "../../LIB/STD_TYPES.h"
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Longest call that can be measured (in Timer1 ticks, the counter is 16-bit)*/
+#define BENCH_MAX_TICKS						0xFFFF
+
+/*Report line format: BENCH_REPORT_PREFIX name BENCH_REPORT_SEPARATOR cycles '\n'*/
+#define BENCH_REPORT_PREFIX					"BENCH,"
+#define BENCH_REPORT_SEPARATOR				','
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* BENCH_DEF_H_ */
@@ -0,0 +1,601 @@
+/****************************************************************************
+ * @file    PARAM.c
+ * @author  Boles Medhat
+ * @brief   Runtime Parameters Source File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file implements the runtime parameter registry, the pending values
+ * written at the safe point (PARAM_Apply), the EEPROM persistence and the
+ * binary UART protocol.
+ * The parameter table is indexed by the id, so a request needs no search.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include "PARAM.h"
+#include "../../LIB/METRICS/METRICS.h"
+
+
+/* Registered parameters (indexed by the id) */
+static ParamEntry g_PARAM_Table[ PARAM_MAX_PARAMETERS ];
+
+/* Size in bytes of every parameter type */
+static const uint8 g_PARAM_TypeSize[] = { 1 , 2 , 2 , 4 };
+
+/* true if at least one parameter has a pending value */
+static volatile bool g_PARAM_IsPending = false;
+
+/* Request frame being received */
+static volatile uint8 g_PARAM_Frame[ PARAM_REQUEST_SIZE ];
+static volatile uint8 g_PARAM_FrameIndex = 0;
+static volatile bool  g_PARAM_FrameReady = false;
+
+/* Byte buffer of the UART RX callback (the ISR may also store the stop byte after it) */
+static uint8 g_PARAM_RX_Byte[ 2 ];
+
+
+
+
+
+/*
+ * @brief Checks that an id is registered.
+ *
+ * @param id: Id of the parameter.
+ *
+ * @return (bool) true if the id is registered, false otherwise.
+ */
+static bool PARAM_IsRegistered( uint8 id )
+{
+	return ( id < PARAM_MAX_PARAMETERS ) && ( g_PARAM_Table[id].address != NULL );
+}
+
+
+
+
+
+/*
+ * @brief Checks that a value is in the range of a parameter (NaN is out of range).
+ *
+ * @param entry: Pointer to the parameter.
+ * @param value: Value to check.
+ *
+ * @return (bool) true if the value is accepted, false otherwise.
+ */
+static bool PARAM_InRange( const ParamEntry * entry , float32 value )
+{
+	return ( value >= entry->min ) && ( value <= entry->max );
+}
+
+
+
+
+
+/*
+ * @brief Converts a value to the type of a parameter (integers are rounded).
+ *
+ * @param type:  Type of the parameter.
+ * @param value: Value to convert.
+ * @param raw:   Pointer to store the bytes of the converted value.
+ */
+static void PARAM_ToRaw( uint8 type , float32 value , uint8 * raw )
+{
+	switch ( type )
+	{
+		case PARAM_UINT8:
+			raw[0] = (uint8)( value + 0.5f );
+			break;
+
+		case PARAM_UINT16:
+			*(uint16 *)raw = (uint16)( value + 0.5f );
+			break;
+
+		case PARAM_SINT16:
+			*(sint16 *)raw = (sint16)( ( value < 0 ) ? ( value - 0.5f ) : ( value + 0.5f ) );
+			break;
+
+		default:
+			*(float32 *)raw = value;
+			break;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Converts the bytes of a parameter variable to a float32 value.
+ *
+ * @param type: Type of the parameter.
+ * @param raw:  Pointer to the bytes of the variable.
+ *
+ * @return (float32) Value of the variable.
+ */
+static float32 PARAM_FromRaw( uint8 type , const uint8 * raw )
+{
+	switch ( type )
+	{
+		case PARAM_UINT8:  return raw[0];
+		case PARAM_UINT16: return *(const uint16 *)raw;
+		case PARAM_SINT16: return *(const sint16 *)raw;
+		default:           return *(const float32 *)raw;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Copies bytes from one buffer to another.
+ *
+ * @param destination: Pointer to the destination.
+ * @param source:      Pointer to the source.
+ * @param size:        Number of bytes.
+ */
+static void PARAM_Copy( uint8 * destination , const uint8 * source , uint8 size )
+{
+	for ( uint8 i = 0 ; i < size ; i++ )
+	{
+		destination[i] = source[i];
+	}
+}
+
+
+
+
+
+/*
+ * @brief Registers an application variable as a parameter and sets it to the default value.
+ *
+ * @param id:      Id of the parameter (from 0 to PARAM_MAX_PARAMETERS - 1).
+ * @param address: Address of the variable.
+ * @param type:    Type of the variable [ PARAM_UINT8 , PARAM_UINT16 , PARAM_SINT16 , PARAM_FLOAT32 ].
+ * @param min:     Smallest accepted value.
+ * @param max:     Largest accepted value.
+ * @param def:     Default value.
+ * @param flags:   [ PARAM_VOLATILE , PARAM_PERSISTENT ].
+ *
+ * @return (bool) true if registered, false if the id is used or out of range, or a value is wrong.
+ */
+bool PARAM_Register( uint8 id , void * address , uint8 type , float32 min , float32 max , float32 def , uint8 flags )
+{
+	/* Check the id, the variable and the type */
+	if ( ( id >= PARAM_MAX_PARAMETERS ) || ( g_PARAM_Table[id].address != NULL ) || ( address == NULL ) || ( type > PARAM_FLOAT32 ) )
+	{
+		return false;
+	}
+
+	ParamEntry * entry = &g_PARAM_Table[id];
+
+	entry->min   = min;
+	entry->max   = max;
+	entry->def   = def;
+	entry->type  = type;
+	entry->flags = flags;
+	entry->is_pending = false;
+
+	/* The default value must be in the range */
+	if ( PARAM_InRange( entry , def ) == false )
+	{
+		return false;
+	}
+
+	/* Set the variable to the default value (the control is not running yet) */
+	uint8 raw[ 4 ];
+	PARAM_ToRaw( type , def , raw );
+	PARAM_Copy( (uint8 *)address , raw , g_PARAM_TypeSize[type] );
+
+	/* Mark the id as registered */
+	entry->address = address;
+
+	return true;
+}
+
+
+
+
+
+/*
+ * @brief Loads the saved values of the persistent parameters from the EEPROM.
+ *
+ * Call it after registering all the parameters and before the control starts.
+ * Nothing is loaded if the EEPROM does not hold PARAM_EEPROM_MAGIC, and a saved
+ * value out of the range of its parameter is ignored.
+ */
+void PARAM_Load( void )
+{
+	/* Check that the EEPROM holds saved parameters */
+	if ( EEPROM_ReadByte( PARAM_EEPROM_START ) != PARAM_EEPROM_MAGIC )
+	{
+		return;
+	}
+
+	for ( uint8 id = 0 ; id < PARAM_MAX_PARAMETERS ; id++ )
+	{
+		ParamEntry * entry = &g_PARAM_Table[id];
+
+		if ( ( entry->address != NULL ) && ( entry->flags & PARAM_PERSISTENT ) )
+		{
+			float32 value = EEPROM_ReadFloat32( PARAM_EEPROM_SLOT( id ) );
+
+			/* Ignore an erased (NaN) or out of range value */
+			if ( PARAM_InRange( entry , value ) )
+			{
+				uint8 raw[ 4 ];
+				PARAM_ToRaw( entry->type , value , raw );
+				PARAM_Copy( (uint8 *)entry->address , raw , g_PARAM_TypeSize[entry->type] );
+			}
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Writes the current values of the persistent parameters to the EEPROM.
+ *
+ * Only the changed bytes are written. It waits for every EEPROM write, so call it
+ * from the main loop only.
+ */
+void PARAM_Save( void )
+{
+	for ( uint8 id = 0 ; id < PARAM_MAX_PARAMETERS ; id++ )
+	{
+		ParamEntry * entry = &g_PARAM_Table[id];
+
+		if ( ( entry->address != NULL ) && ( entry->flags & PARAM_PERSISTENT ) )
+		{
+			float32 value;
+			uint8 * bytes = (uint8 *)&value;
+
+			PARAM_Get( id , &value );
+
+			/* Write only the changed bytes (saves EEPROM write cycles) */
+			for ( uint8 i = 0 ; i < 4 ; i++ )
+			{
+				if ( EEPROM_ReadByte( PARAM_EEPROM_SLOT( id ) + i ) != bytes[i] )
+				{
+					EEPROM_WriteByte( PARAM_EEPROM_SLOT( id ) + i , bytes[i] );
+				}
+			}
+		}
+	}
+
+	/* Mark the values as valid after they are written */
+	if ( EEPROM_ReadByte( PARAM_EEPROM_START ) != PARAM_EEPROM_MAGIC )
+	{
+		EEPROM_WriteByte( PARAM_EEPROM_START , PARAM_EEPROM_MAGIC );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Requests a new value of a parameter.
+ *
+ * The value is checked and converted to the type of the parameter, then it
+ * is written to the variable by the next PARAM_Apply call.
+ *
+ * @param id:    Id of the parameter.
+ * @param value: New value.
+ *
+ * @return (uint8) [ PARAM_OK , PARAM_BAD_ID , PARAM_BAD_RANGE ].
+ */
+uint8 PARAM_Set( uint8 id , float32 value )
+{
+	if ( PARAM_IsRegistered( id ) == false )
+	{
+		return PARAM_BAD_ID;
+	}
+
+	ParamEntry * entry = &g_PARAM_Table[id];
+
+	if ( PARAM_InRange( entry , value ) == false )
+	{
+		return PARAM_BAD_RANGE;
+	}
+
+	/* Convert before disabling the interrupts */
+	uint8 raw[ 4 ];
+	PARAM_ToRaw( entry->type , value , raw );
+
+	/* Save global interrupt flag and disable it, so PARAM_Apply never copies a half written value */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	PARAM_Copy( entry->pending , raw , 4 );
+	entry->is_pending = true;
+	g_PARAM_IsPending = true;
+
+	/* Restore global interrupt flag */
+	SREG = sreg;
+
+	return PARAM_OK;
+}
+
+
+
+
+
+/*
+ * @brief Reads the current value of a parameter.
+ *
+ * @param id:    Id of the parameter.
+ * @param value: Pointer to store the value.
+ *
+ * @return (uint8) [ PARAM_OK , PARAM_BAD_ID ].
+ */
+uint8 PARAM_Get( uint8 id , float32 * value )
+{
+	if ( PARAM_IsRegistered( id ) == false )
+	{
+		return PARAM_BAD_ID;
+	}
+
+	ParamEntry * entry = &g_PARAM_Table[id];
+	uint8 raw[ 4 ];
+
+	/* Save global interrupt flag and disable it, so the variable is not changed while it is copied */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	PARAM_Copy( raw , (const uint8 *)entry->address , g_PARAM_TypeSize[entry->type] );
+
+	/* Restore global interrupt flag */
+	SREG = sreg;
+
+	*value = PARAM_FromRaw( entry->type , raw );
+
+	return PARAM_OK;
+}
+
+
+
+
+
+/*
+ * @brief Writes all the pending values to their variables.
+ *
+ * Call it at the safe point of the control tick (with the interrupts disabled,
+ * for example from the control interrupt). When nothing is pending it only
+ * checks one flag.
+ *
+ * @return (bool) true if at least one variable is changed, false otherwise.
+ */
+bool PARAM_Apply( void )
+{
+	/* Fast path of every control tick */
+	if ( g_PARAM_IsPending == false )
+	{
+		return false;
+	}
+
+	for ( uint8 id = 0 ; id < PARAM_MAX_PARAMETERS ; id++ )
+	{
+		ParamEntry * entry = &g_PARAM_Table[id];
+
+		if ( entry->is_pending )
+		{
+			PARAM_Copy( (uint8 *)entry->address , entry->pending , g_PARAM_TypeSize[entry->type] );
+			entry->is_pending = false;
+		}
+	}
+
+	g_PARAM_IsPending = false;
+
+	return true;
+}
+
+
+
+
+
+/*
+ * @brief UART RX callback, passes the received byte to the request frame.
+ */
+static void PARAM_RX_Callback( void )
+{
+	PARAM_ReceiveByte( g_PARAM_RX_Byte[0] );
+}
+
+
+
+
+
+/*
+ * @brief Starts receiving the requests with the UART RX interrupt.
+ *
+ * Sets the UART RX callback and enables the RX interrupt, after this call
+ * the UART must not be read by polling.
+ */
+void PARAM_Listen( void )
+{
+	/* The callback is called after every byte (buffer size of one byte) */
+	UART_Set_RX_Callback( PARAM_RX_Callback , g_PARAM_RX_Byte , 1 , PARAM_SYNC );
+
+	UART_InterruptEnable( UART_INT_RX_ID );
+}
+
+
+
+
+
+/*
+ * @brief Adds one received byte to the request frame.
+ *
+ * Called by the RX interrupt (PARAM_Listen), or by the application if it
+ * receives the bytes itself. Bytes before PARAM_SYNC are ignored, and the
+ * bytes of a new request are ignored until PARAM_Task handles the last one.
+ *
+ * @param byte: Received byte.
+ */
+void PARAM_ReceiveByte( uint8 byte )
+{
+	/* The last request is not handled yet */
+	if ( g_PARAM_FrameReady )
+	{
+		METRICS_INC16( METRIC_PARAM_DROPPED );
+		return;
+	}
+
+	/* Wait for the start of a frame */
+	if ( ( g_PARAM_FrameIndex == 0 ) && ( byte != PARAM_SYNC ) )
+	{
+		return;
+	}
+
+	g_PARAM_Frame[ g_PARAM_FrameIndex ] = byte;
+	g_PARAM_FrameIndex++;
+
+	if ( g_PARAM_FrameIndex >= PARAM_REQUEST_SIZE )
+	{
+		g_PARAM_FrameIndex = 0;
+		g_PARAM_FrameReady = true;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Sends a reply frame.
+ *
+ * @param command: Command of the request.
+ * @param id:      Id of the request.
+ * @param status:  Reply status.
+ * @param value:   Pointer to the 4 value bytes.
+ */
+static void PARAM_Reply( uint8 command , uint8 id , uint8 status , const uint8 * value )
+{
+	uint8 reply[ PARAM_REPLY_SIZE ];
+	uint8 checksum = 0;
+
+	reply[0] = PARAM_SYNC;
+	reply[1] = command | PARAM_REPLY;
+	reply[2] = id;
+	reply[3] = status;
+	PARAM_Copy( &reply[4] , value , 4 );
+
+	for ( uint8 i = 1 ; i < PARAM_REPLY_SIZE - 1 ; i++ )
+	{
+		checksum ^= reply[i];
+	}
+	reply[ PARAM_REPLY_SIZE - 1 ] = checksum;
+
+	UART_WriteArray( reply , PARAM_REPLY_SIZE );
+}
+
+
+
+
+
+/*
+ * @brief Handles the received request (if any) and sends the reply.
+ *
+ * Call it from the main loop.
+ */
+void PARAM_Task( void )
+{
+	if ( g_PARAM_FrameReady == false )
+	{
+		return;
+	}
+
+	uint8 frame[ PARAM_REQUEST_SIZE ];
+	uint8 checksum = 0;
+
+	PARAM_Copy( frame , (const uint8 *)g_PARAM_Frame , PARAM_REQUEST_SIZE );
+
+	/* Ready for the next request */
+	g_PARAM_FrameReady = false;
+
+	for ( uint8 i = 1 ; i < PARAM_REQUEST_SIZE - 1 ; i++ )
+	{
+		checksum ^= frame[i];
+	}
+
+	uint8 command = frame[1];
+	uint8 id      = frame[2];
+	uint8 status  = PARAM_OK;
+	float32 value;
+
+	/* Value of the request (little endian float32, the same byte order as the AVR) */
+	PARAM_Copy( (uint8 *)&value , &frame[3] , 4 );
+
+	if ( checksum != frame[ PARAM_REQUEST_SIZE - 1 ] )
+	{
+		METRICS_INC16( METRIC_PARAM_BAD_FRAMES );
+		status = PARAM_BAD_CHECKSUM;
+	}
+	else
+	{
+		switch ( command )
+		{
+			case PARAM_CMD_GET:
+				status = PARAM_Get( id , &value );
+				break;
+
+			case PARAM_CMD_SET:
+				status = PARAM_Set( id , value );
+				break;
+
+			case PARAM_CMD_SAVE:
+				PARAM_Save();
+				break;
+
+			case PARAM_CMD_DEFAULTS:
+				for ( uint8 i = 0 ; i < PARAM_MAX_PARAMETERS ; i++ )
+				{
+					if ( g_PARAM_Table[i].address != NULL )
+					{
+						PARAM_Set( i , g_PARAM_Table[i].def );
+					}
+				}
+				break;
+
+			case PARAM_CMD_INFO:
+			case PARAM_CMD_MIN:
+			case PARAM_CMD_MAX:
+				if ( PARAM_IsRegistered( id ) == false )
+				{
+					status = PARAM_BAD_ID;
+				}
+				else if ( command == PARAM_CMD_MIN )
+				{
+					value = g_PARAM_Table[id].min;
+				}
+				else if ( command == PARAM_CMD_MAX )
+				{
+					value = g_PARAM_Table[id].max;
+				}
+				else
+				{
+					uint8 * info = (uint8 *)&value;
+					info[0] = g_PARAM_Table[id].type;
+					info[1] = g_PARAM_Table[id].flags;
+					info[2] = 0;
+					info[3] = 0;
+				}
+				break;
+
+			default:
+				status = PARAM_BAD_COMMAND;
+				break;
+		}
+	}
+
+	PARAM_Reply( command , id , status , (const uint8 *)&value );
+}
@@ -0,0 +1,154 @@
+/****************************************************************************
+ * @file    PARAM.h
+ * @author  Boles Medhat
+ * @brief   Runtime Parameters Header File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file provides a registry of typed application variables that can be
+ * read and changed over UART while the control loop is running.
+ * Every parameter has an id, a type, a range, a default value, and can be
+ * saved in the EEPROM to be loaded at the next start.
+ *
+ * A new value is not written to the variable when it is received, it is kept
+ * as pending and written by PARAM_Apply(), which the application calls at a
+ * safe point of its control tick (for example at the start of the control
+ * interrupt), so the control code never sees a half written value or a set
+ * of parameters that is only partly changed.
+ *
+ * The protocol is binary and compact (8 byte requests, 9 byte replies, see
+ * `PARAM_def.h`), every frame starts with PARAM_SYNC which is not an ASCII
+ * character, so the replies can be mixed with text lines on the same UART.
+ *
+ * @note
+ * - The bytes are received by the UART RX interrupt (PARAM_Listen), and the
+ *   requests are done by PARAM_Task() in the main loop, so the replies and the
+ *   EEPROM writes never delay the control interrupt.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef PARAM_H_
+#define PARAM_H_
+
+#include "../../MCAL/UART/UART.h"
+#include "../../MCAL/EEPROM/EEPROM.h"
+#include "PARAM_config.h"
+
+
+/*
+ * @brief Registers an application variable as a parameter and sets it to the default value.
+ *
+ * @param id:      Id of the parameter (from 0 to PARAM_MAX_PARAMETERS - 1).
+ * @param address: Address of the variable.
+ * @param type:    Type of the variable [ PARAM_UINT8 , PARAM_UINT16 , PARAM_SINT16 , PARAM_FLOAT32 ].
+ * @param min:     Smallest accepted value.
+ * @param max:     Largest accepted value.
+ * @param def:     Default value.
+ * @param flags:   [ PARAM_VOLATILE , PARAM_PERSISTENT ].
+ *
+ * @return (bool) true if registered, false if the id is used or out of range, or a value is wrong.
+ */
+bool PARAM_Register( uint8 id , void * address , uint8 type , float32 min , float32 max , float32 def , uint8 flags );
+
+
+
+/*
+ * @brief Loads the saved values of the persistent parameters from the EEPROM.
+ *
+ * Call it after registering all the parameters and before the control starts.
+ * Nothing is loaded if the EEPROM does not hold PARAM_EEPROM_MAGIC, and a saved
+ * value out of the range of its parameter is ignored.
+ */
+void PARAM_Load( void );
+
+
+
+/*
+ * @brief Writes the current values of the persistent parameters to the EEPROM.
+ *
+ * Only the changed bytes are written. It waits for every EEPROM write, so call it
+ * from the main loop only.
+ */
+void PARAM_Save( void );
+
+
+
+/*
+ * @brief Requests a new value of a parameter.
+ *
+ * The value is checked and converted to the type of the parameter, then it
+ * is written to the variable by the next PARAM_Apply call.
+ *
+ * @param id:    Id of the parameter.
+ * @param value: New value.
+ *
+ * @return (uint8) [ PARAM_OK , PARAM_BAD_ID , PARAM_BAD_RANGE ].
+ */
+uint8 PARAM_Set( uint8 id , float32 value );
+
+
+
+/*
+ * @brief Reads the current value of a parameter.
+ *
+ * @param id:    Id of the parameter.
+ * @param value: Pointer to store the value.
+ *
+ * @return (uint8) [ PARAM_OK , PARAM_BAD_ID ].
+ */
+uint8 PARAM_Get( uint8 id , float32 * value );
+
+
+
+/*
+ * @brief Writes all the pending values to their variables.
+ *
+ * Call it at the safe point of the control tick (with the interrupts disabled,
+ * for example from the control interrupt). When nothing is pending it only
+ * checks one flag.
+ *
+ * @return (bool) true if at least one variable is changed, false otherwise.
+ */
+bool PARAM_Apply( void );
+
+
+
+/*
+ * @brief Starts receiving the requests with the UART RX interrupt.
+ *
+ * Sets the UART RX callback and enables the RX interrupt, after this call
+ * the UART must not be read by polling.
+ */
+void PARAM_Listen( void );
+
+
+
+/*
+ * @brief Adds one received byte to the request frame.
+ *
+ * Called by the RX interrupt (PARAM_Listen), or by the application if it
+ * receives the bytes itself. Bytes before PARAM_SYNC are ignored, and the
+ * bytes of a new request are ignored until PARAM_Task handles the last one.
+ *
+ * @param byte: Received byte.
+ */
+void PARAM_ReceiveByte( uint8 byte );
+
+
+
+/*
+ * @brief Handles the received request (if any) and sends the reply.
+ *
+ * Call it from the main loop.
+ */
+void PARAM_Task( void );
+
+
+#endif /* PARAM_H_ */
@@ -0,0 +1,59 @@
+/****************************************************************************
+ * @file    PARAM_config.h
+ * @author  Boles Medhat
+ * @brief   Runtime Parameters Configuration Header File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @note
+ * - ⚠️ IMPORTANT: You must initialize the UART module before calling PARAM_Listen.
+ * 				   This driver does not initialize UART module internally.
+ * - PARAM_Listen enables the UART RX interrupt, do not read the UART by polling after it.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef PARAM_CONFIG_H_
+#define PARAM_CONFIG_H_
+
+#include "PARAM_def.h"
+#include "../../MCAL/UART/UART.h"
+#include "../../MCAL/EEPROM/EEPROM.h"
+
+
+/*Set the number of parameters (the ids are from 0 to PARAM_MAX_PARAMETERS - 1)*/
+#define PARAM_MAX_PARAMETERS				8
+
+
+/*Set the EEPROM address of the saved parameters
+ * (uses 1 + 4 * PARAM_MAX_PARAMETERS bytes)
+ */
+#define PARAM_EEPROM_START					0x00
+
+
+/*Set the byte that marks the saved parameters as valid
+ * change it when the meaning of the ids changes, so old saved values are not loaded
+ */
+#define PARAM_EEPROM_MAGIC					0x5A
+
+
+/* The frames are received by the RX interrupt and the replies are sent with UART_WriteByte */
+#if UART_RECEIVER_ENABLE != UART_ENABLE || UART_TRANSMITTER_ENABLE != UART_ENABLE
+	#warning "⚠️ Enable the UART receiver and transmitter for the parameters protocol."
+#endif
+
+#if PARAM_MAX_PARAMETERS == 0 || PARAM_MAX_PARAMETERS > 255
+	#error "PARAM_MAX_PARAMETERS must be from 1 to 255"
+#endif
+
+#if PARAM_EEPROM_END > EEPROM_SIZE
+	#error "The saved parameters do not fit in the EEPROM"
+#endif
+
+
+#endif /* PARAM_CONFIG_H_ */
@@ -0,0 +1,94 @@
+/****************************************************************************
+ * @file    PARAM_def.h
+ * @author  Boles Medhat
+ * @brief   Runtime Parameters Definitions Header File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the types, macro definitions and constants used by the
+ * runtime parameter registry (parameter types, flags and the binary protocol).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef PARAM_DEF_H_
+#define PARAM_DEF_H_
+
+#include "../../LIB/STD_TYPES.h"
+
+
+/*------------------------------------------   types    -----------------------------------------*/
+
+/*Registered parameter*/
+typedef struct
+{
+	void *  address;			/*Address of the application variable (NULL if the id is not registered)*/
+	float32 min;				/*Smallest accepted value*/
+	float32 max;				/*Largest accepted value*/
+	float32 def;				/*Default value*/
+	uint8   type;				/*Type of the variable [ PARAM_UINT8 , PARAM_UINT16 , PARAM_SINT16 , PARAM_FLOAT32 ]*/
+	uint8   flags;				/*PARAM_PERSISTENT or 0*/
+	uint8   pending[ 4 ];		/*New value already converted to the type of the variable*/
+	bool    is_pending;			/*true until the new value is applied by PARAM_Apply*/
+}ParamEntry;
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   modes    -----------------------------------------*/
+
+/*Parameter types*/
+#define PARAM_UINT8							0			/*uint8   variable*/
+#define PARAM_UINT16						1			/*uint16  variable*/
+#define PARAM_SINT16						2			/*sint16  variable*/
+#define PARAM_FLOAT32						3			/*float32 variable*/
+
+/*Parameter flags*/
+#define PARAM_VOLATILE						0x00		/*Starts from the default value*/
+#define PARAM_PERSISTENT					0x01		/*Loaded from the EEPROM at start and written by PARAM_Save*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Frames:
+ * request: PARAM_SYNC , command , id , value[4] , checksum
+ * reply  : PARAM_SYNC , command | PARAM_REPLY , id , status , value[4] , checksum
+ * the value is a little endian float32 for every type, the checksum is the XOR
+ * of all the bytes after PARAM_SYNC
+ */
+#define PARAM_SYNC							0xA5		/*First byte of every frame (not an ASCII character)*/
+#define PARAM_REPLY							0x80		/*Set in the command byte of the replies*/
+#define PARAM_REQUEST_SIZE					8			/*Bytes of a request frame*/
+#define PARAM_REPLY_SIZE					9			/*Bytes of a reply frame*/
+
+/*Commands*/
+#define PARAM_CMD_GET						0x01		/*Reply with the current value*/
+#define PARAM_CMD_SET						0x02		/*Set a new value (applied at the next PARAM_Apply)*/
+#define PARAM_CMD_SAVE						0x03		/*Write all the persistent parameters to the EEPROM (id is ignored)*/
+#define PARAM_CMD_DEFAULTS					0x04		/*Set all the parameters to the default values (id is ignored)*/
+#define PARAM_CMD_INFO						0x05		/*Reply with the type and flags in value[0] and value[1]*/
+#define PARAM_CMD_MIN						0x06		/*Reply with the smallest accepted value*/
+#define PARAM_CMD_MAX						0x07		/*Reply with the largest accepted value*/
+
+/*Reply status*/
+#define PARAM_OK							0			/*Command done*/
+#define PARAM_BAD_ID						1			/*The id is not registered*/
+#define PARAM_BAD_RANGE						2			/*The value is out of the range of the parameter*/
+#define PARAM_BAD_COMMAND					3			/*Unknown command*/
+#define PARAM_BAD_CHECKSUM					4			/*The checksum of the request is wrong*/
+
+/*EEPROM layout: PARAM_EEPROM_MAGIC at PARAM_EEPROM_START, then a float32 for every id*/
+#define PARAM_EEPROM_SLOT( id )				( PARAM_EEPROM_START + 1 + ( (uint16)(id) * 4 ) )
+#define PARAM_EEPROM_END					( PARAM_EEPROM_START + 1 + ( PARAM_MAX_PARAMETERS * 4 ) )		/*First address after the saved parameters*/
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* PARAM_DEF_H_ */
@@ -0,0 +1,126 @@
+/****************************************************************************
+ * @file    ESTIMATOR.c
+ * @author  Boles Medhat
+ * @brief   Alpha-Beta Estimator Library Source File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file implements the alpha-beta estimator declared in `ESTIMATOR.h`.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+
+#include "ESTIMATOR.h"
+
+
+
+
+
+/*
+ * @brief Sets the gains and starts the estimator at a position with zero velocity.
+ *
+ * @param est:      Pointer to the estimator state.
+ * @param alpha:    Position gain in Q15.16 (0 to FP_Q16_ONE).
+ * @param beta:     Velocity gain in Q15.16.
+ * @param position: First measurement.
+ */
+void ESTIMATOR_Init( Estimator * est , q15_16 alpha , q15_16 beta , sint16 position )
+{
+	est->alpha    = alpha;
+	est->beta     = beta;
+	est->position = FP_Q16_FROM_INT( position );
+	est->velocity = 0;
+}
+
+
+
+
+
+/*
+ * @brief Calculates the gains of the steady-state Kalman filter from the tracking index.
+ *
+ * @param tracking_index: Tracking index in Q15.16 (limited to ESTIMATOR_TRACKING_INDEX_MAX).
+ * @param alpha:          Pointer to store the position gain.
+ * @param beta:           Pointer to store the velocity gain.
+ */
+void ESTIMATOR_GainsFromTrackingIndex( q15_16 tracking_index , q15_16 * alpha , q15_16 * beta )
+{
+	if ( tracking_index < 0 )
+	{
+		tracking_index = 0;
+	}
+	else if ( tracking_index > ESTIMATOR_TRACKING_INDEX_MAX )
+	{
+		tracking_index = ESTIMATOR_TRACKING_INDEX_MAX;
+	}
+
+	/* r = ( 4 + index - sqrt( 8 * index + index^2 ) ) / 4 , from 1 (index 0) down to 0 */
+	q15_16 root = FP_Q16_Sqrt( ( tracking_index * 8 ) + FP_Q16_Mul( tracking_index , tracking_index ) );
+	q15_16 r    = ( FP_Q16_FROM_INT( 4 ) + tracking_index - root ) / 4;
+
+	/* alpha = 1 - r^2 */
+	*alpha = FP_Q16_ONE - FP_Q16_Mul( r , r );
+
+	/* beta = 2 * ( 1 - r )^2 */
+	*beta = FP_Q16_Mul( FP_Q16_ONE - r , FP_Q16_ONE - r ) * 2;
+}
+
+
+
+
+
+/*
+ * @brief Adds one measurement and updates the filtered position and velocity.
+ *
+ * @param est:         Pointer to the estimator state.
+ * @param measurement: New measurement (for example a 10-bit ADC sample).
+ */
+void ESTIMATOR_Update( Estimator * est , sint16 measurement )
+{
+	/* Predict the position of this sample from the last velocity */
+	q15_16 predicted = est->position + est->velocity;
+
+	/* Difference between the measurement and the prediction */
+	q15_16 residual = FP_Q16_FROM_INT( measurement ) - predicted;
+
+	/* Correct the position and the velocity by a part of the difference */
+	est->position = predicted + FP_Q16_Mul( est->alpha , residual );
+	est->velocity = est->velocity + FP_Q16_Mul( est->beta , residual );
+}
+
+
+
+
+
+/*
+ * @brief Returns the filtered position.
+ *
+ * @param est: Pointer to the estimator state.
+ * @return (q15_16) Position in measurement units.
+ */
+q15_16 ESTIMATOR_GetPosition( const Estimator * est )
+{
+	return est->position;
+}
+
+
+
+
+
+/*
+ * @brief Returns the filtered velocity.
+ *
+ * @param est: Pointer to the estimator state.
+ * @return (q15_16) Velocity in measurement units per sample.
+ */
+q15_16 ESTIMATOR_GetVelocity( const Estimator * est )
+{
+	return est->velocity;
+}
@@ -0,0 +1,102 @@
+/****************************************************************************
+ * @file    ESTIMATOR.h
+ * @author  Boles Medhat
+ * @brief   Alpha-Beta Estimator Library Header File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file provides an alpha-beta estimator in Q15.16 fixed point: every
+ * sample it predicts the position from the last velocity, then corrects the
+ * position and the velocity by a part (alpha and beta) of the difference to
+ * the measurement. The velocity is much less noisy than the difference of
+ * two raw samples, and a constant velocity is followed without lag.
+ *
+ *     predicted = position + velocity
+ *     residual  = measurement - predicted
+ *     position  = predicted + alpha * residual
+ *     velocity  = velocity  + beta  * residual
+ *
+ * The gains can be set directly or from the tracking index (the steady-state
+ * Kalman filter of a constant velocity model):
+ *     tracking index = acceleration noise * T^2 / measurement noise
+ * a small index filters more, a large index follows faster changes.
+ *
+ * @note
+ * - The velocity is in measurement units per sample, divide it by the
+ *   sampling interval to get units per second.
+ * - One update is two FP_Q16_Mul calls and a few additions (no division).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef ESTIMATOR_H_
+#define ESTIMATOR_H_
+
+#include "ESTIMATOR_def.h"
+#include "../FixedPoint/FixedPoint.h"
+
+
+
+/*
+ * @brief Sets the gains and starts the estimator at a position with zero velocity.
+ *
+ * @param est:      Pointer to the estimator state.
+ * @param alpha:    Position gain in Q15.16 (0 to FP_Q16_ONE).
+ * @param beta:     Velocity gain in Q15.16.
+ * @param position: First measurement.
+ */
+void ESTIMATOR_Init( Estimator * est , q15_16 alpha , q15_16 beta , sint16 position );
+
+
+
+/*
+ * @brief Calculates the gains of the steady-state Kalman filter from the tracking index.
+ *
+ *     r     = ( 4 + index - sqrt( 8 * index + index^2 ) ) / 4
+ *     alpha = 1 - r^2
+ *     beta  = 2 * ( 1 - r )^2
+ *
+ * @param tracking_index: Tracking index in Q15.16 (limited to ESTIMATOR_TRACKING_INDEX_MAX).
+ * @param alpha:          Pointer to store the position gain.
+ * @param beta:           Pointer to store the velocity gain.
+ */
+void ESTIMATOR_GainsFromTrackingIndex( q15_16 tracking_index , q15_16 * alpha , q15_16 * beta );
+
+
+
+/*
+ * @brief Adds one measurement and updates the filtered position and velocity.
+ *
+ * @param est:         Pointer to the estimator state.
+ * @param measurement: New measurement (for example a 10-bit ADC sample).
+ */
+void ESTIMATOR_Update( Estimator * est , sint16 measurement );
+
+
+
+/*
+ * @brief Returns the filtered position.
+ *
+ * @param est: Pointer to the estimator state.
+ * @return (q15_16) Position in measurement units.
+ */
+q15_16 ESTIMATOR_GetPosition( const Estimator * est );
+
+
+
+/*
+ * @brief Returns the filtered velocity.
+ *
+ * @param est: Pointer to the estimator state.
+ * @return (q15_16) Velocity in measurement units per sample.
+ */
+q15_16 ESTIMATOR_GetVelocity( const Estimator * est );
+
+
+#endif /* ESTIMATOR_H_ */
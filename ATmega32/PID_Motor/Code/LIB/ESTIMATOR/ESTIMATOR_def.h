@@ -0,0 +1,46 @@
+/****************************************************************************
+ * @file    ESTIMATOR_def.h
+ * @author  Boles Medhat
+ * @brief   Alpha-Beta Estimator Definitions Header File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the estimator state type and the limits of its gains.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef ESTIMATOR_DEF_H_
+#define ESTIMATOR_DEF_H_
+
+#include "../FixedPoint/FixedPoint_def.h"
+
+
+/*------------------------------------------   types    -----------------------------------------*/
+
+/*State of one alpha-beta estimator (all values in Q15.16)*/
+typedef struct
+{
+	q15_16 position;		/*Filtered position (measurement units)*/
+	q15_16 velocity;		/*Filtered velocity (measurement units per sample)*/
+	q15_16 alpha;			/*Position gain (0 to 1)*/
+	q15_16 beta;			/*Velocity gain (0 to 2, stable when beta < 4 - 2 * alpha)*/
+}Estimator;
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Largest tracking index of ESTIMATOR_GainsFromTrackingIndex (alpha is 0.9999 at 100)*/
+#define ESTIMATOR_TRACKING_INDEX_MAX	FP_Q16_FROM_INT( 100 )
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* ESTIMATOR_DEF_H_ */
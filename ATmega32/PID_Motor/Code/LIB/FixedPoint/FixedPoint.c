@@ -0,0 +1,498 @@
+/****************************************************************************
+ * @file    FixedPoint.c
+ * @author  Boles Medhat
+ * @brief   Fixed-Point Math Library Source File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file implements the Q7.8 and Q15.16 math with 8, 16 and 32-bit integer
+ * operations only. The overflow of an add or subtract is detected from the
+ * signs of the operands and the result, the multiply works on the magnitudes
+ * so every partial product is an unsigned 16x16-bit multiplication.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include "FixedPoint.h"
+
+
+/* Quarter-wave sine table: sin( i * 90 / FP_SIN_TABLE_SIZE degrees ) * 65536 (sin(90) is not stored) */
+static const uint16 g_FP_SinTable[ FP_SIN_TABLE_SIZE ] PROGMEM =
+{
+	    0,  1608,  3216,  4821,  6424,  8022,  9616, 11204,
+	12785, 14359, 15924, 17479, 19024, 20557, 22078, 23586,
+	25080, 26558, 28020, 29466, 30893, 32303, 33692, 35062,
+	36410, 37736, 39040, 40320, 41576, 42806, 44011, 45190,
+	46341, 47464, 48559, 49624, 50660, 51665, 52639, 53581,
+	54491, 55368, 56212, 57022, 57798, 58538, 59244, 59914,
+	60547, 61145, 61705, 62228, 62714, 63162, 63572, 63944,
+	64277, 64571, 64827, 65043, 65220, 65358, 65457, 65516
+};
+
+
+
+
+
+/*
+ * @brief Adds two Q7.8 numbers with saturation.
+ *
+ * @return (q7_8) a + b, limited to [FP_Q8_MIN , FP_Q8_MAX].
+ */
+q7_8 FP_Q8_Add( q7_8 a , q7_8 b )
+{
+	q7_8 sum = (q7_8)( (uint16)a + (uint16)b );
+
+	/* Overflow: both operands have the same sign and the sum has the other sign */
+	if ( ( ( a ^ sum ) & ( b ^ sum ) ) < 0 )
+	{
+		return ( a < 0 ) ? FP_Q8_MIN : FP_Q8_MAX;
+	}
+
+	return sum;
+}
+
+
+
+
+
+/*
+ * @brief Subtracts two Q7.8 numbers with saturation.
+ *
+ * @return (q7_8) a - b, limited to [FP_Q8_MIN , FP_Q8_MAX].
+ */
+q7_8 FP_Q8_Sub( q7_8 a , q7_8 b )
+{
+	q7_8 difference = (q7_8)( (uint16)a - (uint16)b );
+
+	/* Overflow: the operands have different signs and the difference has the sign of b */
+	if ( ( ( a ^ b ) & ( a ^ difference ) ) < 0 )
+	{
+		return ( a < 0 ) ? FP_Q8_MIN : FP_Q8_MAX;
+	}
+
+	return difference;
+}
+
+
+
+
+
+/*
+ * @brief Multiplies two Q7.8 numbers with rounding and saturation.
+ *
+ * @return (q7_8) a * b, limited to [FP_Q8_MIN , FP_Q8_MAX].
+ */
+q7_8 FP_Q8_Mul( q7_8 a , q7_8 b )
+{
+	/* Q14.16 product, rounded to Q7.8 */
+	sint32 product = ( (sint32)a * b + 0x80 ) >> 8;
+
+	if ( product > FP_Q8_MAX )
+	{
+		return FP_Q8_MAX;
+	}
+
+	if ( product < FP_Q8_MIN )
+	{
+		return FP_Q8_MIN;
+	}
+
+	return (q7_8)product;
+}
+
+
+
+
+
+/*
+ * @brief Adds two Q15.16 numbers with saturation.
+ *
+ * @return (q15_16) a + b, limited to [FP_Q16_MIN , FP_Q16_MAX].
+ */
+q15_16 FP_Q16_Add( q15_16 a , q15_16 b )
+{
+	q15_16 sum = (q15_16)( (uint32)a + (uint32)b );
+
+	/* Overflow: both operands have the same sign and the sum has the other sign */
+	if ( ( ( a ^ sum ) & ( b ^ sum ) ) < 0 )
+	{
+		return ( a < 0 ) ? FP_Q16_MIN : FP_Q16_MAX;
+	}
+
+	return sum;
+}
+
+
+
+
+
+/*
+ * @brief Subtracts two Q15.16 numbers with saturation.
+ *
+ * @return (q15_16) a - b, limited to [FP_Q16_MIN , FP_Q16_MAX].
+ */
+q15_16 FP_Q16_Sub( q15_16 a , q15_16 b )
+{
+	q15_16 difference = (q15_16)( (uint32)a - (uint32)b );
+
+	/* Overflow: the operands have different signs and the difference has the sign of b */
+	if ( ( ( a ^ b ) & ( a ^ difference ) ) < 0 )
+	{
+		return ( a < 0 ) ? FP_Q16_MIN : FP_Q16_MAX;
+	}
+
+	return difference;
+}
+
+
+
+
+
+/*
+ * @brief Multiplies two Q15.16 numbers with rounding and saturation.
+ *
+ * The product is made of four 16x16-bit multiplications (no 64-bit math).
+ *
+ * @return (q15_16) a * b, limited to [FP_Q16_MIN , FP_Q16_MAX].
+ */
+q15_16 FP_Q16_Mul( q15_16 a , q15_16 b )
+{
+	bool negative = ( ( a ^ b ) < 0 );
+
+	/* Magnitudes (the magnitude of FP_Q16_MIN fits in uint32) */
+	uint32 ua = ( a < 0 ) ? ( 0UL - (uint32)a ) : (uint32)a;
+	uint32 ub = ( b < 0 ) ? ( 0UL - (uint32)b ) : (uint32)b;
+
+	uint16 ah = (uint16)( ua >> 16 );
+	uint16 al = (uint16)ua;
+	uint16 bh = (uint16)( ub >> 16 );
+	uint16 bl = (uint16)ub;
+
+	/* (ah.al * bh.bl) >> 16 = ( ah * bh << 16 ) + ah * bl + al * bh + ( al * bl >> 16 ) */
+	uint32 high = (uint32)ah * bh;
+	uint32 result;
+	uint32 part;
+
+	/* The integer part alone is out of range */
+	if ( high > 0x8000 )
+	{
+		return negative ? FP_Q16_MIN : FP_Q16_MAX;
+	}
+
+	result = (uint32)ah * bl;
+
+	part = (uint32)al * bh;
+	result += part;
+	bool overflow = ( result < part );
+
+	part = ( (uint32)al * bl + 0x8000 ) >> 16;
+	result += part;
+	overflow |= ( result < part );
+
+	part = high << 16;
+	result += part;
+	overflow |= ( result < part );
+
+	/* The magnitude of the result must fit in the signed range */
+	if ( overflow || ( result > ( negative ? 0x80000000UL : 0x7FFFFFFFUL ) ) )
+	{
+		return negative ? FP_Q16_MIN : FP_Q16_MAX;
+	}
+
+	return negative ? (q15_16)( 0UL - result ) : (q15_16)result;
+}
+
+
+
+
+
+/*
+ * @brief Calculates the reciprocal of a Q15.16 number.
+ *
+ * The number is normalized to [0.5 , 1), then three Newton-Raphson iterations
+ * refine a linear first guess, so no division is used. From 0.5 to 16384.0
+ * a last step corrects the result to the nearest (one 32-bit multiply).
+ *
+ * @param x: The number (0 gives FP_Q16_MAX).
+ *
+ * @return (q15_16) 1 / x, limited to [FP_Q16_MIN , FP_Q16_MAX].
+ */
+q15_16 FP_Q16_Recip( q15_16 x )
+{
+	if ( x == 0 )
+	{
+		return FP_Q16_MAX;
+	}
+
+	bool negative = ( x < 0 );
+	uint32 ux = negative ? ( 0UL - (uint32)x ) : (uint32)x;
+	uint32 magnitude = ux;
+	uint8 shift = 0;
+	uint32 result;
+
+	/* Normalize: d = x * 2^shift (small x) or x / 2^shift (large x) in [0x8000 , 0xFFFF] (0.5 to 1.0 in Q0.16) */
+	bool small = ( ux < 0x8000 );
+
+	while ( ux < 0x8000 )
+	{
+		ux <<= 1;
+		shift++;
+	}
+
+	while ( ux > 0xFFFF )
+	{
+		ux >>= 1;
+		shift++;
+	}
+
+	uint16 d = (uint16)ux;
+
+	/* First guess 48/17 - 32/17 * d (error below 1/17), y is 1/d in Q1.15 */
+	uint16 y = (uint16)( 92521UL - ( ( (uint32)61682 * d ) >> 16 ) );
+
+	/* Newton-Raphson: y = y * ( 2 - d * y ), every iteration squares the error */
+	for ( uint8 i = 0 ; i < 3 ; i++ )
+	{
+		uint16 error = (uint16)( 65536UL - ( ( (uint32)d * y ) >> 16 ) );
+		uint32 next  = ( (uint32)y * error ) >> 15;
+
+		/* 1 / 0.5 = 2.0 is one step above the Q1.15 range */
+		y = ( next > 0xFFFF ) ? 0xFFFF : (uint16)next;
+	}
+
+	/* 1 / x in Q15.16 = y * 2 * 2^shift (small x) or y * 2 / 2^shift (large x) */
+	if ( small )
+	{
+		if ( y > ( 0x7FFFFFFFUL >> ( shift + 1 ) ) )
+		{
+			return negative ? FP_Q16_MIN : FP_Q16_MAX;
+		}
+
+		result = (uint32)y << ( shift + 1 );
+	}
+	else
+	{
+		result = (uint32)y << 1;
+
+		if ( shift > 0 )
+		{
+			result = ( result + ( 1UL << ( shift - 1 ) ) ) >> shift;
+		}
+
+		/* Correct to the nearest: the normalization drops the low bits of x, so the
+		 * result can be a few LSB off. e = 2^32 - result * x is the error in units of x
+		 * (it fits in 32 bits below 16384.0, above it the result is within 1 LSB) */
+		if ( magnitude < 0x40000000UL )
+		{
+			sint32 e = (sint32)( 0UL - result * magnitude );
+
+			while ( e > (sint32)( magnitude >> 1 ) )
+			{
+				result++;
+				e -= (sint32)magnitude;
+			}
+
+			while ( e < -(sint32)( magnitude >> 1 ) )
+			{
+				result--;
+				e += (sint32)magnitude;
+			}
+		}
+	}
+
+	return negative ? (q15_16)( 0UL - result ) : (q15_16)result;
+}
+
+
+
+
+
+/*
+ * @brief Calculates the integer square root of a 32-bit number.
+ *
+ * @return (uint16) The square root rounded down.
+ */
+uint16 FP_Sqrt32( uint32 x )
+{
+	uint32 result = 0;
+	uint32 bit = 1UL << 30;
+
+	/* Start from the highest power of 4 not larger than x */
+	while ( bit > x )
+	{
+		bit >>= 2;
+	}
+
+	/* Find one result bit every step */
+	while ( bit != 0 )
+	{
+		if ( x >= result + bit )
+		{
+			x -= result + bit;
+			result = ( result >> 1 ) + bit;
+		}
+		else
+		{
+			result >>= 1;
+		}
+
+		bit >>= 2;
+	}
+
+	return (uint16)result;
+}
+
+
+
+
+
+/*
+ * @brief Calculates the square root of a Q15.16 number.
+ *
+ * The root of x * 2^16 is needed (48 bits), so the bit by bit method runs in
+ * two passes: the high 16 result bits from x, then the remainder and the
+ * result are shifted by 16 bits to find the low 8 result bits.
+ *
+ * @param x: The number (a negative number gives 0).
+ *
+ * @return (q15_16) The square root rounded to nearest.
+ */
+q15_16 FP_Q16_Sqrt( q15_16 x )
+{
+	if ( x <= 0 )
+	{
+		return 0;
+	}
+
+	uint32 remainder = (uint32)x;
+	uint32 result = 0;
+	uint32 bit = ( remainder & 0xFFF00000UL ) ? ( 1UL << 30 ) : ( 1UL << 18 );
+
+	while ( bit > remainder )
+	{
+		bit >>= 2;
+	}
+
+	for ( uint8 pass = 0 ; pass < 2 ; pass++ )
+	{
+		while ( bit != 0 )
+		{
+			if ( remainder >= result + bit )
+			{
+				remainder -= result + bit;
+				result = ( result >> 1 ) + bit;
+			}
+			else
+			{
+				result >>= 1;
+			}
+
+			bit >>= 2;
+		}
+
+		if ( pass == 0 )
+		{
+			/* Shift by 16 bits. A remainder above 0xFFFF would overflow, then the next bit (0.5)
+			 * is 1: it is added to the result and ( result + 0.5 )^2 = result^2 + result + 0.25
+			 * is taken from the remainder first (0.25 is 0x4000 after the shift) */
+			if ( remainder > 0xFFFF )
+			{
+				remainder -= result;
+				remainder = ( remainder << 16 ) - 0x4000;
+				result = ( result << 16 ) + 0x8000;
+			}
+			else
+			{
+				remainder <<= 16;
+				result <<= 16;
+			}
+
+			bit = 1UL << 14;
+		}
+	}
+
+	/* Round to nearest */
+	if ( remainder > result )
+	{
+		result++;
+	}
+
+	return (q15_16)result;
+}
+
+
+
+
+
+/*
+ * @brief Reads a sine value of the quarter table.
+ *
+ * @param index: Table index from 0 to FP_SIN_TABLE_SIZE (sin(90) is FP_Q16_ONE).
+ *
+ * @return (uint32) sin( index * 90 / FP_SIN_TABLE_SIZE degrees ) in Q15.16.
+ */
+static uint32 FP_SinQuarter( uint8 index )
+{
+	if ( index >= FP_SIN_TABLE_SIZE )
+	{
+		return FP_Q16_ONE;
+	}
+
+	return pgm_read_word( &g_FP_SinTable[ index ] );
+}
+
+
+
+
+
+/*
+ * @brief Calculates the sine of an angle.
+ *
+ * @param angle: The angle, 65536 is a full turn (use FP_ANGLE_FROM_DEG for constants).
+ *
+ * @return (q15_16) The sine, from -FP_Q16_ONE to FP_Q16_ONE.
+ */
+q15_16 FP_Sin( uint16 angle )
+{
+	/* Angle in the quarter, mirrored in the second and fourth quarters */
+	uint16 offset = angle & ( FP_ANGLE_90 - 1 );
+
+	if ( angle & FP_ANGLE_90 )
+	{
+		offset = FP_ANGLE_90 - offset;
+	}
+
+	uint8  index    = (uint8)( offset >> FP_SIN_TABLE_SHIFT );
+	uint16 fraction = offset & ( ( 1 << FP_SIN_TABLE_SHIFT ) - 1 );
+
+	/* Linear interpolation between two table values */
+	uint32 low  = FP_SinQuarter( index );
+	uint32 high = FP_SinQuarter( index + 1 );
+	q15_16 value = (q15_16)( low + ( ( ( high - low ) * fraction + ( 1 << ( FP_SIN_TABLE_SHIFT - 1 ) ) ) >> FP_SIN_TABLE_SHIFT ) );
+
+	/* The sine is negative in the third and fourth quarters */
+	return ( angle & FP_ANGLE_180 ) ? -value : value;
+}
+
+
+
+
+
+/*
+ * @brief Calculates the cosine of an angle.
+ *
+ * @param angle: The angle, 65536 is a full turn (use FP_ANGLE_FROM_DEG for constants).
+ *
+ * @return (q15_16) The cosine, from -FP_Q16_ONE to FP_Q16_ONE.
+ */
+q15_16 FP_Cos( uint16 angle )
+{
+	/* cos(a) = sin(a + 90) */
+	return FP_Sin( angle + FP_ANGLE_90 );
+}
@@ -0,0 +1,156 @@
+/****************************************************************************
+ * @file    FixedPoint.h
+ * @author  Boles Medhat
+ * @brief   Fixed-Point Math Library Header File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file provides integer math for Q7.8 and Q15.16 numbers, to be used
+ * instead of float in the control and conversion code (the AVR has no FPU,
+ * a float multiply or divide is a library call of hundreds of cycles):
+ * - Saturating add, subtract and multiply (a result out of range is the
+ *   largest or smallest value, it never wraps).
+ * - Reciprocal by Newton-Raphson iterations (no division).
+ * - Integer and Q15.16 square root (bit by bit, no division).
+ * - Sine and cosine from a quarter-wave table in flash with linear interpolation.
+ *
+ * @note
+ * - Accuracy (checked against double math on the host by `Sim/FIXEDPOINT_TEST.c`):
+ *   add, subtract and multiply are exact (rounded to nearest),
+ *   FP_Q16_Recip is rounded to nearest from 0.5 to 16384.0, within 1 LSB
+ *   above 16384.0 and has a relative error below 0.01% under 0.5,
+ *   FP_Sqrt32 and FP_Q16_Sqrt are exact (rounded down / to nearest),
+ *   FP_Sin and FP_Cos have an error below 0.0001.
+ * - The PID benchmark (PID_BENCHMARK_ENABLE) reports the cycles of every
+ *   function next to the cycles of the float function it replaces.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef FIXEDPOINT_H_
+#define FIXEDPOINT_H_
+
+#include "FixedPoint_def.h"
+#include <avr/pgmspace.h>
+
+
+
+/*
+ * @brief Adds two Q7.8 numbers with saturation.
+ *
+ * @return (q7_8) a + b, limited to [FP_Q8_MIN , FP_Q8_MAX].
+ */
+q7_8 FP_Q8_Add( q7_8 a , q7_8 b );
+
+
+
+/*
+ * @brief Subtracts two Q7.8 numbers with saturation.
+ *
+ * @return (q7_8) a - b, limited to [FP_Q8_MIN , FP_Q8_MAX].
+ */
+q7_8 FP_Q8_Sub( q7_8 a , q7_8 b );
+
+
+
+/*
+ * @brief Multiplies two Q7.8 numbers with rounding and saturation.
+ *
+ * @return (q7_8) a * b, limited to [FP_Q8_MIN , FP_Q8_MAX].
+ */
+q7_8 FP_Q8_Mul( q7_8 a , q7_8 b );
+
+
+
+/*
+ * @brief Adds two Q15.16 numbers with saturation.
+ *
+ * @return (q15_16) a + b, limited to [FP_Q16_MIN , FP_Q16_MAX].
+ */
+q15_16 FP_Q16_Add( q15_16 a , q15_16 b );
+
+
+
+/*
+ * @brief Subtracts two Q15.16 numbers with saturation.
+ *
+ * @return (q15_16) a - b, limited to [FP_Q16_MIN , FP_Q16_MAX].
+ */
+q15_16 FP_Q16_Sub( q15_16 a , q15_16 b );
+
+
+
+/*
+ * @brief Multiplies two Q15.16 numbers with rounding and saturation.
+ *
+ * The product is made of four 16x16-bit multiplications (no 64-bit math).
+ *
+ * @return (q15_16) a * b, limited to [FP_Q16_MIN , FP_Q16_MAX].
+ */
+q15_16 FP_Q16_Mul( q15_16 a , q15_16 b );
+
+
+
+/*
+ * @brief Calculates the reciprocal of a Q15.16 number.
+ *
+ * The number is normalized to [0.5 , 1), then three Newton-Raphson iterations
+ * refine a linear first guess, so no division is used. From 0.5 to 16384.0
+ * a last step corrects the result to the nearest (one 32-bit multiply).
+ *
+ * @param x: The number (0 gives FP_Q16_MAX).
+ *
+ * @return (q15_16) 1 / x, limited to [FP_Q16_MIN , FP_Q16_MAX].
+ */
+q15_16 FP_Q16_Recip( q15_16 x );
+
+
+
+/*
+ * @brief Calculates the integer square root of a 32-bit number.
+ *
+ * @return (uint16) The square root rounded down.
+ */
+uint16 FP_Sqrt32( uint32 x );
+
+
+
+/*
+ * @brief Calculates the square root of a Q15.16 number.
+ *
+ * @param x: The number (a negative number gives 0).
+ *
+ * @return (q15_16) The square root rounded to nearest.
+ */
+q15_16 FP_Q16_Sqrt( q15_16 x );
+
+
+
+/*
+ * @brief Calculates the sine of an angle.
+ *
+ * @param angle: The angle, 65536 is a full turn (use FP_ANGLE_FROM_DEG for constants).
+ *
+ * @return (q15_16) The sine, from -FP_Q16_ONE to FP_Q16_ONE.
+ */
+q15_16 FP_Sin( uint16 angle );
+
+
+
+/*
+ * @brief Calculates the cosine of an angle.
+ *
+ * @param angle: The angle, 65536 is a full turn (use FP_ANGLE_FROM_DEG for constants).
+ *
+ * @return (q15_16) The cosine, from -FP_Q16_ONE to FP_Q16_ONE.
+ */
+q15_16 FP_Cos( uint16 angle );
+
+
+#endif /* FIXEDPOINT_H_ */
@@ -0,0 +1,88 @@
+/****************************************************************************
+ * @file    FixedPoint_def.h
+ * @author  Boles Medhat
+ * @brief   Fixed-Point Math Definitions Header File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the fixed-point types, their limits and the conversion
+ * macros used by the fixed-point math library.
+ *
+ * - q7_8   : signed 16-bit, 8 integer bits and 8 fraction bits
+ *            (-128.0 to 127.996, step 0.0039).
+ * - q15_16 : signed 32-bit, 16 integer bits and 16 fraction bits
+ *            (-32768.0 to 32767.99998, step 0.0000153).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef FIXEDPOINT_DEF_H_
+#define FIXEDPOINT_DEF_H_
+
+#include "../STD_TYPES.h"
+
+
+/*------------------------------------------   types    -----------------------------------------*/
+
+typedef sint16							q7_8;		/*Q7.8 fixed-point number*/
+typedef sint32							q15_16;		/*Q15.16 fixed-point number*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Q7.8 limits*/
+#define FP_Q8_ONE						((q7_8)0x0100)			/*1.0*/
+#define FP_Q8_MAX						((q7_8)0x7FFF)			/*127.996*/
+#define FP_Q8_MIN						((q7_8)0x8000)			/*-128.0*/
+
+/*Q15.16 limits*/
+#define FP_Q16_ONE						((q15_16)0x00010000)	/*1.0*/
+#define FP_Q16_MAX						((q15_16)0x7FFFFFFF)	/*32767.99998*/
+#define FP_Q16_MIN						((q15_16)0x80000000)	/*-32768.0*/
+
+/*Angles of FP_Sin / FP_Cos (a uint16 angle, 65536 is a full turn)*/
+#define FP_ANGLE_90						0x4000
+#define FP_ANGLE_180					0x8000
+#define FP_ANGLE_270					0xC000
+
+/*Size of the quarter sine table (a power of 2, the angle step is 90 / FP_SIN_TABLE_SIZE degrees)*/
+#define FP_SIN_TABLE_SIZE				64
+#define FP_SIN_TABLE_SHIFT				8			/*Angle bits below the table index (14 - log2(FP_SIN_TABLE_SIZE))*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   macros    ----------------------------------------*/
+
+/*Conversions from constants (the float math is done by the compiler, use them with constants only)*/
+#define FP_Q8_FROM_FLOAT( x )			((q7_8)( (x) * 256.0 + ( (x) >= 0 ? 0.5 : -0.5 ) ))
+#define FP_Q16_FROM_FLOAT( x )			((q15_16)( (x) * 65536.0 + ( (x) >= 0 ? 0.5 : -0.5 ) ))
+#define FP_ANGLE_FROM_DEG( x )			((uint16)( (sint32)( (x) * 65536.0 / 360.0 + 0.5 ) ))
+
+/*Conversions from integers (the integer must be in the range of the type)*/
+#define FP_Q8_FROM_INT( x )				((q7_8)( (sint16)(x) * 256 ))
+#define FP_Q16_FROM_INT( x )			((q15_16)( (sint32)(x) * 65536 ))
+
+/*Conversions to integers (rounded down)*/
+#define FP_Q8_TO_INT( x )				((sint8)( (x) >> 8 ))
+#define FP_Q16_TO_INT( x )				((sint16)( (x) >> 16 ))
+
+/*Conversions between the types (Q15.16 to Q7.8 must be in the Q7.8 range)*/
+#define FP_Q8_TO_Q16( x )				((q15_16)(x) * 256)
+#define FP_Q16_TO_Q8( x )				((q7_8)( (x) >> 8 ))
+
+/*Conversions to float (for printing and tests)*/
+#define FP_Q8_TO_FLOAT( x )				( (float32)(x) / 256.0f )
+#define FP_Q16_TO_FLOAT( x )			( (float32)(x) / 65536.0f )
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* FIXEDPOINT_DEF_H_ */
@@ -0,0 +1,232 @@
+/****************************************************************************
+ * @file    METRICS.c
+ * @author  Boles Medhat
+ * @brief   Metrics Library Source File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file implements the log2 histograms and the export of the metrics.
+ * The counters are updated directly by the macros of `METRICS.h`.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include "METRICS.h"
+
+
+#if METRICS_STATUS == METRICS_ENABLE
+
+/* Counters */
+volatile uint16 g_METRICS_Counters16[ METRICS_COUNTERS16 ];
+volatile uint32 g_METRICS_Counters32[ METRICS_COUNTERS32 ];
+
+/* Histogram buckets */
+static volatile uint16 g_METRICS_Buckets[ METRICS_HISTOGRAMS ][ METRICS_BUCKETS ];
+
+/* Names line */
+static const char g_METRICS_Names[] = METRICS_NAMES_PREFIX METRICS_NAMES "\n";
+
+
+
+
+
+/*
+ * @brief Adds a value to the log2 bucket of a histogram.
+ *
+ * The bucket is the number of bits of the value (0 -> 0, 1 -> 1, 2..3 -> 2,
+ * 4..7 -> 3, ...), larger values are counted in the last bucket, and a full
+ * bucket stops at METRICS_BUCKET_MAX.
+ *
+ * @param id:    Id of the histogram.
+ * @param value: Value to add (for example a time in timer ticks).
+ */
+void METRICS_HistAdd( uint8 id , uint16 value )
+{
+	uint8 bucket = 0;
+	uint8 byte   = (uint8)value;
+
+	/* Count the bits of the high byte if it is used (at most 8 shifts) */
+	if ( value > 0xFF )
+	{
+		bucket = 8;
+		byte   = (uint8)( value >> 8 );
+	}
+
+	while ( byte != 0 )
+	{
+		bucket++;
+		byte >>= 1;
+	}
+
+	/* The last bucket also counts the larger values */
+	if ( bucket >= METRICS_BUCKETS )
+	{
+		bucket = METRICS_BUCKETS - 1;
+	}
+
+	if ( g_METRICS_Buckets[id][bucket] != METRICS_BUCKET_MAX )
+	{
+		g_METRICS_Buckets[id][bucket]++;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Sets all the counters and histograms to 0.
+ */
+void METRICS_Reset( void )
+{
+	/* Save global interrupt flag and disable it, so no metric is changed while it is cleared */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	for ( uint8 i = 0 ; i < METRICS_COUNTERS16 ; i++ )
+	{
+		g_METRICS_Counters16[i] = 0;
+	}
+
+	for ( uint8 i = 0 ; i < METRICS_COUNTERS32 ; i++ )
+	{
+		g_METRICS_Counters32[i] = 0;
+	}
+
+	for ( uint8 i = 0 ; i < METRICS_HISTOGRAMS ; i++ )
+	{
+		for ( uint8 j = 0 ; j < METRICS_BUCKETS ; j++ )
+		{
+			g_METRICS_Buckets[i][j] = 0;
+		}
+	}
+
+	/* Restore global interrupt flag */
+	SREG = sreg;
+}
+
+
+
+
+
+/*
+ * @brief Sends the bytes of a value (little endian) and adds them to the checksum.
+ *
+ * @param write_byte: Function that sends one byte.
+ * @param value:      Value to send.
+ * @param size:       Number of bytes of the value (2 or 4).
+ * @param checksum:   Pointer to the checksum of the frame.
+ */
+static void METRICS_SendValue( void (*write_byte)(uint8) , uint32 value , uint8 size , uint8 * checksum )
+{
+	for ( uint8 i = 0 ; i < size ; i++ )
+	{
+		uint8 byte = (uint8)value;
+
+		write_byte( byte );
+		*checksum ^= byte;
+		value >>= 8;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Sends all the metrics as one binary frame.
+ *
+ * Every value is copied with the interrupts disabled, so a value updated by
+ * an interrupt is never sent half changed.
+ *
+ * @param write_byte: Function that sends one byte (for example UART_WriteByte).
+ */
+void METRICS_Export( void (*write_byte)(uint8) )
+{
+	uint8 checksum = 0;
+	uint8 sreg;
+	uint32 value;
+
+	if ( write_byte == NULL )
+	{
+		return;
+	}
+
+	/* Header */
+	write_byte( METRICS_SYNC );
+	METRICS_SendValue( write_byte , METRICS_COUNTERS16 , 1 , &checksum );
+	METRICS_SendValue( write_byte , METRICS_COUNTERS32 , 1 , &checksum );
+	METRICS_SendValue( write_byte , METRICS_HISTOGRAMS , 1 , &checksum );
+	METRICS_SendValue( write_byte , METRICS_BUCKETS    , 1 , &checksum );
+
+	/* 16-bit counters */
+	for ( uint8 i = 0 ; i < METRICS_COUNTERS16 ; i++ )
+	{
+		sreg = SREG;
+		CLR_BIT( SREG , I );
+		value = g_METRICS_Counters16[i];
+		SREG = sreg;
+
+		METRICS_SendValue( write_byte , value , 2 , &checksum );
+	}
+
+	/* 32-bit counters */
+	for ( uint8 i = 0 ; i < METRICS_COUNTERS32 ; i++ )
+	{
+		sreg = SREG;
+		CLR_BIT( SREG , I );
+		value = g_METRICS_Counters32[i];
+		SREG = sreg;
+
+		METRICS_SendValue( write_byte , value , 4 , &checksum );
+	}
+
+	/* Histograms */
+	for ( uint8 i = 0 ; i < METRICS_HISTOGRAMS ; i++ )
+	{
+		for ( uint8 j = 0 ; j < METRICS_BUCKETS ; j++ )
+		{
+			sreg = SREG;
+			CLR_BIT( SREG , I );
+			value = g_METRICS_Buckets[i][j];
+			SREG = sreg;
+
+			METRICS_SendValue( write_byte , value , 2 , &checksum );
+		}
+	}
+
+	write_byte( checksum );
+}
+
+
+
+
+
+/*
+ * @brief Sends the names of the metrics as one text line.
+ *
+ * Sends "METRICS,<name>,<name>,...\n" in the export order, so a host tool
+ * can print every value of the binary frame with its name.
+ *
+ * @param write_byte: Function that sends one byte (for example UART_WriteByte).
+ */
+void METRICS_ExportNames( void (*write_byte)(uint8) )
+{
+	if ( write_byte == NULL )
+	{
+		return;
+	}
+
+	for ( uint16 i = 0 ; g_METRICS_Names[i] != '\0' ; i++ )
+	{
+		write_byte( g_METRICS_Names[i] );
+	}
+}
+
+#endif
@@ -0,0 +1,114 @@
+/****************************************************************************
+ * @file    METRICS.h
+ * @author  Boles Medhat
+ * @brief   Metrics Library Header File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file provides counters and latency histograms that any driver or
+ * application can update in a few cycles:
+ * - METRICS_INC16 / METRICS_INC32 / METRICS_ADD32: one RAM increment or add.
+ * - METRICS_HIST: adds a value to the log2 bucket of a histogram, so a
+ *   histogram of 16-bit values needs only METRICS_BUCKETS counters.
+ *
+ * The metrics are sent as one binary frame (METRICS_Export) and their names
+ * as one text line (METRICS_ExportNames), see `METRICS_def.h` for the format.
+ * The output function is a parameter, so the library does not depend on a
+ * communication driver.
+ *
+ * @note
+ * - The macros are not atomic, update every metric from one context only
+ *   (the main loop or one interrupt).
+ * - With METRICS_STATUS = METRICS_DISABLE the macros do nothing and the
+ *   functions are not compiled.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef METRICS_H_
+#define METRICS_H_
+
+#include "../BIT_MATH.h"
+#include "METRICS_config.h"
+
+
+#if METRICS_STATUS == METRICS_ENABLE
+
+/* Counters (used by the macros) */
+extern volatile uint16 g_METRICS_Counters16[ METRICS_COUNTERS16 ];
+extern volatile uint32 g_METRICS_Counters32[ METRICS_COUNTERS32 ];
+
+/* Increments a 16-bit counter */
+#define METRICS_INC16( id )					( g_METRICS_Counters16[ id ]++ )
+
+/* Increments a 32-bit counter */
+#define METRICS_INC32( id )					( g_METRICS_Counters32[ id ]++ )
+
+/* Adds a number to a 32-bit counter */
+#define METRICS_ADD32( id , number )		( g_METRICS_Counters32[ id ] += (number) )
+
+/* Adds a value to a histogram */
+#define METRICS_HIST( id , value )			METRICS_HistAdd( id , value )
+
+#else
+
+#define METRICS_INC16( id )					((void)0)
+#define METRICS_INC32( id )					((void)0)
+#define METRICS_ADD32( id , number )		((void)0)
+#define METRICS_HIST( id , value )			((void)0)
+
+#endif
+
+
+
+/*
+ * @brief Adds a value to the log2 bucket of a histogram.
+ *
+ * The bucket is the number of bits of the value (0 -> 0, 1 -> 1, 2..3 -> 2,
+ * 4..7 -> 3, ...), larger values are counted in the last bucket, and a full
+ * bucket stops at METRICS_BUCKET_MAX.
+ *
+ * @param id:    Id of the histogram.
+ * @param value: Value to add (for example a time in timer ticks).
+ */
+void METRICS_HistAdd( uint8 id , uint16 value );
+
+
+
+/*
+ * @brief Sets all the counters and histograms to 0.
+ */
+void METRICS_Reset( void );
+
+
+
+/*
+ * @brief Sends all the metrics as one binary frame.
+ *
+ * Every value is copied with the interrupts disabled, so a value updated by
+ * an interrupt is never sent half changed.
+ *
+ * @param write_byte: Function that sends one byte (for example UART_WriteByte).
+ */
+void METRICS_Export( void (*write_byte)(uint8) );
+
+
+
+/*
+ * @brief Sends the names of the metrics as one text line.
+ *
+ * Sends "METRICS,<name>,<name>,...\n" in the export order, so a host tool
+ * can print every value of the binary frame with its name.
+ *
+ * @param write_byte: Function that sends one byte (for example UART_WriteByte).
+ */
+void METRICS_ExportNames( void (*write_byte)(uint8) );
+
+
+#endif /* METRICS_H_ */
@@ -0,0 +1,83 @@
+/****************************************************************************
+ * @file    METRICS_config.h
+ * @author  Boles Medhat
+ * @brief   Metrics Configuration Header File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @note
+ * - The ids are used by the drivers, keep every id that a driver uses
+ *   (the ids are not needed when METRICS_STATUS is METRICS_DISABLE).
+ * - METRICS_NAMES must list the names in the export order:
+ *   16-bit counters, 32-bit counters, then histograms.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef METRICS_CONFIG_H_
+#define METRICS_CONFIG_H_
+
+#include "METRICS_def.h"
+
+
+/*Set the Metrics Status
+ * choose between:
+ * 1. METRICS_DISABLE
+ * 2. METRICS_ENABLE
+ */
+#define METRICS_STATUS						METRICS_ENABLE
+
+
+/*Set the 16-bit counters (they wrap around after 65535)*/
+#define METRICS_COUNTERS16					6
+#define METRIC_UART_RX_ERRORS				0			/*Received bytes with a frame, overrun or parity error*/
+#define METRIC_UART_TIMEOUTS				1			/*UART reads and writes that ended by UART_COUNTOUT*/
+#define METRIC_ADC_TIMEOUTS					2			/*ADC reads that ended by ADC_COUNTOUT (read as 0)*/
+#define METRIC_PARAM_DROPPED				3			/*Parameter request bytes ignored while a request waits*/
+#define METRIC_PARAM_BAD_FRAMES				4			/*Parameter requests with a wrong checksum*/
+#define METRIC_CONTROL_OVERRUNS				5			/*Control ticks that did not end before the next timer overflow*/
+
+
+/*Set the 32-bit counters*/
+#define METRICS_COUNTERS32					2
+#define METRIC_CONTROL_TICKS				0			/*Control ticks (PID updates)*/
+#define METRIC_EEPROM_WRITES				1			/*EEPROM bytes written*/
+
+
+/*Set the histograms (bucket n counts the values from 2^(n-1) to 2^n - 1, bucket 0 counts 0)*/
+#define METRICS_HISTOGRAMS					2
+#define METRIC_HIST_CONTROL_TICKS			0			/*Timer2 ticks of the control tick*/
+#define METRIC_HIST_ADC_WAIT				1			/*Wait loops of the ADC conversion*/
+
+
+/*Set the number of buckets of every histogram (from 2 to 17)
+ * the last bucket also counts all the larger values
+ */
+#define METRICS_BUCKETS						12
+
+
+/*Set the names of the metrics (comma separated, in the export order)*/
+#define METRICS_NAMES						"uart_rx_errors,uart_timeouts,adc_timeouts,param_dropped,param_bad_frames,control_overruns," \
+											"control_ticks,eeprom_writes," \
+											"control_tick_time,adc_wait"
+
+
+#if ( METRICS_STATUS != METRICS_DISABLE ) && ( METRICS_STATUS != METRICS_ENABLE )
+	#error "Wrong \"METRICS_STATUS\" configuration option"
+#endif
+
+#if ( METRICS_BUCKETS < 2 ) || ( METRICS_BUCKETS > 17 )
+	#error "METRICS_BUCKETS must be from 2 to 17"
+#endif
+
+#if ( METRICS_COUNTERS16 < 1 ) || ( METRICS_COUNTERS16 > 255 ) || ( METRICS_COUNTERS32 < 1 ) || ( METRICS_COUNTERS32 > 255 ) || ( METRICS_HISTOGRAMS < 1 ) || ( METRICS_HISTOGRAMS > 255 )
+	#error "The number of metrics of every kind must be from 1 to 255"
+#endif
+
+
+#endif /* METRICS_CONFIG_H_ */
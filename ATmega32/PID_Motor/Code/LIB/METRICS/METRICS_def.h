@@ -0,0 +1,63 @@
+/****************************************************************************
+ * @file    METRICS_def.h
+ * @author  Boles Medhat
+ * @brief   Metrics Definitions Header File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the macro definitions and constants used by the metrics
+ * library (counters, log2 histograms and the binary export frame).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef METRICS_DEF_H_
+#define METRICS_DEF_H_
+
+#include "../STD_TYPES.h"
+
+
+/*------------------------------------------   registers    -------------------------------------*/
+
+#define SREG								*((volatile uint8 *)0x5F)	/*status register*/
+
+/*SREG Register*/
+#define	I									7	/*Global Interrupt Enable*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   modes    -----------------------------------------*/
+
+/*Metrics Status*/
+#define METRICS_DISABLE						0			/*The METRICS_ macros do nothing (no RAM and no cycles)*/
+#define METRICS_ENABLE						1			/*The METRICS_ macros update the counters and histograms*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Export frame:
+ * METRICS_SYNC , counters16 , counters32 , histograms , buckets ,
+ * 16-bit counters , 32-bit counters , histogram buckets (16-bit each) , checksum
+ * all values are little endian, the checksum is the XOR of all the bytes after METRICS_SYNC
+ */
+#define METRICS_SYNC						0xA6		/*First byte of the export frame (not an ASCII character)*/
+#define METRICS_NAMES_PREFIX				"METRICS,"	/*Start of the names line*/
+
+/*Largest value of a histogram bucket (the buckets stop counting, they do not wrap)*/
+#define METRICS_BUCKET_MAX					0xFFFF
+
+/*Number of bytes of the export frame*/
+#define METRICS_FRAME_SIZE					( 6 + ( METRICS_COUNTERS16 * 2 ) + ( METRICS_COUNTERS32 * 4 ) + ( METRICS_HISTOGRAMS * METRICS_BUCKETS * 2 ) )
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* METRICS_DEF_H_ */
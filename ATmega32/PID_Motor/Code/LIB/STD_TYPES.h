@@ -47,8 +47,14 @@ typedef unsigned char			uint8;			/* Unsigned 8-bit  integer:  0 to 255 */
 typedef signed char				sint8;			/* Signed 	8-bit  integer:	 -128 to 127 */
 typedef unsigned short			uint16;			/* Unsigned 16-bit integer:	 0 to 65535 */
 typedef signed short			sint16;			/* Signed 	16-bit integer:	 -32768 to 32767 */
+#if ( __SIZEOF_LONG__ == 4 )
 typedef unsigned long			uint32;			/* Unsigned 32-bit integer:	 0 to 4294967295 */
 typedef signed long				sint32;			/* Signed 	32-bit integer:	 -2147483648 to 2147483647 */
+#else
+/* 64-bit host (the tests in Sim/): long is 64-bit there */
+typedef unsigned int			uint32;			/* Unsigned 32-bit integer:	 0 to 4294967295 */
+typedef signed int				sint32;			/* Signed 	32-bit integer:	 -2147483648 to 2147483647 */
+#endif
 typedef unsigned long long		uint64;			/* Unsigned 64-bit integer:	 0 to 18446744073709551615 */
 typedef signed long long		sint64;			/* Signed 	64-bit integer:	 -9223372036854775808 to 9223372036854775807 */
 
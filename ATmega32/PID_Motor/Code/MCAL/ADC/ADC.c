@@ -24,6 +24,7 @@
 
 
 #include "ADC.h"
+#include "../../LIB/METRICS/METRICS.h"
 
 /* Pointer to the callback function for the ADC ISR */
 void (*g_ADC_CallBack)(uint16) = NULL;
@@ -198,6 +199,9 @@ uint16 ADC_OnlyRead( void )
 			ADC_counter++;
 		}
 
+		/* Count the waiting loops of the conversion */
+		METRICS_HIST( METRIC_HIST_ADC_WAIT , ADC_counter );
+
 
 		/* Check that the conversion is end correctly */
 		if(ADC_counter < ADC_COUNTOUT)
@@ -220,6 +224,7 @@ uint16 ADC_OnlyRead( void )
 		else
 		{
 			/* the conversion has not end correctly */
+			METRICS_INC16( METRIC_ADC_TIMEOUTS );
 
 			/* Return 0 */
 			return 0;
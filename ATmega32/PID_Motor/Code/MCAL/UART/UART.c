@@ -28,6 +28,7 @@
 
 
 #include "UART.h"
+#include "../../LIB/METRICS/METRICS.h"
 
 /* Pointer to hold the address of the transmit array */
 uint8 * g_UART_TX_Array = NULL;
@@ -395,6 +396,10 @@ void UART_WriteByte( uint8 byte )
 			/* Send the Byte */
 			UDR = byte ;
 		}
+		else
+		{
+			METRICS_INC16( METRIC_UART_TIMEOUTS );
+		}
 
 	#else
 		/* Waiting until the Sending is Complete */
@@ -535,11 +540,19 @@ uint8 UART_ReadByte( void )
 		/* Check that the Reading is Complete Correctly */
 		if (UART_counter < UART_COUNTOUT)
 		{
+			/* The error flags are valid until UDR is read */
+			if ( UART_CheckErrors() )
+			{
+				METRICS_INC16( METRIC_UART_RX_ERRORS );
+			}
+
 			/* Read the Byte */
 			return UDR;
 		}
 		else
 		{
+			METRICS_INC16( METRIC_UART_TIMEOUTS );
+
 			/* Read Timeout value */
 			return UART_TIMEOUT_BYTE;
 		}
@@ -549,6 +562,12 @@ uint8 UART_ReadByte( void )
 		/* Waiting until the Reading is Complete */
 		while (IS_BIT_CLR( UCSRA , RXC ));
 
+		/* The error flags are valid until UDR is read */
+		if ( UART_CheckErrors() )
+		{
+			METRICS_INC16( METRIC_UART_RX_ERRORS );
+		}
+
 		/* Send the Byte */
 		return UDR;
 
@@ -881,6 +900,12 @@ void __vector_13 (void)
 
 		uint8 byte;
 
+		/* The error flags are valid until UDR is read */
+		if ( UART_CheckErrors() )
+		{
+			METRICS_INC16( METRIC_UART_RX_ERRORS );
+		}
+
 		/* Receive next Byte */
 		byte = UDR ;
 		g_UART_RX_Array[ g_UART_RX_Index ] = byte;
@@ -0,0 +1,238 @@
+/****************************************************************************
+ * @file    ESTIMATOR_SIM.c
+ * @author  Boles Medhat
+ * @brief   Alpha-Beta Estimator Host Simulation Source File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file runs `Code/LIB/ESTIMATOR` (with `Code/LIB/FixedPoint`) on Linux on
+ * a simulated feedback potentiometer and compares the velocity of the three
+ * derivatives of the README table ("Filtered Derivative"):
+ * - the difference of the last two raw samples (PID_DERIVATIVE_RAW),
+ * - the same difference through a low-pass filter (SIM_LOWPASS_GAIN),
+ * - the velocity of the alpha-beta estimator (PID_DERIVATIVE_ESTIMATOR) at
+ *   the tracking index of APP_config.h.
+ *
+ * The position is 512 + 300 sin( 0.3 Hz ) + 80 sin( 1.1 Hz ) ADC counts,
+ * sampled every 20 ms with 2 counts of Gaussian noise, rounded and limited to
+ * 10 bits. Every derivative is compared with the true velocity delayed by
+ * its lag (the delay from 0 to SIM_MAX_LAG samples with the smallest error),
+ * so a filter is not rated worse only because it is late.
+ *
+ * @note
+ * - Build and run (from the PID_Motor folder, `Sim/avr/pgmspace.h` replaces
+ *   the AVR header):
+ *       gcc -std=gnu99 -O2 -Wall -I Sim -o estimator_sim Sim/ESTIMATOR_SIM.c Code/LIB/ESTIMATOR/ESTIMATOR.c Code/LIB/FixedPoint/FixedPoint.c -lm
+ *       ./estimator_sim [tracking index] [noise counts] [low-pass gain]
+ *   The exit code is 1 if the estimator is not better than both raw derivatives.
+ * - The random numbers are a fixed xorshift sequence, so every run and every
+ *   host prints the same numbers.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../Code/LIB/ESTIMATOR/ESTIMATOR.h"
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+#define SIM_SAMPLES					20000			/*Simulated samples (400 s)*/
+#define SIM_SETTLE					200				/*First samples not counted (the filters start)*/
+#define SIM_SAMPLE_S				0.02			/*Sampling interval (SAMPLE_MS of APP_config.h)*/
+#define SIM_MAX_LAG					40				/*Longest lag searched (samples)*/
+
+/*Simulated potentiometer (ADC counts)*/
+#define SIM_CENTER					512.0
+#define SIM_SLOW_AMPLITUDE			300.0
+#define SIM_SLOW_HZ					0.3
+#define SIM_FAST_AMPLITUDE			80.0
+#define SIM_FAST_HZ					1.1
+#define SIM_ADC_MAX					1023
+
+/*Defaults of the command line*/
+#define SIM_TRACKING_INDEX			0.2				/*ESTIMATOR_TRACKING_INDEX of APP_config.h*/
+#define SIM_NOISE					2.0				/*Standard deviation of the ADC noise (counts)*/
+#define SIM_LOWPASS_GAIN			0.3				/*Part of the new difference added to the low-pass output*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*-------------------------------------------   state   -----------------------------------------*/
+
+static uint64_t random_state = 0x9E3779B97F4A7C15ULL;
+
+/*True velocity and the three derivatives (counts per sample)*/
+static double true_velocity[ SIM_SAMPLES ];
+static double raw_velocity[ SIM_SAMPLES ];
+static double lowpass_velocity[ SIM_SAMPLES ];
+static double estimator_velocity[ SIM_SAMPLES ];
+/*_______________________________________________________________________________________________*/
+
+
+
+
+
+/*
+ * @brief Get a random 32-bit number (xorshift64*).
+ */
+static uint32_t Sim_Random( void )
+{
+	random_state ^= random_state >> 12;
+	random_state ^= random_state << 25;
+	random_state ^= random_state >> 27;
+
+	return (uint32_t)( ( random_state * 0x2545F4914F6CDD1DULL ) >> 32 );
+}
+
+
+
+
+
+/*
+ * @brief Get a Gaussian random number with a standard deviation of 1 (Box-Muller).
+ */
+static double Sim_Gauss( void )
+{
+	double u1 = ( Sim_Random() + 1.0 ) / 4294967297.0;
+	double u2 = ( Sim_Random() + 1.0 ) / 4294967297.0;
+
+	return sqrt( -2.0 * log( u1 ) ) * cos( 2.0 * M_PI * u2 );
+}
+
+
+
+
+
+/*
+ * @brief RMS error of a derivative against the true velocity delayed by a lag.
+ *
+ * @param velocity: Derivative of every sample.
+ * @param lag:      Delay of the true velocity (samples).
+ */
+static double Sim_RmsError( const double * velocity , int lag )
+{
+	double sum = 0;
+	int count = 0;
+
+	for ( int sample = SIM_SETTLE ; sample < SIM_SAMPLES ; sample++ )
+	{
+		double error = velocity[ sample ] - true_velocity[ sample - lag ];
+
+		sum += error * error;
+		count++;
+	}
+
+	return sqrt( sum / count );
+}
+
+
+
+
+
+/*
+ * @brief Find the lag of a derivative (the delay with the smallest RMS error) and print its error.
+ *
+ * @param name:     Name of the derivative.
+ * @param velocity: Derivative of every sample.
+ *
+ * @return (double) RMS error at the lag.
+ */
+static double Sim_Report( const char * name , const double * velocity )
+{
+	int best_lag = 0;
+	double best_error = Sim_RmsError( velocity , 0 );
+
+	for ( int lag = 1 ; lag <= SIM_MAX_LAG ; lag++ )
+	{
+		double error = Sim_RmsError( velocity , lag );
+
+		if ( error < best_error )
+		{
+			best_error = error;
+			best_lag = lag;
+		}
+	}
+
+	printf( "%-36s %3d samples  %6.2f\n" , name , best_lag , best_error );
+
+	return best_error;
+}
+
+
+
+
+
+int main( int argc , char * argv[] )
+{
+	double tracking_index = ( argc > 1 ) ? atof( argv[ 1 ] ) : SIM_TRACKING_INDEX;
+	double noise          = ( argc > 2 ) ? atof( argv[ 2 ] ) : SIM_NOISE;
+	double lowpass_gain   = ( argc > 3 ) ? atof( argv[ 3 ] ) : SIM_LOWPASS_GAIN;
+
+	q15_16 alpha , beta;
+	Estimator estimator;
+
+	ESTIMATOR_GainsFromTrackingIndex( FP_Q16_FROM_FLOAT( tracking_index ) , &alpha , &beta );
+	ESTIMATOR_Init( &estimator , alpha , beta , (sint16)SIM_CENTER );
+
+	double last_measurement = SIM_CENTER;
+	double lowpass = 0;
+
+	for ( int sample = 0 ; sample < SIM_SAMPLES ; sample++ )
+	{
+		double t = sample * SIM_SAMPLE_S;
+		double slow = 2.0 * M_PI * SIM_SLOW_HZ;
+		double fast = 2.0 * M_PI * SIM_FAST_HZ;
+
+		double position = SIM_CENTER + SIM_SLOW_AMPLITUDE * sin( slow * t ) + SIM_FAST_AMPLITUDE * sin( fast * t );
+
+		true_velocity[ sample ] = ( SIM_SLOW_AMPLITUDE * slow * cos( slow * t ) + SIM_FAST_AMPLITUDE * fast * cos( fast * t ) ) * SIM_SAMPLE_S;
+
+		/* 10-bit ADC sample with noise */
+		int measurement = (int)floor( position + noise * Sim_Gauss() + 0.5 );
+
+		if ( measurement < 0 )
+		{
+			measurement = 0;
+		}
+		else if ( measurement > SIM_ADC_MAX )
+		{
+			measurement = SIM_ADC_MAX;
+		}
+
+		raw_velocity[ sample ] = measurement - last_measurement;
+		last_measurement = measurement;
+
+		lowpass += lowpass_gain * ( raw_velocity[ sample ] - lowpass );
+		lowpass_velocity[ sample ] = lowpass;
+
+		ESTIMATOR_Update( &estimator , (sint16)measurement );
+		estimator_velocity[ sample ] = FP_Q16_TO_FLOAT( ESTIMATOR_GetVelocity( &estimator ) );
+	}
+
+	printf( "tracking index %.3f: alpha %.4f beta %.4f, noise %.1f counts\n\n" ,
+			tracking_index , FP_Q16_TO_FLOAT( alpha ) , FP_Q16_TO_FLOAT( beta ) , noise );
+	printf( "%-36s %11s  %6s\n" , "Derivative" , "Lag" , "RMS error (counts/sample)" );
+
+	char lowpass_name[ 40 ];
+	char estimator_name[ 40 ];
+
+	snprintf( lowpass_name , sizeof( lowpass_name ) , "Raw difference + low-pass (%.2g)" , lowpass_gain );
+	snprintf( estimator_name , sizeof( estimator_name ) , "Alpha-beta, tracking index %.2g" , tracking_index );
+
+	double raw_error       = Sim_Report( "Raw difference" , raw_velocity );
+	double lowpass_error   = Sim_Report( lowpass_name , lowpass_velocity );
+	double estimator_error = Sim_Report( estimator_name , estimator_velocity );
+
+	return ( estimator_error < raw_error && estimator_error < lowpass_error ) ? 0 : 1;
+}
@@ -0,0 +1,444 @@
+/****************************************************************************
+ * @file    FIXEDPOINT_TEST.c
+ * @author  Boles Medhat
+ * @brief   Fixed-Point Math Library Host Test Source File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file checks `Code/LIB/FixedPoint` on Linux against 64-bit integer and
+ * double math, and fails if an error is above the accuracy written in
+ * `FixedPoint.h`:
+ * - Q7.8 add, subtract and multiply: every pair of numbers (2^32 pairs).
+ * - Q15.16 add, subtract and multiply: the edge values against each other
+ *   and random pairs of every magnitude.
+ * - FP_Q16_Recip: every x in [0.5 , 2) and a dense sweep of the whole range,
+ *   the error in LSB and the relative error by range.
+ * - FP_Sqrt32 and FP_Q16_Sqrt: every x up to 2^24, the squares and their
+ *   neighbors, and random numbers.
+ * - FP_Sin and FP_Cos: every angle.
+ *
+ * @note
+ * - Build and run (from the PID_Motor folder, `Sim/avr/pgmspace.h` replaces
+ *   the AVR header):
+ *       gcc -std=gnu99 -O2 -Wall -I Sim -o fixedpoint_test Sim/FIXEDPOINT_TEST.c Code/LIB/FixedPoint/FixedPoint.c -lm
+ *       ./fixedpoint_test
+ *   The exit code is 1 if a check fails.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "../Code/LIB/FixedPoint/FixedPoint.h"
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+#define TEST_RANDOM_PAIRS			20000000UL		/*Random Q15.16 pairs of every operation*/
+#define TEST_SWEEP_STEP				37				/*Step of the reciprocal sweep over the whole range*/
+#define TEST_SQRT_RANDOM			20000000UL		/*Random square root inputs*/
+
+/*Accuracy of FixedPoint.h*/
+#define TEST_RECIP_LSB				0.5				/*Error of FP_Q16_Recip for 0.5 <= |x| < 16384 (LSB)*/
+#define TEST_RECIP_LSB_LARGE		1.0				/*Error of FP_Q16_Recip for |x| >= 16384 (LSB)*/
+#define TEST_RECIP_RELATIVE			0.0001			/*Relative error of FP_Q16_Recip for |x| < 0.5*/
+#define TEST_SIN_ERROR				0.0001			/*Error of FP_Sin and FP_Cos*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*-------------------------------------------   state   -----------------------------------------*/
+
+static int failed_checks;
+static uint64_t random_state = 0x9E3779B97F4A7C15ULL;
+/*_______________________________________________________________________________________________*/
+
+
+
+
+
+/*
+ * @brief Get a random 32-bit number (xorshift64*).
+ */
+static uint32_t Test_Random( void )
+{
+	random_state ^= random_state >> 12;
+	random_state ^= random_state << 25;
+	random_state ^= random_state >> 27;
+
+	return (uint32_t)( ( random_state * 0x2545F4914F6CDD1DULL ) >> 32 );
+}
+
+
+
+
+
+/*
+ * @brief Get a random Q15.16 number of a random magnitude (1 to 32 significant bits).
+ */
+static q15_16 Test_RandomQ16( void )
+{
+	uint32_t bits = Test_Random() % 32 + 1;
+	uint32_t value = Test_Random() >> ( 32 - bits );
+
+	return ( Test_Random() & 1 ) ? -(int32_t)( value >> 1 ) : (int32_t)( value >> 1 );
+}
+
+
+
+
+
+/*
+ * @brief Print the result of a check and count it if it failed.
+ *
+ * @param name:   Name of the check.
+ * @param passed: Result of the check.
+ * @param detail: Measured error or the first wrong input.
+ */
+static void Test_Report( const char * name , bool passed , const char * detail )
+{
+	printf( "%-34s %-6s %s\n" , name , passed ? "ok" : "FAILED" , detail );
+
+	failed_checks += !passed;
+}
+
+
+
+
+
+/*
+ * @brief Limit a value to a range.
+ */
+static int64_t Test_Limit( int64_t value , int64_t min , int64_t max )
+{
+	return ( value < min ) ? min : ( ( value > max ) ? max : value );
+}
+
+
+
+
+
+/*
+ * @brief Round a quotient of the exact product to nearest, half away from zero (as FP_Q16_Mul).
+ */
+static int64_t Test_RoundShift( int64_t product , int shift )
+{
+	int64_t half = (int64_t)1 << ( shift - 1 );
+
+	return ( product >= 0 ) ? ( product + half ) >> shift : -( ( -product + half ) >> shift );
+}
+
+
+
+
+
+/*
+ * @brief Check the Q7.8 functions with every pair of numbers.
+ */
+static void Test_Q8( void )
+{
+	char detail[ 96 ] = "all 2^32 pairs";
+	bool add_ok = true , sub_ok = true , mul_ok = true;
+
+	for ( int32_t a = FP_Q8_MIN ; a <= FP_Q8_MAX ; a++ )
+	{
+		for ( int32_t b = FP_Q8_MIN ; b <= FP_Q8_MAX ; b++ )
+		{
+			/* Multiply: rounded half up ( + 0x80 ) >> 8 */
+			int64_t product = Test_Limit( ( (int64_t)a * b + 0x80 ) >> 8 , FP_Q8_MIN , FP_Q8_MAX );
+
+			add_ok &= ( FP_Q8_Add( a , b ) == Test_Limit( a + b , FP_Q8_MIN , FP_Q8_MAX ) );
+			sub_ok &= ( FP_Q8_Sub( a , b ) == Test_Limit( a - b , FP_Q8_MIN , FP_Q8_MAX ) );
+			mul_ok &= ( FP_Q8_Mul( a , b ) == product );
+		}
+	}
+
+	Test_Report( "FP_Q8_Add exact" , add_ok , detail );
+	Test_Report( "FP_Q8_Sub exact" , sub_ok , detail );
+	Test_Report( "FP_Q8_Mul rounded" , mul_ok , detail );
+}
+
+
+
+
+
+/*
+ * @brief Check one Q15.16 pair and keep the first wrong one.
+ */
+static void Test_Q16Pair( q15_16 a , q15_16 b , bool * add_ok , bool * sub_ok , bool * mul_ok , char * detail )
+{
+	int64_t sum        = Test_Limit( (int64_t)a + b , FP_Q16_MIN , FP_Q16_MAX );
+	int64_t difference = Test_Limit( (int64_t)a - b , FP_Q16_MIN , FP_Q16_MAX );
+	int64_t product    = Test_Limit( Test_RoundShift( (int64_t)a * b , 16 ) , FP_Q16_MIN , FP_Q16_MAX );
+
+	bool add = ( FP_Q16_Add( a , b ) == sum );
+	bool sub = ( FP_Q16_Sub( a , b ) == difference );
+	bool mul = ( FP_Q16_Mul( a , b ) == product );
+
+	if ( ( *add_ok && !add ) || ( *sub_ok && !sub ) || ( *mul_ok && !mul ) )
+	{
+		sprintf( detail , "first wrong pair %ld , %ld" , (long)a , (long)b );
+	}
+
+	*add_ok &= add;
+	*sub_ok &= sub;
+	*mul_ok &= mul;
+}
+
+
+
+
+
+/*
+ * @brief Check the Q15.16 add, subtract and multiply.
+ */
+static void Test_Q16( void )
+{
+	static const q15_16 edges[] =
+	{
+		0 , 1 , -1 , 2 , -2 , 0x7FFF , 0x8000 , 0xFFFF , FP_Q16_ONE , -FP_Q16_ONE , FP_Q16_ONE + 1 , FP_Q16_ONE - 1 ,
+		0x00B504F3 , -0x00B504F3 , 0x00B504F4 , 0x7FFF0000 , -0x7FFF0000 , 0x40000000 , -0x40000000 ,
+		0x7FFFFFFF , -0x7FFFFFFF , FP_Q16_MIN , 0x00018000 , 0x00008001 , 0x12345678 , -0x12345678
+	};
+	int count = sizeof( edges ) / sizeof( edges[0] );
+	bool add_ok = true , sub_ok = true , mul_ok = true;
+	char detail[ 96 ];
+
+	sprintf( detail , "%d edge values squared, %lu random pairs" , count , TEST_RANDOM_PAIRS );
+
+	for ( int i = 0 ; i < count ; i++ )
+	{
+		for ( int j = 0 ; j < count ; j++ )
+		{
+			Test_Q16Pair( edges[ i ] , edges[ j ] , &add_ok , &sub_ok , &mul_ok , detail );
+		}
+	}
+
+	for ( unsigned long i = 0 ; i < TEST_RANDOM_PAIRS ; i++ )
+	{
+		Test_Q16Pair( Test_RandomQ16() , Test_RandomQ16() , &add_ok , &sub_ok , &mul_ok , detail );
+	}
+
+	Test_Report( "FP_Q16_Add exact" , add_ok , detail );
+	Test_Report( "FP_Q16_Sub exact" , sub_ok , detail );
+	Test_Report( "FP_Q16_Mul rounded" , mul_ok , detail );
+}
+
+
+
+
+
+/*
+ * @brief Error of FP_Q16_Recip for one x.
+ *
+ * @param x:        The number (not 0).
+ * @param relative: Pointer to store the relative error.
+ *
+ * @return (double) The error in LSB (0 if both the result and 1 / x are out of range).
+ */
+static double Test_RecipError( q15_16 x , double * relative )
+{
+	double exact = 4294967296.0 / x;
+	double limited = fmin( fmax( exact , (double)FP_Q16_MIN ) , (double)FP_Q16_MAX );
+	double error = FP_Q16_Recip( x ) - limited;
+
+	*relative = fabs( error ) / fabs( exact );
+
+	return fabs( error );
+}
+
+
+
+
+
+/*
+ * @brief Check FP_Q16_Recip in three ranges.
+ */
+static void Test_Recip( void )
+{
+	double lsb_max = 0.0 , lsb_large_max = 0.0 , relative_max = 0.0;
+	q15_16 lsb_x = 0 , lsb_large_x = 0 , relative_x = 0;
+	char detail[ 96 ];
+
+	for ( int sign = 1 ; sign >= -1 ; sign -= 2 )
+	{
+		/* Every x in [0.5 , 2), then a sweep up to the largest number */
+		for ( int64_t ux = 1 ; ux <= FP_Q16_MAX ; ux += ( ( ux >= 0x8000 ) && ( ux < 0x20000 ) ) ? 1 : TEST_SWEEP_STEP )
+		{
+			q15_16 x = (q15_16)( sign * ux );
+			double relative;
+			double error = Test_RecipError( x , &relative );
+
+			if ( ux < 0x8000 )
+			{
+				if ( relative > relative_max )
+				{
+					relative_max = relative;
+					relative_x = x;
+				}
+			}
+			else if ( ux < 0x40000000 )
+			{
+				if ( error > lsb_max )
+				{
+					lsb_max = error;
+					lsb_x = x;
+				}
+			}
+			else if ( error > lsb_large_max )
+			{
+				lsb_large_max = error;
+				lsb_large_x = x;
+			}
+		}
+	}
+
+	sprintf( detail , "max %.3f LSB at x = %ld (1/x = %ld)" , lsb_max , (long)lsb_x , (long)FP_Q16_Recip( lsb_x ) );
+	Test_Report( "FP_Q16_Recip 0.5 <= |x| < 16384" , lsb_max <= TEST_RECIP_LSB , detail );
+
+	sprintf( detail , "max %.3f LSB at x = %ld" , lsb_large_max , (long)lsb_large_x );
+	Test_Report( "FP_Q16_Recip |x| >= 16384" , lsb_large_max <= TEST_RECIP_LSB_LARGE , detail );
+
+	sprintf( detail , "max %.5f%% at x = %ld" , 100.0 * relative_max , (long)relative_x );
+	Test_Report( "FP_Q16_Recip |x| < 0.5" , relative_max <= TEST_RECIP_RELATIVE , detail );
+
+	Test_Report( "FP_Q16_Recip 0 and 1" , ( FP_Q16_Recip( 0 ) == FP_Q16_MAX ) && ( FP_Q16_Recip( FP_Q16_ONE ) == FP_Q16_ONE ) ,
+				 "1 / 0 = FP_Q16_MAX, 1 / 1 = 1" );
+}
+
+
+
+
+
+/*
+ * @brief Check one square root input and keep the first wrong one.
+ */
+static void Test_SqrtInput( uint32_t x , bool * sqrt32_ok , bool * sqrt16_ok , char * detail )
+{
+	uint64_t root = (uint64_t)sqrtl( (long double)x );
+
+	/* Rounded down exactly (sqrtl may be one step off for large x) */
+	while ( root * root > x )
+	{
+		root--;
+	}
+	while ( ( root + 1 ) * ( root + 1 ) <= x )
+	{
+		root++;
+	}
+
+	bool ok32 = ( FP_Sqrt32( x ) == root );
+	bool ok16 = true;
+
+	if ( x <= FP_Q16_MAX )
+	{
+		/* sqrt( x * 2^16 ) rounded to nearest: n with ( n - 0.5 )^2 <= x * 2^16 < ( n + 0.5 )^2 */
+		uint64_t scaled = (uint64_t)x << 16;
+		uint64_t n = (uint64_t)sqrtl( (long double)scaled );
+
+		while ( n * n > scaled )
+		{
+			n--;
+		}
+		if ( scaled - n * n > n )
+		{
+			n++;
+		}
+
+		ok16 = ( (uint64_t)FP_Q16_Sqrt( (q15_16)x ) == n );
+	}
+
+	if ( ( *sqrt32_ok && !ok32 ) || ( *sqrt16_ok && !ok16 ) )
+	{
+		sprintf( detail , "first wrong input %lu" , (unsigned long)x );
+	}
+
+	*sqrt32_ok &= ok32;
+	*sqrt16_ok &= ok16;
+}
+
+
+
+
+
+/*
+ * @brief Check FP_Sqrt32 and FP_Q16_Sqrt.
+ */
+static void Test_Sqrt( void )
+{
+	bool sqrt32_ok = true , sqrt16_ok = true;
+	char detail[ 96 ] = "every x < 2^24, squares +-1, random";
+
+	for ( uint32_t x = 0 ; x < ( 1UL << 24 ) ; x++ )
+	{
+		Test_SqrtInput( x , &sqrt32_ok , &sqrt16_ok , detail );
+	}
+
+	for ( uint64_t n = 4096 ; n < 65536 ; n++ )
+	{
+		Test_SqrtInput( (uint32_t)( n * n - 1 ) , &sqrt32_ok , &sqrt16_ok , detail );
+		Test_SqrtInput( (uint32_t)( n * n ) , &sqrt32_ok , &sqrt16_ok , detail );
+		Test_SqrtInput( (uint32_t)( n * n + n ) , &sqrt32_ok , &sqrt16_ok , detail );
+	}
+
+	for ( unsigned long i = 0 ; i < TEST_SQRT_RANDOM ; i++ )
+	{
+		Test_SqrtInput( Test_Random() , &sqrt32_ok , &sqrt16_ok , detail );
+	}
+
+	Test_SqrtInput( 0xFFFFFFFFUL , &sqrt32_ok , &sqrt16_ok , detail );
+
+	Test_Report( "FP_Sqrt32 rounded down" , sqrt32_ok , detail );
+	Test_Report( "FP_Q16_Sqrt rounded to nearest" , sqrt16_ok , detail );
+	Test_Report( "FP_Q16_Sqrt negative" , ( FP_Q16_Sqrt( -FP_Q16_ONE ) == 0 ) && ( FP_Q16_Sqrt( FP_Q16_MIN ) == 0 ) , "gives 0" );
+}
+
+
+
+
+
+/*
+ * @brief Check FP_Sin and FP_Cos with every angle.
+ */
+static void Test_Sin( void )
+{
+	double sin_max = 0.0 , cos_max = 0.0;
+	char detail[ 96 ];
+
+	for ( uint32_t angle = 0 ; angle < 65536 ; angle++ )
+	{
+		double radians = angle * 2.0 * M_PI / 65536.0;
+
+		sin_max = fmax( sin_max , fabs( FP_Sin( (uint16)angle ) / 65536.0 - sin( radians ) ) );
+		cos_max = fmax( cos_max , fabs( FP_Cos( (uint16)angle ) / 65536.0 - cos( radians ) ) );
+	}
+
+	sprintf( detail , "max %.6f (%.1f LSB)" , sin_max , sin_max * 65536.0 );
+	Test_Report( "FP_Sin every angle" , sin_max < TEST_SIN_ERROR , detail );
+
+	sprintf( detail , "max %.6f (%.1f LSB)" , cos_max , cos_max * 65536.0 );
+	Test_Report( "FP_Cos every angle" , cos_max < TEST_SIN_ERROR , detail );
+}
+
+
+
+
+
+int main( void )
+{
+	Test_Q8();
+	Test_Q16();
+	Test_Recip();
+	Test_Sqrt();
+	Test_Sin();
+
+	return ( failed_checks == 0 ) ? 0 : 1;
+}
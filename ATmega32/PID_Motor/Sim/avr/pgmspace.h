@@ -0,0 +1,28 @@
+/****************************************************************************
+ * @file    pgmspace.h
+ * @author  Boles Medhat
+ * @brief   Host Program Memory Header File
+ * @version 1.0
+ * @date    [2024-05-20]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file replaces <avr/pgmspace.h> when a LIB module is built for the
+ * host tests of this folder: the tables stay in RAM and are read directly.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef PGMSPACE_H_
+#define PGMSPACE_H_
+
+#define PROGMEM
+#define pgm_read_byte( address )		( *(const unsigned char *)( address ) )
+#define pgm_read_word( address )		( *(const unsigned short *)( address ) )
+
+
+#endif /* PGMSPACE_H_ */
@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+"""
+Host reader of the PID_Motor metrics.
+
+In analog mode the motor sends text status lines, the names of the metrics
+once ("METRICS,<name>,...") and a binary METRICS_Export frame every
+METRICS_EXPORT_LOOPS status lines, and answers the parameter requests with
+binary PARAM reply frames. This tool reads that stream and prints every
+metrics frame with the names:
+
+    METRICS_SYNC , counters16 , counters32 , histograms , buckets ,
+    16-bit counters , 32-bit counters , histogram buckets (16-bit each) , checksum
+
+(little endian, the checksum is the XOR of all the bytes after METRICS_SYNC,
+see Code/LIB/METRICS/METRICS_def.h). The parser resyncs on METRICS_SYNC:
+the text lines and the PARAM reply frames are skipped, and a frame with a
+wrong checksum is dropped.
+
+Usage:
+    python3 metrics.py <port> [--baud 9600]
+    python3 metrics.py --file capture.bin
+
+The port can be a serial device (/dev/ttyUSB0, COM3) or the pseudo terminal
+of a simulator. Reading a port needs pyserial (pip install pyserial).
+"""
+
+import argparse
+import sys
+
+METRICS_SYNC = 0xA6
+METRICS_NAMES_PREFIX = b"METRICS,"
+METRICS_MAX_BUCKETS = 17
+
+PARAM_SYNC = 0xA5
+PARAM_REPLY = 0x80
+PARAM_REPLY_SIZE = 9
+
+
+def xor(data):
+    checksum = 0
+    for byte in data:
+        checksum ^= byte
+    return checksum
+
+
+def bucket_range(bucket, buckets):
+    """Values counted by a log2 bucket (as METRICS_HistAdd)."""
+    if bucket == 0:
+        return "0"
+    low = 1 << (bucket - 1)
+    if bucket == buckets - 1:
+        return f">={low}"
+    high = (1 << bucket) - 1
+    return f"{low}" if low == high else f"{low}-{high}"
+
+
+class MetricsReader:
+    """Splits the byte stream into names lines, metrics frames and skipped bytes."""
+
+    def __init__(self):
+        self.buffer = bytearray()
+        self.line = bytearray()
+        self.names = []
+        self.frames = 0
+        self.resyncs = 0
+
+    def feed(self, data):
+        """Adds received bytes, returns the decoded frames [(number, counters16, counters32, histograms)]."""
+        self.buffer += data
+        frames = []
+        while self.buffer:
+            byte = self.buffer[0]
+
+            if byte == METRICS_SYNC:
+                size = self.frame_size()
+                if size is None:
+                    break
+                if size == 0 or xor(self.buffer[1:size]) != 0:
+                    # Not a frame (or a damaged one): resync on the next byte
+                    self.resyncs += 1
+                    del self.buffer[0]
+                    continue
+                self.frames += 1
+                frames.append((self.frames,) + self.decode(self.buffer[:size]))
+                del self.buffer[:size]
+
+            elif byte == PARAM_SYNC:
+                # PARAM reply frame (its value bytes can be METRICS_SYNC)
+                if len(self.buffer) < PARAM_REPLY_SIZE:
+                    break
+                frame = self.buffer[:PARAM_REPLY_SIZE]
+                if (frame[1] & PARAM_REPLY) and xor(frame[1:]) == 0:
+                    del self.buffer[:PARAM_REPLY_SIZE]
+                else:
+                    del self.buffer[0]
+
+            else:
+                # Text: keep the names line, skip the status lines
+                del self.buffer[0]
+                if byte == ord('\n'):
+                    self.text_line(bytes(self.line).rstrip(b"\r"))
+                    self.line.clear()
+                elif byte < 0x80:
+                    self.line.append(byte)
+        return frames
+
+    def frame_size(self):
+        """Bytes of the frame at the start of the buffer, 0 if the header is wrong, None if it is not received yet."""
+        if len(self.buffer) < 5:
+            return None
+        counters16, counters32, histograms, buckets = self.buffer[1:5]
+        if not (counters16 and counters32 and histograms and 2 <= buckets <= METRICS_MAX_BUCKETS):
+            return 0
+        size = 6 + counters16 * 2 + counters32 * 4 + histograms * buckets * 2
+        if len(self.buffer) < size:
+            return None
+        return size
+
+    def text_line(self, line):
+        start = line.find(METRICS_NAMES_PREFIX)
+        if start >= 0:
+            self.names = line[start + len(METRICS_NAMES_PREFIX):].decode('ascii', 'replace').split(',')
+
+    @staticmethod
+    def decode(frame):
+        counters16, counters32, histograms, buckets = frame[1:5]
+        offset = 5
+        values16 = []
+        for _ in range(counters16):
+            values16.append(int.from_bytes(frame[offset:offset + 2], 'little'))
+            offset += 2
+        values32 = []
+        for _ in range(counters32):
+            values32.append(int.from_bytes(frame[offset:offset + 4], 'little'))
+            offset += 4
+        hists = []
+        for _ in range(histograms):
+            hist = []
+            for _ in range(buckets):
+                hist.append(int.from_bytes(frame[offset:offset + 2], 'little'))
+                offset += 2
+            hists.append(hist)
+        return values16, values32, hists
+
+    def name(self, index, default):
+        return self.names[index] if index < len(self.names) else default
+
+
+def print_frame(reader, frame):
+    number, values16, values32, hists = frame
+    print(f"--- metrics frame {number} ---")
+    index = 0
+    for item, value in enumerate(values16):
+        print(f"{reader.name(index, f'counter16_{item}'):<20} {value}")
+        index += 1
+    for item, value in enumerate(values32):
+        print(f"{reader.name(index, f'counter32_{item}'):<20} {value}")
+        index += 1
+    for item, hist in enumerate(hists):
+        total = sum(hist)
+        print(f"{reader.name(index, f'histogram_{item}'):<20} {total} values")
+        index += 1
+        for bucket, count in enumerate(hist):
+            if count:
+                print(f"    {bucket_range(bucket, len(hist)):>12}  {count:>6}  {100.0 * count / total:5.1f}%")
+    sys.stdout.flush()
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Print the metrics frames of the PID_Motor")
+    parser.add_argument("port", nargs='?')
+    parser.add_argument("--baud", type=int, default=9600)
+    parser.add_argument("--file", help="read a captured stream instead of a port")
+    args = parser.parse_args()
+
+    if (args.port is None) == (args.file is None):
+        parser.error("give a port or --file")
+
+    reader = MetricsReader()
+
+    if args.file:
+        with open(args.file, 'rb') as file:
+            for frame in reader.feed(file.read()):
+                print_frame(reader, frame)
+        print(f"{reader.frames} frames, {reader.resyncs} resyncs")
+        return
+
+    import serial
+
+    with serial.Serial(args.port, args.baud, timeout=0.1) as port:
+        try:
+            while True:
+                for frame in reader.feed(port.read(256)):
+                    print_frame(reader, frame)
+        except KeyboardInterrupt:
+            print(f"\n{reader.frames} frames, {reader.resyncs} resyncs")
+
+
+if __name__ == '__main__':
+    main()
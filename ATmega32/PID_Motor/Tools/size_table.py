@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+"""
+Flash and RAM table of the PID_Motor firmware, one row per module.
+
+Reads the symbols of the .elf file with avr-nm (their size and the source
+file of the debug information) and adds every symbol to the module of its
+file (APP, HAL/BENCH, LIB/FixedPoint, ...):
+- flash: code and constant tables (nm types T t W w V v R r) and the
+  initial values of the initialized variables (D d),
+- RAM: initialized and zeroed variables (D d B b).
+The symbols without a source file (avr-libc, the float library, the
+startup code) are counted as "other", and the totals of avr-size -A are
+the last row, so the difference is the vector table and the padding.
+
+The output is CSV (module,flash,ram), so two builds can be compared with
+diff or a spreadsheet. Build with debug information (-g) for the files.
+
+Usage:
+    python3 size_table.py Debug/PID_Motor.elf [--nm avr-nm] [--size avr-size]
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+
+FLASH_TYPES = set("TtWwVvRrDd")
+RAM_TYPES = set("DdBb")
+OTHER_MODULE = "other"
+TOTAL_MODULE = "TOTAL"
+
+
+def module_of(path):
+    """Module of a source file: its directory under Code/ (Code/HAL/BENCH/BENCH.c -> HAL/BENCH)."""
+    if not path:
+        return OTHER_MODULE
+    parts = path.replace('\\', '/').split('/')
+    if "Code" in parts:
+        parts = parts[len(parts) - parts[::-1].index("Code"):]
+    else:
+        return OTHER_MODULE
+    return '/'.join(parts[:-1]) if len(parts) > 1 else parts[0]
+
+
+def parse_nm(text):
+    """Parses avr-nm -S -l lines, returns {module: [flash, ram]}."""
+    modules = {}
+    for line in text.splitlines():
+        symbol, _, location = line.partition('\t')
+        fields = symbol.split()
+        # address size type name (symbols without a size are labels)
+        if len(fields) < 4:
+            continue
+        size, kind = int(fields[1], 16), fields[2]
+        path = location.rsplit(':', 1)[0] if location else ""
+        sizes = modules.setdefault(module_of(path), [0, 0])
+        if kind in FLASH_TYPES:
+            sizes[0] += size
+        if kind in RAM_TYPES:
+            sizes[1] += size
+    return modules
+
+
+def parse_size(text):
+    """Parses avr-size -A, returns [flash, ram]."""
+    sections = {}
+    for line in text.splitlines():
+        fields = line.split()
+        if len(fields) == 3 and fields[0].startswith('.') and fields[1].isdigit():
+            sections[fields[0]] = int(fields[1])
+    flash = sections.get(".text", 0) + sections.get(".data", 0)
+    ram = sections.get(".data", 0) + sections.get(".bss", 0) + sections.get(".noinit", 0)
+    return [flash, ram]
+
+
+def run(command):
+    try:
+        return subprocess.run(command, check=True, capture_output=True, text=True).stdout
+    except FileNotFoundError:
+        sys.exit(f"{command[0]} not found (install the AVR toolchain or give its path)")
+    except subprocess.CalledProcessError as failure:
+        sys.exit(failure.stderr.strip())
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Flash and RAM of every module of the firmware (CSV)")
+    parser.add_argument("elf")
+    parser.add_argument("--nm", default="avr-nm")
+    parser.add_argument("--size", default="avr-size")
+    args = parser.parse_args()
+
+    if not os.path.isfile(args.elf):
+        sys.exit(f"{args.elf}: no such file")
+
+    modules = parse_nm(run([args.nm, "-S", "-l", "--size-sort", args.elf]))
+    total = parse_size(run([args.size, "-A", args.elf]))
+
+    print("module,flash,ram")
+    for module, (flash, ram) in sorted(modules.items(), key=lambda item: (item[0] == OTHER_MODULE, -item[1][0])):
+        print(f"{module},{flash},{ram}")
+    print(f"{TOTAL_MODULE},{total[0]},{total[1]}")
+
+
+if __name__ == '__main__':
+    main()
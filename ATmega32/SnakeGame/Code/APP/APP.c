@@ -8,15 +8,19 @@
  * @details
  * This file contains the main logic for a Snake game implemented on the
  * AVR ATmega32 microcontroller. The game uses a dot matrix display (via
- * shift registers) for rendering, and a 7-segment display for showing the score.
+ * shift registers, refreshed in the background from a Timer1 interrupt) for
+ * rendering, and a 7-segment display for showing the score.
  * User input is read via four push buttons for direction control.
+ * The game rules are in the hardware independent engine `SNAKE.c`, this file
+ * only reads the inputs, paces the moves and renders the game state.
  *
  * Key Features:
  * - Snake movement, collision detection, and fruit generation logic.
  * - Speed scaling based on score.
- * - Dot matrix multiplexing for flexible display sizes.
+ * - Dot matrix multiplexing for flexible display sizes, with brighter head and fruit.
  * - Optional snake wrapping or wall collision modes.
  * - Score display via 7-segment display.
+ * - Optional self-play bot (demo mode).
  *
  *
  * @contact
@@ -29,27 +33,13 @@
 #include "APP.h"
 
 
-/* Display Row & Column Data */
-uint32 row, columns;
-
-/* Snake Properties */
-sint8 snake_x[SNAKE_MAX_LENGTH], snake_y[SNAKE_MAX_LENGTH];
-uint16 snake_len = SNAKE_MIN_LENGTH;
+/* Game State (snake, fruit, score) */
+SnakeGame game;
 uint16 segment_idx;
-uint8 direction = STOP;
-
-/* Fruit Coordinates & Retry Logic */
-uint8 fruit_x, fruit_y;
-uint8 fruit_retry_count;
 
-/* Game State & Speed */
-uint8 score = 0;
+/* Game Speed */
 uint8 frame_count = 0, speed_boost = 0;
-bool valid_fruit;
-bool game_over = false;
-
-/* Display Matrix Coordinates */
-sint8 x, y;
+uint16 last_frame;
 
 /* 7-Segment Display Configuration */
 Seg7 score_display = {
@@ -67,19 +57,20 @@ Seg7 score_display = {
  * @brief Initialize the game application, peripherals, and game state.
  *
  * This function sets up the ADC, seeds the random number generator, initializes
- * the 7-segment display, configures input pins for control buttons with pull-ups,
+ * the 7-segment display, initializes the 74HC165 input service of the control buttons,
  * initializes the shift register for the matrix display, and sets the initial
  * positions of the snake and fruit.
  */
 void APP_Init()
 {
+	uint16 seed;
 
 	/* Initialize the ADC */
 	ADC_Init();
 
 	/* Read the floating analog pin as a random seed to ensure */
 	/* different random values each time the game starts */
-	srand( ADC_Read_10_Bits( FLOATING_ADC_CHANNEL ) );
+	seed = ADC_Read_10_Bits( FLOATING_ADC_CHANNEL );
 
 	/* Disable the ADC to save power */
 	ADC_Disable();
@@ -87,29 +78,18 @@ void APP_Init()
 	/* Initialize 7-segment for score display */
 	SEG7_Multiplex_Init( score_display );
 
-	/* Configure input pins for control buttons with pull-up resistors */
-	DIO_SetPinDirection( UB_PORT , UB_PIN , INPUT_PULLUP );
-	DIO_SetPinDirection( DB_PORT , DB_PIN , INPUT_PULLUP );
-	DIO_SetPinDirection( LB_PORT , LB_PIN , INPUT_PULLUP );
-	DIO_SetPinDirection( RB_PORT , RB_PIN , INPUT_PULLUP );
+	/* Initialize the control buttons (74HC165 shift-in register) */
+	BUTTONS_Init();
 
-	/* Initialize shift register for matrix display (dot/led matrix) */
-	SHIFT_OUT_Init();
+	/* Initialize the matrix display (dot/led matrix) and start its refresh timer */
+	MATRIX_Init();
+	TIMER1_Init();
 
-	/* Set initial snake head position */
-	snake_x[ HEAD ] = MAP_WIDTH / 2 + 2;
-	snake_y[ HEAD ] = MAP_HEIGHT / 2 - 1;
-
-	/* Initialize snake body behind the head */
-	for( segment_idx = 1 ; segment_idx < snake_len ; segment_idx++ )
-	{
-		snake_x[ segment_idx ] = snake_x[ segment_idx - 1 ] + 1;
-		snake_y[ segment_idx ] = snake_y[ segment_idx - 1 ];
-	}
+	/* Set initial snake and fruit positions and seed the game PRNG */
+	SNAKE_Init( &game , seed );
 
-	/* Place the initial fruit */
-	fruit_x = MAP_WIDTH / 2 - 2;
-	fruit_y = MAP_HEIGHT / 2 - 1;
+	/* Draw the initial game state */
+	Render();
 
 }
 
@@ -120,31 +100,40 @@ void APP_Init()
 /*
  * @brief Handle user input to update snake direction.
  *
- * Reads the status of control buttons and updates the snake's direction accordingly.
- * Prevents 180-degree turns to avoid immediate self-collision.
+ * Reads all the control buttons in one shift, then queues the direction of
+ * every new (debounced) press. The engine ignores repeated directions and
+ * 180-degree turns, and applies the queued turns one per move so quick
+ * double turns are not lost.
  */
 void Input_handle()
 {
+	uint16 pressed;
 
-	/* Check if UP button is pressed and prevent 180-degree turn from DOWN */
-	if		( (DIO_GetPinValue( UB_PORT , UB_PIN ) == 0) && (direction != DOWN) )
+	/* Sample and debounce all the buttons */
+	BUTTONS_Update();
+
+	/* Get the buttons pressed since the last call */
+	pressed = BUTTONS_GetPressed();
+
+	/* Check if UP button is pressed */
+	if ( GET_BIT( pressed , UB_BUTTON ) )
 	{
-		direction = UP;
+		SNAKE_QueueInput( &game , UP );
 	}
-	/* Check if DOWN button is pressed and prevent 180-degree turn from UP */
-	else if ( (DIO_GetPinValue( DB_PORT , DB_PIN ) == 0) && (direction != UP) )
+	/* Check if DOWN button is pressed */
+	if ( GET_BIT( pressed , DB_BUTTON ) )
 	{
-		direction = DOWN;
+		SNAKE_QueueInput( &game , DOWN );
 	}
-	/* Check if LEFT button is pressed and prevent 180-degree turn from RIGHT */
-	else if ( (DIO_GetPinValue( LB_PORT , LB_PIN ) == 0) && (direction != RIGHT) )
+	/* Check if LEFT button is pressed */
+	if ( GET_BIT( pressed , LB_BUTTON ) )
 	{
-		direction = LEFT;
+		SNAKE_QueueInput( &game , LEFT );
 	}
-	/* Check if RIGHT button is pressed and prevent 180-degree turn from LEFT */
-	else if ( (DIO_GetPinValue( RB_PORT , RB_PIN ) == 0) && (direction != LEFT) )
+	/* Check if RIGHT button is pressed */
+	if ( GET_BIT( pressed , RB_BUTTON ) )
 	{
-		direction = RIGHT;
+		SNAKE_QueueInput( &game , RIGHT );
 	}
 }
 
@@ -153,197 +142,39 @@ void Input_handle()
 
 
 /*
- * @brief Update the snake’s position and game logic.
+ * @brief Draw the current game state on the LED matrix.
  *
- * Checks for fruit collision, increases snake length and score, attempts to place
- * new fruit avoiding snake's body. Updates snake segments positions and checks for
- * boundary collisions (wrapping or walls) and self-collision.
+ * Clears the matrix, then draws the borders (if wrapping disabled), the snake
+ * body, the snake head and the fruit each with its own brightness level.
+ * It is called only when the game state changes, the matrix is refreshed in
+ * the background by the MATRIX driver and the new frame is shown at the end
+ * of a scan, so a half drawn frame is never seen.
  */
-void Snake_Logic()
+void Render()
 {
+	/* Wait until the previous frame is shown (the drawing frame is free) */
+	while( MATRIX_IsSwapPending() );
 
-	/* Check if snake eats the fruit */
-	if ( ( snake_x[ HEAD ] == fruit_x ) && ( snake_y[ HEAD ] == fruit_y ) )
-	{
-		/* Increase snake length and update the score */
-		snake_len++;
-		score++;
-
-		/* Reset retry counter for fruit placement attempts */
-		fruit_retry_count = 0;
-
-
-		do{
-
-			/* Assume the new fruit position is valid initially */
-			valid_fruit = true;
-
-			/* Generate new fruit coordinates within the map size:
-			 * rand() produces a 15-bit random number (0 to 32767),
-			 * multiplying by MAP_WIDTH or MAP_HEIGHT and then shifting right by 15
-			 * scales the random number to the range [1, MAP_WIDTH-2] or [1, MAP_HEIGHT-2]*/
-			fruit_x = ( ( (uint32)rand() * (MAP_WIDTH - 2)  ) >> 15 ) + 1;
-			fruit_y = ( ( (uint32)rand() * (MAP_HEIGHT - 2) ) >> 15 ) + 1;
-
-			/* Increment the number of attempts to place fruit */
-			fruit_retry_count++;
-
-			/* Verify that the new fruit position does not overlap with any segment of the snake’s body */
-			for( segment_idx = 0 ; segment_idx < snake_len ; segment_idx++ )
-			{
-				if( ( snake_x[ segment_idx ] == fruit_x ) && ( snake_y[ segment_idx ] == fruit_y ) )
-				{
-					/* Invalid position due to collision */
-					valid_fruit = false;
-					break;
-				}
-			}
-
-		/* Repeat the process if the fruit position was invalid and the retry limit has not been exceeded */
-		/* Limit the number of retries to avoid excessive delay which may cause the display to freeze */
-		}while( ( valid_fruit == false ) && ( fruit_retry_count <= MAX_FRUIT_RETRY  ) );
-
-
-	}
-
-	/* Shift each segment of the snake to the position of the previous one if it move */
-	if (direction != STOP)
-	{
-		for( segment_idx = snake_len - 1 ; segment_idx > 0  ; segment_idx-- )
-		{
-			snake_x[ segment_idx ] = snake_x[ segment_idx - 1 ];
-			snake_y[ segment_idx ] = snake_y[ segment_idx - 1 ];
-		}
-	}
-
-	/* Update head position based on direction */
-	switch (direction)
-	{
-		case LEFT:	snake_x[ HEAD ]--;	break;
-		case RIGHT:	snake_x[ HEAD ]++;	break;
-		case UP:	snake_y[ HEAD ]--;	break;
-		case DOWN:	snake_y[ HEAD ]++;	break;
-	}
-
-	/* Wrap the snake around the screen edges if enable */
-	#if SNAKE_WRAPPING == ENABLE
-
-		if ( snake_x[ HEAD ] < 0 )
-		{
-			snake_x[ HEAD ] = MAP_WIDTH - 1;
-		}
-		else if ( snake_x[ HEAD ] >=  MAP_WIDTH )
-		{
-			snake_x[ HEAD ] = 0;
-		}
-		else if ( snake_y[ HEAD ] < 0 )
-		{
-			snake_y[ HEAD ] = MAP_HEIGHT - 1;
-		}
-		else if ( snake_y[ HEAD ] >=  MAP_HEIGHT )
-		{
-			snake_y[ HEAD ] = 0;
-		}
+	/* Turn off all the pixels */
+	MATRIX_Clear();
 
+	/* If wrapping is disabled, draw the border cells */
+	#if SNAKE_WRAPPING == DISABLE_WRAPPING
+		MATRIX_DrawRect( 0 , 0 , MAP_WIDTH , MAP_HEIGHT , BORDER_LEVEL );
 	#endif
 
-	/* Check self-collision */
-	for( segment_idx = 1 ; segment_idx < snake_len  ; segment_idx++ )
+	/* Draw the snake body */
+	for( segment_idx = 1 ; segment_idx < game.snake_len ; segment_idx++ )
 	{
-
-		if( ( snake_x[ HEAD ] == snake_x[ segment_idx ] ) &&
-			( snake_y[ HEAD ] == snake_y[ segment_idx ] ) )
-		{
-			game_over = true;
-		}
+		MATRIX_SetPixel( game.snake_x[ segment_idx ] , game.snake_y[ segment_idx ] , BODY_LEVEL );
 	}
 
-	/* Check wall collision if wrap disable */
-	#if SNAKE_WRAPPING == DISABLE
-
-		if( (snake_x[ HEAD ] == 0) || (snake_x[ HEAD ] == MAP_WIDTH - 1) ||
-			(snake_y[ HEAD ] == 0) || (snake_y[ HEAD ] == MAP_HEIGHT - 1) )
-		{
-			game_over = true;
-		}
-
-	#endif
+	/* Draw the snake head and the fruit */
+	MATRIX_SetPixel( game.snake_x[ HEAD ] , game.snake_y[ HEAD ] , HEAD_LEVEL );
+	MATRIX_SetPixel( game.fruit_x , game.fruit_y , FRUIT_LEVEL );
 
-}
-
-
-
-
-
-/*
- * @brief Render the current game state on the dot matrix and 7-segment display.
- *
- * Loops through each row and column, sets bits to represent the snake, fruit, and borders
- * (if wrapping disabled). Sends row and column data in 8-bit chunks to shift registers
- * and updates the 7-segment score display.
- */
-void Dispaly()
-{
-
-	/* Loop on each row */
-	for( y = 0 ; y < MAP_HEIGHT ; y++ )
-	{
-		/* Activate only the current row on the dot matrix by setting it LOW, all other rows remain HIGH */
-		row = ~(1 << y);
-
-		/* Reset the columns for this row */
-		columns = 0;
-
-		/* Iterate through all columns in this row */
-		for( x  = 0 ; x < MAP_WIDTH ; x++ )
-		{
-			 /* Check if the current (x,y) matches any snake segment position */
-			for( segment_idx = 0 ; segment_idx < snake_len  ; segment_idx++ )
-			{
-				if( ( snake_x[ segment_idx ] == x ) && ( snake_y[ segment_idx ] == y ) )
-				{
-					/* Set the corresponding bit in column to light the snake dot */
-					columns |= 1 << x;
-				}
-			}
-
-			/* Check if the fruit is at this position */
-			if( ( fruit_x == x ) && ( fruit_y == y ) )
-			{
-				  /* Set the bit to display the fruit */
-				columns |= 1 << x;
-			}
-
-			 /* If wrapping is disabled, mark the border cells to be lit */
-			#if SNAKE_WRAPPING == DISABLE
-
-				if( (x == 0) || (x == MAP_WIDTH - 1) || (y == 0) || (y == MAP_HEIGHT - 1) )
-				{
-					 /* Set the bit to display the border */
-					columns |= 1 << x;
-				}
-			#endif
-
-		}
-
-		/* Send row data to the shift register in 8-bit chunks to support variable map sizes */
-		for ( x = MAP_HEIGHT - 8 ; x >= 0 ; x-=8)
-		{
-			SHIFT_OUT_Byte( row >> x );
-		}
-
-		/* Send column data similarly in 8-bit chunks */
-		for ( x = MAP_WIDTH - 8 ; x >= 0 ; x-=8)
-		{
-			SHIFT_OUT_Byte( columns >> x );
-		}
-
-		 /* Latch the shifted data to update the physical display */
-		SHIFT_OUT_Latch();
-
-		/* Update the 7-segment display with the current score */
-		SEG7_Multiplex_Display(score_display, score);
-	}
+	/* Show the new frame when the matrix driver finishes scanning the current one */
+	MATRIX_Swap();
 }
 
 
@@ -354,17 +185,32 @@ void Dispaly()
  * @brief Main game loop controlling input, game speed, logic, and display.
  *
  * Runs until the game is over. Handles input, updates snake position at intervals
- * based on score-modified speed, refreshes display, and triggers a software reset
- * on game over.
+ * (counted in frames scanned by the matrix driver) based on score-modified speed,
+ * redraws the game state, and triggers a software reset on game over.
  */
 void APP_main_loop()
 {
 
+	/* Start counting frames from the current one */
+	last_frame = MATRIX_GetFrameCount();
+
 	/* Run the game loop until the player loses */
-	while(game_over == false)
+	while(game.game_over == false)
 	{
-		/* Handle user input (direction changes) */
-		Input_handle();
+		/* Update the 7-segment display with the current score */
+		SEG7_Multiplex_Display(score_display, game.score);
+
+		/* Wait until the matrix driver finishes scanning a new frame */
+		if( MATRIX_GetFrameCount() == last_frame )
+		{
+			continue;
+		}
+		last_frame++;
+
+		/* Handle user input (direction changes), the buttons are sampled once per frame */
+		#if SNAKE_PLAYER == HUMAN_PLAYER
+			Input_handle();
+		#endif
 
 		/* Control snake speed based on score */
 		/* Apply game logic after a certain number of frame renders */
@@ -373,20 +219,28 @@ void APP_main_loop()
 		{
 			frame_count = 0;
 
-			/* Increase speed with score but clamp it to the base limit */
-			speed_boost = score;
-			if (speed_boost > SNAKE_SPEED_BASE)
+			/* Increase speed every SNAKE_SPEED_STEP points but clamp it to the base limit */
+			if (game.score / SNAKE_SPEED_STEP > SNAKE_SPEED_BASE)
 			{
 				speed_boost = SNAKE_SPEED_BASE;
 			}
+			else
+			{
+				speed_boost = game.score / SNAKE_SPEED_STEP;
+			}
 
 			/* Update snake movement and game logic */
-			Snake_Logic();
+			/* (the bot chooses the move in demo mode, otherwise the queued turns are used) */
+			#if SNAKE_PLAYER == BOT_PLAYER
+				SNAKE_Step( &game , SNAKE_BotInput( &game ) );
+			#else
+				SNAKE_Step( &game , STOP );
+			#endif
 
-		}
+			/* Draw the new game state */
+			Render();
 
-		/* Refresh display (snake, fruit, boundaries) */
-		Dispaly();
+		}
 
 		/* Increment frame counter for timing */
 		frame_count++;
@@ -27,15 +27,29 @@
 /*--------------------------- Include Dependencies --------------------------*/
 #include "APP_config.h"
 #include "APP_def.h"
+#include "SNAKE.h"
 
+#include "../MCAL/DEVICE/DEVICE.h"
 #include "../MCAL/DIO/DIO.h"
 #include "../MCAL/ADC/ADC.h"
 #include "../MCAL/WDT/WDT.h"
+#include "../MCAL/TIMER1/TIMER1.h"
 
 #include "../HAL/SEG7/SEG7.h"
-#include "../HAL/ShiftRegister/Shift.h"
+#include "../HAL/MATRIX/MATRIX.h"
+#include "../HAL/BUTTONS/BUTTONS.h"
 
-#include <stdlib.h>
+
+/*The game map is the whole LED matrix*/
+#if ( MAP_WIDTH != MATRIX_WIDTH ) || ( MAP_HEIGHT != MATRIX_HEIGHT )
+	#error "MAP_WIDTH and MAP_HEIGHT must be equal to MATRIX_WIDTH and MATRIX_HEIGHT"
+#endif
+
+/*The snake segments (2 bytes each) and the matrix frame buffers must fit in the RAM
+ * with 512 bytes left for the stack and the other variables (larger maps need the ATmega644P/1284P)*/
+#if ( ( SNAKE_MAX_LENGTH * 2UL ) + ( MATRIX_BUFFERING * 1UL * MATRIX_BRIGHTNESS_BITS * MATRIX_HEIGHT * MATRIX_BYTES_PER_ROW ) + 512 ) > DEVICE_RAM_SIZE
+	#error "The snake and the matrix buffers do not fit in the RAM, reduce the map or select a larger DEVICE_MCU"
+#endif
 
 
 /*---------------------------- Function Prototypes --------------------------*/
@@ -52,6 +66,24 @@
 void APP_Init(void);
 
 
+/*
+ * @brief Handle user input to update snake direction.
+ *
+ * Reads all the control buttons in one shift and queues the direction of every
+ * new (debounced) press.
+ */
+void Input_handle(void);
+
+
+/*
+ * @brief Draw the current game state on the LED matrix.
+ *
+ * Draws the borders (if wrapping disabled), the snake and the fruit, then shows
+ * the new frame at the end of the current matrix scan.
+ */
+void Render(void);
+
+
 /*
  * @brief Main game loop controlling input, game speed, logic, and display.
  *
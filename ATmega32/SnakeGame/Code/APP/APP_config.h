@@ -27,12 +27,19 @@
 #include "APP_def.h"
 
 
-/*Set the width and height of the snake game grid in pixels*/
+/*Set the width and height of the snake game grid in pixels
+ * (multiples of 8 up to 248, one 74HC595 for each 8 columns and each 8 rows, e.g. 32x32 or 64x16)
+ */
 #define MAP_WIDTH					16
 #define MAP_HEIGHT					16
 
 
 
+/*Set the maximum snake length (uses 2 bytes of RAM per segment, the entire grid is the maximum useful value)*/
+#define SNAKE_MAX_LENGTH			( MAP_WIDTH * MAP_HEIGHT )
+
+
+
 /*Set whether the snake wraps around screen edges or not:
  * choose between:
  * 1. DISABLE_WRAPPING
@@ -42,35 +49,29 @@
 
 
 
-/*Set the DIO Ports for up, dowm, left, and right buttons:
+/*Set who plays the game:
  * choose between:
- * 1. DIO_PORTA
- * 2. DIO_PORTB
- * 3. DIO_PORTC
- * 4. DIO_PORTD
+ * 1. HUMAN_PLAYER
+ * 2. BOT_PLAYER				<--demo mode, the snake follows a Hamiltonian cycle
  */
-#define UB_PORT						DIO_PORTD
-#define DB_PORT						DIO_PORTD
-#define RB_PORT						DIO_PORTD
-#define LB_PORT						DIO_PORTD
+#define SNAKE_PLAYER				HUMAN_PLAYER
+
+
+
+/*Set the number of turns that can be pressed between two moves (2 or 3 is enough)*/
+#define SNAKE_INPUT_QUEUE_SIZE		3
 
 
 
-/*Set the DIO Pin for up, dowm, left, and right buttons:
+/*Set the 74HC165 input (button number) of up, dowm, left, and right buttons
+ * (the 74HC165 pins are set in `Shift_config.h`):
  * choose between:
- * 1. DIO_PIN0
- * 2. DIO_PIN1
- * 3. DIO_PIN2
- * 4. DIO_PIN3
- * 5. DIO_PIN4
- * 6. DIO_PIN5
- * 7. DIO_PIN6
- * 8. DIO_PIN7
+ * 0 to ( BUTTONS_COUNT - 1 )  (input D0 of the first register is 0)
  */
-#define UB_PIN						DIO_PIN3
-#define DB_PIN						DIO_PIN4
-#define LB_PIN						DIO_PIN5
-#define RB_PIN						DIO_PIN6
+#define UB_BUTTON					0
+#define DB_BUTTON					1
+#define LB_BUTTON					2
+#define RB_BUTTON					3
 
 
 
@@ -110,4 +111,11 @@
 #define FLOATING_ADC_CHANNEL		ADC0
 
 
+
+/*Check the grid size*/
+#if ( MAP_WIDTH % 8 ) != 0 || ( MAP_HEIGHT % 8 ) != 0 || MAP_WIDTH > 248 || MAP_HEIGHT > 248
+	#error "MAP_WIDTH and MAP_HEIGHT must be multiples of 8 up to 248"
+#endif
+
+
 #endif /* APP_CONFIG_H_ */
@@ -25,13 +25,15 @@
 #define ENABLE_WRAPPING				1	/*Allows the snake to wrap around edges*/
 #define DISABLE_WRAPPING			0	/*Stops the game (loss) when the snake hits an edge*/
 
-#define SNAKE_MAX_LENGTH			MAP_WIDTH * MAP_HEIGHT	/*Maximum possible snake length (entire grid)*/
+#define HUMAN_PLAYER				0	/*The snake is controlled by the buttons*/
+#define BOT_PLAYER					1	/*The snake is controlled by the self-play bot (demo mode)*/
 
 #define SNAKE_MIN_LENGTH			2	/*Initial length of the snake*/
 
 #define MAX_FRUIT_RETRY 			10	/*Max attempts to place a new fruit in an unoccupied position*/
 
-#define SNAKE_SPEED_BASE			20	/*Initial game speed factor; lower means faster*/
+#define SNAKE_SPEED_BASE			10	/*Initial game speed factor (matrix frames per move); lower means faster*/
+#define SNAKE_SPEED_STEP			2	/*Score points per one frame less per move (top speed at score SNAKE_SPEED_BASE * SNAKE_SPEED_STEP)*/
 
 #define STOP						0	/*Snake is not moving*/
 #define LEFT						1	/*Snake move left*/
@@ -40,6 +42,11 @@
 #define DOWN						4	/*Snake move down*/
 
 #define HEAD						0	/*Index in the array of the snake's head*/
+
+#define BORDER_LEVEL				( ( MATRIX_LEVEL_MAX + 2 ) / 3 )		/*Brightness of the border (dim)*/
+#define BODY_LEVEL					( ( MATRIX_LEVEL_MAX * 2 + 2 ) / 3 )	/*Brightness of the snake body*/
+#define HEAD_LEVEL					MATRIX_LEVEL_MAX						/*Brightness of the snake head (full)*/
+#define FRUIT_LEVEL					MATRIX_LEVEL_MAX						/*Brightness of the fruit (full)*/
 /*_______________________________________________________________________________________________*/
 
 
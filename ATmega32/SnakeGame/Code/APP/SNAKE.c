@@ -0,0 +1,470 @@
+/****************************************************************************
+ * @file    SNAKE.c
+ * @author  Boles Medhat
+ * @brief   Snake Game Engine Source File
+ * @version 1.0
+ * @date    [2024-12-07]
+ *
+ * @details
+ * This file contains the hardware independent logic of the Snake game:
+ * movement, fruit generation, collision detection, state hashing and the
+ * self-play bot. All the state is passed in a SnakeGame struct.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ******************************************************************************/
+
+
+#include "SNAKE.h"
+
+
+/* Playable area (the border is a wall when wrapping is disabled) */
+#if   SNAKE_WRAPPING == ENABLE_WRAPPING
+	#define PLAY_X0					0
+	#define PLAY_Y0					0
+	#define PLAY_WIDTH				MAP_WIDTH
+	#define PLAY_HEIGHT				MAP_HEIGHT
+#elif SNAKE_WRAPPING == DISABLE_WRAPPING
+	#define PLAY_X0					1
+	#define PLAY_Y0					1
+	#define PLAY_WIDTH				( MAP_WIDTH  - 2 )
+	#define PLAY_HEIGHT				( MAP_HEIGHT - 2 )
+#else
+	#error "Wrong \"SNAKE_WRAPPING\" configuration option"
+#endif
+
+/* The Hamiltonian cycle of the bot needs an even number of rows */
+#if ( PLAY_HEIGHT % 2 ) != 0
+	#error "The playable height must be even for SNAKE_BotInput"
+#endif
+
+
+/* Seed used when the given seed is 0 (xorshift state must not be 0) */
+#define SNAKE_DEFAULT_SEED			0xACE1
+
+
+
+
+
+/*
+ * @brief Get the next 16-bit random number.
+ *
+ * xorshift16 (7, 9, 8) generator, period 65535.
+ *
+ * @param game: Pointer to the game state that holds the PRNG state.
+ *
+ * @return (uint16) Random number from 1 to 65535.
+ */
+static uint16 SNAKE_Random( SnakeGame * game )
+{
+	uint16 x = game->rng;
+
+	x ^= x << 7;
+	x ^= x >> 9;
+	x ^= x << 8;
+
+	game->rng = x;
+
+	return x;
+}
+
+
+
+
+
+/*
+ * @brief Initialize the game state.
+ *
+ * Places the snake in the middle of the map, the first fruit on its left,
+ * and seeds the PRNG.
+ *
+ * @param game: Pointer to the game state.
+ * @param seed: PRNG seed (0 is replaced by a fixed non zero seed).
+ */
+void SNAKE_Init( SnakeGame * game , uint16 seed )
+{
+	uint16 segment_idx;
+
+	/* Reset the game state */
+	game->snake_len = SNAKE_MIN_LENGTH;
+	game->direction = STOP;
+	game->input_count = 0;
+	game->score     = 0;
+	game->game_over = false;
+	game->tick      = 0;
+	game->rng       = ( seed == 0 ) ? SNAKE_DEFAULT_SEED : seed;
+
+	/* Set initial snake head position */
+	game->snake_x[ HEAD ] = MAP_WIDTH / 2 + 2;
+	game->snake_y[ HEAD ] = MAP_HEIGHT / 2 - 1;
+
+	/* Initialize snake body behind the head */
+	for( segment_idx = 1 ; segment_idx < game->snake_len ; segment_idx++ )
+	{
+		game->snake_x[ segment_idx ] = game->snake_x[ segment_idx - 1 ] + 1;
+		game->snake_y[ segment_idx ] = game->snake_y[ segment_idx - 1 ];
+	}
+
+	/* Place the initial fruit */
+	game->fruit_x = MAP_WIDTH / 2 - 2;
+	game->fruit_y = MAP_HEIGHT / 2 - 1;
+}
+
+
+
+
+
+/*
+ * @brief Queue a turn to be applied on a next move.
+ *
+ * The turn is checked against the last queued direction (or the current one
+ * if the queue is empty), so quick double turns between two moves are kept.
+ * Repeated directions, 180-degree turns and turns on a full queue are ignored.
+ *
+ * @param game:  Pointer to the game state.
+ * @param input: New direction [ LEFT , RIGHT , UP , DOWN ].
+ *
+ * @return (bool) true if the turn is queued, false if it is ignored.
+ */
+bool SNAKE_QueueInput( SnakeGame * game , uint8 input )
+{
+	uint8 last;
+
+	/* Ignore the turn if the queue is full */
+	if ( game->input_count >= SNAKE_INPUT_QUEUE_SIZE )
+	{
+		return false;
+	}
+
+	/* Get the direction the snake will have when this turn is applied */
+	last = ( game->input_count > 0 ) ? game->input_queue[ game->input_count - 1 ] : game->direction;
+
+	/* Ignore repeated directions and 180-degree turns */
+	if ( ( input == last ) ||
+		 !( ( input == UP    && last != DOWN  ) ||
+			( input == DOWN  && last != UP    ) ||
+			( input == LEFT  && last != RIGHT ) ||
+			( input == RIGHT && last != LEFT  ) ) )
+	{
+		return false;
+	}
+
+	/* Add the turn to the end of the queue */
+	game->input_queue[ game->input_count ] = input;
+	game->input_count++;
+
+	return true;
+}
+
+
+
+
+
+/*
+ * @brief Advance the game by one move.
+ *
+ * Queues the input direction, applies the oldest queued turn, eats the fruit,
+ * moves the snake and checks the wall and self collisions.
+ *
+ * @param game:  Pointer to the game state.
+ * @param input: New direction [ LEFT , RIGHT , UP , DOWN ], or STOP to use the queued turns only.
+ */
+void SNAKE_Step( SnakeGame * game , uint8 input )
+{
+	uint16 segment_idx;
+	uint8  queue_idx;
+	uint8  fruit_retry_count;
+	bool   valid_fruit;
+
+	/* No moves after the game is over */
+	if ( game->game_over )
+	{
+		return;
+	}
+
+	game->tick++;
+
+	/* Queue the new direction (it is validated against the last queued one) */
+	if ( input != STOP )
+	{
+		SNAKE_QueueInput( game , input );
+	}
+
+	/* Apply the oldest queued turn, one turn per move */
+	if ( game->input_count > 0 )
+	{
+		game->direction = game->input_queue[ 0 ];
+
+		/* Remove it from the queue (at most SNAKE_INPUT_QUEUE_SIZE - 1 bytes) */
+		game->input_count--;
+		for ( queue_idx = 0 ; queue_idx < game->input_count ; queue_idx++ )
+		{
+			game->input_queue[ queue_idx ] = game->input_queue[ queue_idx + 1 ];
+		}
+	}
+
+
+	/* Check if snake eats the fruit */
+	if ( ( game->snake_x[ HEAD ] == game->fruit_x ) && ( game->snake_y[ HEAD ] == game->fruit_y ) )
+	{
+		/* Increase snake length and update the score */
+		if ( game->snake_len < SNAKE_MAX_LENGTH )
+		{
+			game->snake_len++;
+		}
+		game->score++;
+
+		/* The snake filled the playable area: the player wins and the game ends */
+		if ( game->snake_len >= ( PLAY_WIDTH * PLAY_HEIGHT ) )
+		{
+			game->game_over = true;
+			return;
+		}
+
+		/* Reset retry counter for fruit placement attempts */
+		fruit_retry_count = 0;
+
+
+		do{
+
+			/* Assume the new fruit position is valid initially */
+			valid_fruit = true;
+
+			/* Generate new fruit coordinates within the playable area:
+			 * multiplying the 16-bit random number by the size and then shifting
+			 * right by 16 scales it to the range [0, size-1] */
+			game->fruit_x = ( ( (uint32)SNAKE_Random( game ) * PLAY_WIDTH  ) >> 16 ) + PLAY_X0;
+			game->fruit_y = ( ( (uint32)SNAKE_Random( game ) * PLAY_HEIGHT ) >> 16 ) + PLAY_Y0;
+
+			/* Increment the number of attempts to place fruit */
+			fruit_retry_count++;
+
+			/* Verify that the new fruit position does not overlap with any segment of the snake’s body */
+			for( segment_idx = 0 ; segment_idx < game->snake_len ; segment_idx++ )
+			{
+				if( ( game->snake_x[ segment_idx ] == game->fruit_x ) && ( game->snake_y[ segment_idx ] == game->fruit_y ) )
+				{
+					/* Invalid position due to collision */
+					valid_fruit = false;
+					break;
+				}
+			}
+
+		/* Repeat the process if the fruit position was invalid and the retry limit has not been exceeded */
+		/* Limit the number of retries to avoid excessive delay which may cause the display to freeze */
+		}while( ( valid_fruit == false ) && ( fruit_retry_count <= MAX_FRUIT_RETRY ) );
+	}
+
+
+	/* Shift each segment of the snake to the position of the previous one if it move */
+	if ( game->direction != STOP )
+	{
+		for( segment_idx = game->snake_len - 1 ; segment_idx > 0 ; segment_idx-- )
+		{
+			game->snake_x[ segment_idx ] = game->snake_x[ segment_idx - 1 ];
+			game->snake_y[ segment_idx ] = game->snake_y[ segment_idx - 1 ];
+		}
+	}
+
+	/* Update head position based on direction and wrap it around the screen edges */
+	/* (the coordinates are unsigned, so the edge is checked before the move; */
+	/*  when wrapping is disabled the game is over before the head reaches the edge) */
+	switch ( game->direction )
+	{
+		case LEFT:	game->snake_x[ HEAD ] = ( game->snake_x[ HEAD ] == 0 ) ? ( MAP_WIDTH - 1 )  : ( game->snake_x[ HEAD ] - 1 );	break;
+		case RIGHT:	game->snake_x[ HEAD ] = ( game->snake_x[ HEAD ] == MAP_WIDTH - 1 )  ? 0 : ( game->snake_x[ HEAD ] + 1 );		break;
+		case UP:	game->snake_y[ HEAD ] = ( game->snake_y[ HEAD ] == 0 ) ? ( MAP_HEIGHT - 1 ) : ( game->snake_y[ HEAD ] - 1 );	break;
+		case DOWN:	game->snake_y[ HEAD ] = ( game->snake_y[ HEAD ] == MAP_HEIGHT - 1 ) ? 0 : ( game->snake_y[ HEAD ] + 1 );		break;
+	}
+
+	/* Check self-collision */
+	for( segment_idx = 1 ; segment_idx < game->snake_len ; segment_idx++ )
+	{
+		if( ( game->snake_x[ HEAD ] == game->snake_x[ segment_idx ] ) &&
+			( game->snake_y[ HEAD ] == game->snake_y[ segment_idx ] ) )
+		{
+			game->game_over = true;
+		}
+	}
+
+	/* Check wall collision if wrap disable */
+	#if SNAKE_WRAPPING == DISABLE_WRAPPING
+
+		if( ( game->snake_x[ HEAD ] == 0 ) || ( game->snake_x[ HEAD ] == MAP_WIDTH - 1 ) ||
+			( game->snake_y[ HEAD ] == 0 ) || ( game->snake_y[ HEAD ] == MAP_HEIGHT - 1 ) )
+		{
+			game->game_over = true;
+		}
+
+	#endif
+}
+
+
+
+
+
+/*
+ * @brief Calculate a hash of the game state.
+ *
+ * Two games with the same seed and the same inputs have the same hash, so it
+ * can be stored with a recorded input log and compared after a replay.
+ *
+ * @param game: Pointer to the game state.
+ *
+ * @return (uint16) FNV-1a hash of the snake, fruit, score and tick.
+ */
+uint16 SNAKE_Hash( const SnakeGame * game )
+{
+	/* 32-bit FNV-1a folded to 16 bits */
+	uint32 hash = 0x811C9DC5UL;
+	uint16 segment_idx;
+
+	#define SNAKE_HASH_BYTE( B )	hash = ( hash ^ (uint8)( B ) ) * 0x01000193UL
+
+	for( segment_idx = 0 ; segment_idx < game->snake_len ; segment_idx++ )
+	{
+		SNAKE_HASH_BYTE( game->snake_x[ segment_idx ] );
+		SNAKE_HASH_BYTE( game->snake_y[ segment_idx ] );
+	}
+
+	SNAKE_HASH_BYTE( game->fruit_x );
+	SNAKE_HASH_BYTE( game->fruit_y );
+	SNAKE_HASH_BYTE( game->score );
+	SNAKE_HASH_BYTE( game->score >> 8 );
+	SNAKE_HASH_BYTE( game->direction );
+	SNAKE_HASH_BYTE( game->input_count );
+	SNAKE_HASH_BYTE( game->game_over );
+	SNAKE_HASH_BYTE( game->tick );
+	SNAKE_HASH_BYTE( game->tick >> 8 );
+	SNAKE_HASH_BYTE( game->tick >> 16 );
+	SNAKE_HASH_BYTE( game->tick >> 24 );
+
+	#undef SNAKE_HASH_BYTE
+
+	return (uint16)( hash ^ ( hash >> 16 ) );
+}
+
+
+
+
+
+/*
+ * @brief Apply one input to the game and append it to the log.
+ *
+ * A direction is queued with SNAKE_QueueInput and STOP advances the game one
+ * move with SNAKE_Step, so the turns of a human player between two moves are
+ * kept. The log seed must be the one given to SNAKE_Init.
+ *
+ * @param game:  Pointer to the game state.
+ * @param log:   Pointer to the log.
+ * @param input: Direction [ LEFT , RIGHT , UP , DOWN ], or STOP to move.
+ *
+ * @return (bool) true if the input is recorded, false if the log is full (the input is still applied).
+ */
+bool SNAKE_Record( SnakeGame * game , SnakeLog * log , uint8 input )
+{
+	if ( input == STOP )
+	{
+		SNAKE_Step( game , STOP );
+	}
+	else
+	{
+		SNAKE_QueueInput( game , input );
+	}
+
+	if ( log->length >= log->size )
+	{
+		return false;
+	}
+
+	log->inputs[ log->length ] = input;
+	log->length++;
+
+	return true;
+}
+
+
+
+
+
+/*
+ * @brief Replay a recorded game and get the hash of its final state.
+ *
+ * Compare the result with SNAKE_Hash of the recorded game (or a stored hash)
+ * to check that the game logic still gives the same game.
+ *
+ * @param game: Pointer to a game state used for the replay (it is overwritten).
+ * @param log:  Pointer to the log.
+ *
+ * @return (uint16) SNAKE_Hash of the final state.
+ */
+uint16 SNAKE_Replay( SnakeGame * game , const SnakeLog * log )
+{
+	uint16 input_idx;
+
+	SNAKE_Init( game , log->seed );
+
+	for( input_idx = 0 ; input_idx < log->length ; input_idx++ )
+	{
+		if ( log->inputs[ input_idx ] == STOP )
+		{
+			SNAKE_Step( game , STOP );
+		}
+		else
+		{
+			SNAKE_QueueInput( game , log->inputs[ input_idx ] );
+		}
+	}
+
+	return SNAKE_Hash( game );
+}
+
+
+
+
+
+/*
+ * @brief Get the next move of the self-play bot.
+ *
+ * The bot follows a Hamiltonian cycle over the playable area, so it never
+ * collides and always eats the fruit (used for demo mode and long runs).
+ * The cycle goes right on even rows and left on odd rows (skipping the first
+ * column), then returns up along the first column:
+ *
+ *    >>>>v
+ *    ^v<<<
+ *    ^>>>v
+ *    ^<<<<
+ *
+ * @param game: Pointer to the game state.
+ *
+ * @return (uint8) Direction [ LEFT , RIGHT , UP , DOWN ].
+ */
+uint8 SNAKE_BotInput( const SnakeGame * game )
+{
+	uint8 x = game->snake_x[ HEAD ] - PLAY_X0;
+	uint8 y = game->snake_y[ HEAD ] - PLAY_Y0;
+
+	/* Return column: go up to the first row then right */
+	if ( x == 0 )
+	{
+		return ( y == 0 ) ? RIGHT : UP;
+	}
+
+	/* Even row: go right to the last column then down */
+	if ( ( y % 2 ) == 0 )
+	{
+		return ( x < PLAY_WIDTH - 1 ) ? RIGHT : DOWN;
+	}
+
+	/* Odd row: go left to the second column then down, the last row goes into the return column */
+	if ( ( x > 1 ) || ( y == PLAY_HEIGHT - 1 ) )
+	{
+		return LEFT;
+	}
+
+	return DOWN;
+}
@@ -0,0 +1,163 @@
+/****************************************************************************
+ * @file    SNAKE.h
+ * @author  Boles Medhat
+ * @brief   Snake Game Engine Header File
+ * @version 1.0
+ * @date    [2024-12-07]
+ *
+ * @details
+ * This file declares the hardware independent engine of the Snake game.
+ * The whole game is kept in one SnakeGame struct and advanced one move by
+ * SNAKE_Step(), the fruit is placed by a seeded xorshift PRNG stored in the
+ * struct, so the same seed and the same inputs always give the same game.
+ * This makes it possible to record the inputs of a game, replay them and
+ * compare SNAKE_Hash() of the final state to detect logic changes.
+ *
+ * @note
+ * - The engine does not include any MCAL or HAL driver, it can be compiled
+ *   for the host as it is.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ***************************************************************************/
+
+#ifndef SNAKE_H_
+#define SNAKE_H_
+
+#include "../LIB/STD_TYPES.h"
+#include "APP_config.h"
+
+
+/*------------------------------------------   types    -----------------------------------------*/
+
+/*Snake game state*/
+typedef struct
+{
+	uint8  snake_x[ SNAKE_MAX_LENGTH ];		/*X coordinate of each snake segment (HEAD first), from 0 to MAP_WIDTH  - 1*/
+	uint8  snake_y[ SNAKE_MAX_LENGTH ];		/*Y coordinate of each snake segment (HEAD first), from 0 to MAP_HEIGHT - 1*/
+	uint16 snake_len;						/*Number of snake segments*/
+	uint8  direction;						/*Current direction [ STOP , LEFT , RIGHT , UP , DOWN ]*/
+	uint8  input_queue[ SNAKE_INPUT_QUEUE_SIZE ];	/*Pending turns, one is applied per move*/
+	uint8  input_count;						/*Number of pending turns*/
+	uint8  fruit_x;							/*X coordinate of the fruit*/
+	uint8  fruit_y;							/*Y coordinate of the fruit*/
+	uint16 score;							/*Number of eaten fruits*/
+	bool   game_over;						/*true after a wall or self collision, or when the snake fills the map*/
+	uint16 rng;								/*State of the xorshift PRNG (never 0)*/
+	uint32 tick;							/*Number of SNAKE_Step calls*/
+}SnakeGame;
+
+/*Recorded game: the seed and every input in order*/
+typedef struct
+{
+	uint16 seed;							/*Seed given to SNAKE_Init*/
+	uint8 * inputs;							/*Log buffer: a direction is a queued turn, STOP is one move*/
+	uint16 size;							/*Size of the log buffer*/
+	uint16 length;							/*Number of recorded inputs*/
+}SnakeLog;
+/*_______________________________________________________________________________________________*/
+
+
+
+/*---------------------------- Function Prototypes --------------------------*/
+
+
+/*
+ * @brief Initialize the game state.
+ *
+ * Places the snake in the middle of the map, the first fruit on its left,
+ * and seeds the PRNG.
+ *
+ * @param game: Pointer to the game state.
+ * @param seed: PRNG seed (0 is replaced by a fixed non zero seed).
+ */
+void SNAKE_Init( SnakeGame * game , uint16 seed );
+
+
+/*
+ * @brief Queue a turn to be applied on a next move.
+ *
+ * The turn is checked against the last queued direction (or the current one
+ * if the queue is empty), so quick double turns between two moves are kept.
+ * Repeated directions, 180-degree turns and turns on a full queue are ignored.
+ *
+ * @param game:  Pointer to the game state.
+ * @param input: New direction [ LEFT , RIGHT , UP , DOWN ].
+ *
+ * @return (bool) true if the turn is queued, false if it is ignored.
+ */
+bool SNAKE_QueueInput( SnakeGame * game , uint8 input );
+
+
+/*
+ * @brief Advance the game by one move.
+ *
+ * Queues the input direction, applies the oldest queued turn, eats the fruit,
+ * moves the snake and checks the wall and self collisions.
+ *
+ * @param game:  Pointer to the game state.
+ * @param input: New direction [ LEFT , RIGHT , UP , DOWN ], or STOP to use the queued turns only.
+ */
+void SNAKE_Step( SnakeGame * game , uint8 input );
+
+
+/*
+ * @brief Calculate a hash of the game state.
+ *
+ * Two games with the same seed and the same inputs have the same hash, so it
+ * can be stored with a recorded input log and compared after a replay.
+ *
+ * @param game: Pointer to the game state.
+ *
+ * @return (uint16) FNV-1a hash of the snake, fruit, score and tick.
+ */
+uint16 SNAKE_Hash( const SnakeGame * game );
+
+
+/*
+ * @brief Apply one input to the game and append it to the log.
+ *
+ * A direction is queued with SNAKE_QueueInput and STOP advances the game one
+ * move with SNAKE_Step, so the turns of a human player between two moves are
+ * kept. The log seed must be the one given to SNAKE_Init.
+ *
+ * @param game:  Pointer to the game state.
+ * @param log:   Pointer to the log.
+ * @param input: Direction [ LEFT , RIGHT , UP , DOWN ], or STOP to move.
+ *
+ * @return (bool) true if the input is recorded, false if the log is full (the input is still applied).
+ */
+bool SNAKE_Record( SnakeGame * game , SnakeLog * log , uint8 input );
+
+
+/*
+ * @brief Replay a recorded game and get the hash of its final state.
+ *
+ * Compare the result with SNAKE_Hash of the recorded game (or a stored hash)
+ * to check that the game logic still gives the same game.
+ *
+ * @param game: Pointer to a game state used for the replay (it is overwritten).
+ * @param log:  Pointer to the log.
+ *
+ * @return (uint16) SNAKE_Hash of the final state.
+ */
+uint16 SNAKE_Replay( SnakeGame * game , const SnakeLog * log );
+
+
+/*
+ * @brief Get the next move of the self-play bot.
+ *
+ * The bot follows a Hamiltonian cycle over the playable area, so it never
+ * collides and always eats the fruit (used for demo mode and long runs).
+ *
+ * @param game: Pointer to the game state.
+ *
+ * @return (uint8) Direction [ LEFT , RIGHT , UP , DOWN ].
+ */
+uint8 SNAKE_BotInput( const SnakeGame * game );
+
+
+#endif /* SNAKE_H_ */
@@ -0,0 +1,66 @@
+/****************************************************************************
+ * @file    BUTTONS_config.h
+ * @author  Boles Medhat
+ * @brief   Shift-In Buttons Driver Configuration Header File
+ * @version 1.0
+ * @date    [2024-12-07]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @note
+ * - The 74HC165 pins and the shift order are set in `Shift_config.h`,
+ *   the shift order must be SHIFT_MSB_FIRST so input Dn is button n.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef BUTTONS_CONFIG_H_
+#define BUTTONS_CONFIG_H_
+
+#include "BUTTONS_def.h"
+#include "../ShiftRegister/Shift_config.h"
+
+
+/*Set the number of chained 74HC165 registers (1 or 2)
+ * the register connected to the MCU data pin holds buttons 0 to 7,
+ * the next register in the chain holds buttons 8 to 15
+ */
+#define BUTTONS_REGISTERS					1
+
+
+/*Set the button level when pressed
+ * choose between:
+ * 1. BUTTONS_ACTIVE_LOW
+ * 2. BUTTONS_ACTIVE_HIGH
+ */
+#define BUTTONS_ACTIVE_LEVEL				BUTTONS_ACTIVE_LOW
+
+
+/*Set the number of equal samples (BUTTONS_Update calls) needed to accept a new button state (from 1 to 8)
+ * debounce time = BUTTONS_DEBOUNCE_SAMPLES * time between BUTTONS_Update calls
+ */
+#define BUTTONS_DEBOUNCE_SAMPLES			2
+
+
+
+#if ( BUTTONS_REGISTERS < 1 ) || ( BUTTONS_REGISTERS > 2 )
+	#error "Wrong \"BUTTONS_REGISTERS\" configuration option"
+#endif
+
+#if ( BUTTONS_ACTIVE_LEVEL != BUTTONS_ACTIVE_LOW ) && ( BUTTONS_ACTIVE_LEVEL != BUTTONS_ACTIVE_HIGH )
+	#error "Wrong \"BUTTONS_ACTIVE_LEVEL\" configuration option"
+#endif
+
+#if ( BUTTONS_DEBOUNCE_SAMPLES < 1 ) || ( BUTTONS_DEBOUNCE_SAMPLES > 8 )
+	#error "Wrong \"BUTTONS_DEBOUNCE_SAMPLES\" configuration option"
+#endif
+
+#if SHIFT_ORDER != SHIFT_MSB_FIRST
+	#error "The BUTTONS driver needs SHIFT_ORDER = SHIFT_MSB_FIRST"
+#endif
+
+
+#endif /* BUTTONS_CONFIG_H_ */
@@ -0,0 +1,42 @@
+/****************************************************************************
+ * @file    BUTTONS_def.h
+ * @author  Boles Medhat
+ * @brief   Shift-In Buttons Driver Definitions Header File
+ * @version 1.0
+ * @date    [2024-12-07]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the macro definitions used by the Shift-In Buttons
+ * Driver (push buttons on 74HC165 parallel inputs).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef BUTTONS_DEF_H_
+#define BUTTONS_DEF_H_
+
+#include "../../LIB/STD_TYPES.h"
+
+
+/*------------------------------------------   modes    -----------------------------------------*/
+
+/*Button electrical level when pressed*/
+#define BUTTONS_ACTIVE_LOW					0			/*Pull-up resistor, the button connects the input to GND*/
+#define BUTTONS_ACTIVE_HIGH					1			/*Pull-down resistor, the button connects the input to VCC*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Number of buttons (8 inputs per 74HC165)*/
+#define BUTTONS_COUNT						( BUTTONS_REGISTERS * 8 )
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* BUTTONS_DEF_H_ */
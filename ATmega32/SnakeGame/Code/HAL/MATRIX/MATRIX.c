@@ -0,0 +1,722 @@
+/****************************************************************************
+ * @file    MATRIX.c
+ * @author  Boles Medhat
+ * @brief   LED Matrix Driver Source File
+ * @version 1.0
+ * @date    [2024-12-07]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file implements the LED matrix driver. Every frame buffer holds one bit
+ * plane per brightness bit, each plane is MATRIX_HEIGHT rows of
+ * MATRIX_BYTES_PER_ROW bytes (bit x%8 of byte x/8 is the column x).
+ * In double buffer mode there are two frame buffers, the scan interrupt shows
+ * the front one and the drawing functions change the other one.
+ *
+ * Every Timer1 Compare Match A interrupt:
+ * 1. Latches the row and bit plane that was shifted out in the previous interrupt,
+ *    so the shifting time does not change the time a bit plane is shown.
+ * 2. Sets OCR1A to the weight of this bit plane (MATRIX_BCM_BASE_TICKS << plane).
+ * 3. Swaps the frame buffers at the end of a frame if a swap is requested.
+ * 4. Shifts out the next bit plane (or the next row) to be latched next time.
+ *
+ * All the drawing functions end in MATRIX_WriteMask(), which writes a whole
+ * byte of a row in every bit plane at once.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include "MATRIX.h"
+
+
+/* Frame buffers: bit planes of the pixels brightness (one buffer per MATRIX_BUFFERING) */
+static uint8 g_MATRIX_Buffers[ MATRIX_BUFFERING ][ MATRIX_BRIGHTNESS_BITS ][ MATRIX_HEIGHT ][ MATRIX_BYTES_PER_ROW ];
+
+/* Index of the shown frame buffer (the drawing one is MATRIX_BUFFERING - 1 - front) */
+static volatile uint8 g_MATRIX_Front = 0;
+
+/* Swap requested, done at the end of the current frame */
+static volatile bool g_MATRIX_SwapPending = false;
+
+/* Row and bit plane waiting in the shift registers to be latched */
+static uint8 g_MATRIX_Row   = 0;
+static uint8 g_MATRIX_Plane = 0;
+
+/* Number of scanned frames */
+static volatile uint16 g_MATRIX_FrameCount = 0;
+
+/* Timer1 ticks spent in the scan interrupt (current frame and last full frame) */
+static uint32 g_MATRIX_IsrTicksSum = 0;
+static volatile uint32 g_MATRIX_IsrTicksFrame = 0;
+
+
+static void MATRIX_ScanHandler( void );
+
+
+
+
+
+/*
+ * @brief Shifts out the row select and column bytes of one row and bit plane.
+ *
+ * The bytes are sent last first (the first register of the chain receives the
+ * last byte). Only the selected row is LOW, all other rows remain HIGH.
+ *
+ * @param row:   Row to be selected.
+ * @param plane: Bit plane of the columns data.
+ */
+static void MATRIX_ShiftRow( uint8 row , uint8 plane )
+{
+	uint8 byte_idx;
+
+	/* Send row select data */
+	for( byte_idx = MATRIX_ROW_BYTES ; byte_idx > 0 ; byte_idx-- )
+	{
+		SHIFT_OUT_Byte( ( ( byte_idx - 1 ) == ( row >> 3 ) ) ? (uint8)~( 1 << ( row & 7 ) ) : 0xFF );
+	}
+
+	/* Send column data of this row and bit plane from the shown frame buffer */
+	for( byte_idx = MATRIX_BYTES_PER_ROW ; byte_idx > 0 ; byte_idx-- )
+	{
+		SHIFT_OUT_Byte( g_MATRIX_Buffers[ g_MATRIX_Front ][ plane ][ row ][ byte_idx - 1 ] );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Writes the level to the masked pixels of one byte in every bit plane.
+ *
+ * @param row:      Row of the byte.
+ * @param byte_idx: Index of the byte in the row (columns byte_idx*8 to byte_idx*8 + 7).
+ * @param mask:     Pixels to be written (bit n is the column byte_idx*8 + n).
+ * @param level:    Brightness (from MATRIX_LEVEL_OFF to MATRIX_LEVEL_MAX).
+ */
+static void MATRIX_WriteMask( uint8 row , uint8 byte_idx , uint8 mask , uint8 level )
+{
+	uint8 back = MATRIX_BUFFERING - 1 - g_MATRIX_Front;
+
+	for( uint8 plane = 0 ; plane < MATRIX_BRIGHTNESS_BITS ; plane++ )
+	{
+		if ( GET_BIT( level , plane ) )
+		{
+			g_MATRIX_Buffers[ back ][ plane ][ row ][ byte_idx ] |= mask;
+		}
+		else
+		{
+			g_MATRIX_Buffers[ back ][ plane ][ row ][ byte_idx ] &= (uint8)~mask;
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Writes the level to the pixels from x0 to x1 of one row, a byte at a time.
+ *
+ * @param row:   Row of the pixels (inside the matrix).
+ * @param x0:    First column (inside the matrix).
+ * @param x1:    Last  column (inside the matrix, not less than x0).
+ * @param level: Brightness (from MATRIX_LEVEL_OFF to MATRIX_LEVEL_MAX).
+ */
+static void MATRIX_WriteSpan( uint8 row , uint8 x0 , uint8 x1 , uint8 level )
+{
+	uint8 first_byte = x0 >> 3;
+	uint8 last_byte  = x1 >> 3;
+	uint8 first_mask = (uint8)( 0xFF << ( x0 & 7 ) );
+	uint8 last_mask  = (uint8)( 0xFF >> ( 7 - ( x1 & 7 ) ) );
+
+	/* The Span is inside one Byte */
+	if ( first_byte == last_byte )
+	{
+		MATRIX_WriteMask( row , first_byte , first_mask & last_mask , level );
+	}
+	else
+	{
+		/* Partial first Byte, whole middle Bytes, then partial last Byte */
+		MATRIX_WriteMask( row , first_byte , first_mask , level );
+
+		for( uint8 byte_idx = first_byte + 1 ; byte_idx < last_byte ; byte_idx++ )
+		{
+			MATRIX_WriteMask( row , byte_idx , 0xFF , level );
+		}
+
+		MATRIX_WriteMask( row , last_byte , last_mask , level );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Initializes the LED matrix driver.
+ *
+ * This function initializes the shift-out pins, clears the frame buffers and
+ * registers the scan routine on the Timer1 Compare Match A interrupt.
+ */
+void MATRIX_Init( void )
+{
+	uint8 * buffer = &g_MATRIX_Buffers[ 0 ][ 0 ][ 0 ][ 0 ];
+
+	/* Initialize the Shift-Out Pins */
+	SHIFT_OUT_Init();
+
+	/* Turn off all the Pixels of all the Frame Buffers */
+	for( uint16 i = 0 ; i < sizeof( g_MATRIX_Buffers ) ; i++ )
+	{
+		buffer[ i ] = 0;
+	}
+
+	/* Prepare the first Row and Bit Plane to be latched by the first interrupt */
+	g_MATRIX_Front       = 0;
+	g_MATRIX_SwapPending = false;
+	g_MATRIX_Row         = 0;
+	g_MATRIX_Plane       = 0;
+	MATRIX_ShiftRow( g_MATRIX_Row , g_MATRIX_Plane );
+
+	/* Register the Scan Routine on Compare Match A Interrupt */
+	TIMER1_SetCallback( TIMER1_COMPA_ID , MATRIX_ScanHandler );
+}
+
+
+
+
+
+/*
+ * @brief Turns off all the pixels of the drawing frame.
+ */
+void MATRIX_Clear( void )
+{
+	uint8 * buffer = &g_MATRIX_Buffers[ MATRIX_BUFFERING - 1 - g_MATRIX_Front ][ 0 ][ 0 ][ 0 ];
+
+	/* Clear all the Bit Planes */
+	for( uint16 i = 0 ; i < sizeof( g_MATRIX_Buffers[ 0 ] ) ; i++ )
+	{
+		buffer[ i ] = 0;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Sets the brightness of one pixel.
+ *
+ * @param x:     Column of the pixel (from 0 to MATRIX_WIDTH  - 1).
+ * @param y:     Row    of the pixel (from 0 to MATRIX_HEIGHT - 1).
+ * @param level: Brightness (from MATRIX_LEVEL_OFF to MATRIX_LEVEL_MAX).
+ */
+void MATRIX_SetPixel( uint8 x , uint8 y , uint8 level )
+{
+	/* Check that the Pixel is inside the Matrix */
+	if ( ( x < MATRIX_WIDTH ) && ( y < MATRIX_HEIGHT ) )
+	{
+		MATRIX_WriteMask( y , x >> 3 , 1 << ( x & 7 ) , level );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Gets the brightness of one pixel of the drawing frame.
+ *
+ * @param x: Column of the pixel.
+ * @param y: Row    of the pixel.
+ *
+ * @return (uint8) Brightness (from MATRIX_LEVEL_OFF to MATRIX_LEVEL_MAX).
+ */
+uint8 MATRIX_GetPixel( uint8 x , uint8 y )
+{
+	uint8 back  = MATRIX_BUFFERING - 1 - g_MATRIX_Front;
+	uint8 level = MATRIX_LEVEL_OFF;
+
+	/* Check that the Pixel is inside the Matrix */
+	if ( ( x < MATRIX_WIDTH ) && ( y < MATRIX_HEIGHT ) )
+	{
+		/* Collect the Bits of the Level from the Bit Planes */
+		for( uint8 plane = 0 ; plane < MATRIX_BRIGHTNESS_BITS ; plane++ )
+		{
+			level |= GET_BIT( g_MATRIX_Buffers[ back ][ plane ][ y ][ x >> 3 ] , x & 7 ) << plane;
+		}
+	}
+
+	return level;
+}
+
+
+
+
+
+/*
+ * @brief Draws a line between two pixels (Bresenham).
+ *
+ * Horizontal lines are written a byte (8 pixels) at a time.
+ * Pixels outside the matrix are clipped.
+ *
+ * @param x0:    Column of the first pixel.
+ * @param y0:    Row    of the first pixel.
+ * @param x1:    Column of the last pixel.
+ * @param y1:    Row    of the last pixel.
+ * @param level: Brightness (from MATRIX_LEVEL_OFF to MATRIX_LEVEL_MAX).
+ */
+void MATRIX_DrawLine( uint8 x0 , uint8 y0 , uint8 x1 , uint8 y1 , uint8 level )
+{
+	/* Horizontal Line: write whole Bytes */
+	if ( y0 == y1 )
+	{
+		if ( x0 > x1 )
+		{
+			uint8 temp = x0;
+			x0 = x1;
+			x1 = temp;
+		}
+
+		MATRIX_FillRect( x0 , y0 , x1 - x0 + 1 , 1 , level );
+		return;
+	}
+
+	sint16 dx  = ( x1 > x0 ) ? ( x1 - x0 ) : ( x0 - x1 );
+	sint16 dy  = ( y1 > y0 ) ? ( y0 - y1 ) : ( y1 - y0 );
+	sint8  sx  = ( x1 > x0 ) ? 1 : -1;
+	sint8  sy  = ( y1 > y0 ) ? 1 : -1;
+	sint16 err = dx + dy;
+	sint16 err2;
+
+	/* Step on the major axis, and on the minor axis when the error crosses zero */
+	while ( 1 )
+	{
+		MATRIX_SetPixel( x0 , y0 , level );
+
+		if ( ( x0 == x1 ) && ( y0 == y1 ) )
+		{
+			break;
+		}
+
+		err2 = 2 * err;
+
+		if ( err2 >= dy )
+		{
+			err += dy;
+			x0  += sx;
+		}
+
+		if ( err2 <= dx )
+		{
+			err += dx;
+			y0  += sy;
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Draws the outline of a rectangle.
+ *
+ * @param x:      Column of the top left pixel.
+ * @param y:      Row    of the top left pixel.
+ * @param width:  Width  of the rectangle in pixels.
+ * @param height: Height of the rectangle in pixels.
+ * @param level:  Brightness (from MATRIX_LEVEL_OFF to MATRIX_LEVEL_MAX).
+ */
+void MATRIX_DrawRect( uint8 x , uint8 y , uint8 width , uint8 height , uint8 level )
+{
+	if ( ( width == 0 ) || ( height == 0 ) )
+	{
+		return;
+	}
+
+	/* Top and bottom edges (whole Bytes) */
+	MATRIX_FillRect( x , y , width , 1 , level );
+	MATRIX_FillRect( x , y + height - 1 , width , 1 , level );
+
+	/* Left and right edges */
+	MATRIX_FillRect( x , y , 1 , height , level );
+	MATRIX_FillRect( x + width - 1 , y , 1 , height , level );
+}
+
+
+
+
+
+/*
+ * @brief Fills a rectangle, a byte (8 pixels) of each row at a time.
+ *
+ * @param x:      Column of the top left pixel.
+ * @param y:      Row    of the top left pixel.
+ * @param width:  Width  of the rectangle in pixels.
+ * @param height: Height of the rectangle in pixels.
+ * @param level:  Brightness (from MATRIX_LEVEL_OFF to MATRIX_LEVEL_MAX).
+ */
+void MATRIX_FillRect( uint8 x , uint8 y , uint8 width , uint8 height , uint8 level )
+{
+	uint16 x_end = (uint16)x + width;
+	uint16 y_end = (uint16)y + height;
+
+	/* Clip the Rectangle to the Matrix */
+	if ( ( width == 0 ) || ( height == 0 ) || ( x >= MATRIX_WIDTH ) || ( y >= MATRIX_HEIGHT ) )
+	{
+		return;
+	}
+
+	if ( x_end > MATRIX_WIDTH )
+	{
+		x_end = MATRIX_WIDTH;
+	}
+
+	if ( y_end > MATRIX_HEIGHT )
+	{
+		y_end = MATRIX_HEIGHT;
+	}
+
+	/* Write the same Span in every Row */
+	for( uint8 row = y ; row < y_end ; row++ )
+	{
+		MATRIX_WriteSpan( row , x , x_end - 1 , level );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Draws a 1-bit sprite at any position.
+ *
+ * The sprite is stored row by row with (width + 7) / 8 bytes per row, bit c%8
+ * of byte c/8 is the column c (same packing as the frame). Every sprite byte
+ * is shifted to its position as a 16-bit word and written to two frame bytes.
+ * The set bits are drawn with the level, the cleared bits are transparent.
+ * The sprite may be partly (or fully) outside the matrix.
+ *
+ * @param x:      Column of the top left pixel (may be negative).
+ * @param y:      Row    of the top left pixel (may be negative).
+ * @param sprite: Pointer to the sprite bytes.
+ * @param width:  Width  of the sprite in pixels.
+ * @param height: Height of the sprite in pixels.
+ * @param level:  Brightness (from MATRIX_LEVEL_OFF to MATRIX_LEVEL_MAX).
+ */
+void MATRIX_DrawSprite( sint16 x , sint16 y , const uint8 * sprite , uint8 width , uint8 height , uint8 level )
+{
+	uint8  bytes_per_row = ( width + 7 ) >> 3;
+	uint8  bits;
+	uint16 word;
+	sint16 row;
+	sint16 column;
+
+	if ( sprite == NULL )
+	{
+		return;
+	}
+
+	for( uint8 sprite_row = 0 ; sprite_row < height ; sprite_row++ , sprite += bytes_per_row )
+	{
+		/* Skip the Rows outside the Matrix */
+		row = y + sprite_row;
+		if ( ( row < 0 ) || ( row >= MATRIX_HEIGHT ) )
+		{
+			continue;
+		}
+
+		for( uint8 byte_idx = 0 ; byte_idx < bytes_per_row ; byte_idx++ )
+		{
+			bits   = sprite[ byte_idx ];
+			column = x + ( byte_idx << 3 );
+
+			/* Remove the padding Bits after the last Column of the Sprite */
+			if ( ( byte_idx == bytes_per_row - 1 ) && ( width & 7 ) )
+			{
+				bits &= (uint8)( 0xFF >> ( 8 - ( width & 7 ) ) );
+			}
+
+			/* Stop at the right edge, skip Bytes fully left of the Matrix */
+			if ( column >= MATRIX_WIDTH )
+			{
+				break;
+			}
+			if ( column <= -8 )
+			{
+				continue;
+			}
+
+			/* Clip the Columns left of the Matrix */
+			if ( column < 0 )
+			{
+				bits >>= -column;
+				column = 0;
+			}
+
+			/* Shift the Byte to its Column as a Word: low Byte and high Byte of the Frame */
+			word = (uint16)bits << ( column & 7 );
+
+			if ( (uint8)word )
+			{
+				MATRIX_WriteMask( row , column >> 3 , (uint8)word , level );
+			}
+
+			if ( ( word >> 8 ) && ( ( column >> 3 ) + 1 < MATRIX_BYTES_PER_ROW ) )
+			{
+				MATRIX_WriteMask( row , ( column >> 3 ) + 1 , (uint8)( word >> 8 ) , level );
+			}
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Moves the whole drawing frame one pixel, the empty column or row is turned off.
+ *
+ * @param direction: Scroll direction [ MATRIX_SCROLL_LEFT , MATRIX_SCROLL_RIGHT , MATRIX_SCROLL_UP , MATRIX_SCROLL_DOWN ].
+ */
+void MATRIX_Scroll( uint8 direction )
+{
+	uint8 back = MATRIX_BUFFERING - 1 - g_MATRIX_Front;
+	uint8 byte_idx;
+	uint8 row;
+
+	for( uint8 plane = 0 ; plane < MATRIX_BRIGHTNESS_BITS ; plane++ )
+	{
+		uint8 ( * rows )[ MATRIX_BYTES_PER_ROW ] = g_MATRIX_Buffers[ back ][ plane ];
+
+		switch ( direction )
+		{
+			/* Column x takes column x + 1: shift right every Byte, carry in the first Bit of the next one */
+			case MATRIX_SCROLL_LEFT:
+				for( row = 0 ; row < MATRIX_HEIGHT ; row++ )
+				{
+					for( byte_idx = 0 ; byte_idx < MATRIX_BYTES_PER_ROW - 1 ; byte_idx++ )
+					{
+						rows[ row ][ byte_idx ] = ( rows[ row ][ byte_idx ] >> 1 ) | (uint8)( rows[ row ][ byte_idx + 1 ] << 7 );
+					}
+					rows[ row ][ byte_idx ] >>= 1;
+				}
+				break;
+
+			/* Column x takes column x - 1: shift left every Byte, carry in the last Bit of the previous one */
+			case MATRIX_SCROLL_RIGHT:
+				for( row = 0 ; row < MATRIX_HEIGHT ; row++ )
+				{
+					for( byte_idx = MATRIX_BYTES_PER_ROW - 1 ; byte_idx > 0 ; byte_idx-- )
+					{
+						rows[ row ][ byte_idx ] = (uint8)( rows[ row ][ byte_idx ] << 1 ) | ( rows[ row ][ byte_idx - 1 ] >> 7 );
+					}
+					rows[ row ][ 0 ] = (uint8)( rows[ row ][ 0 ] << 1 );
+				}
+				break;
+
+			/* Row y takes row y + 1, the last row is cleared */
+			case MATRIX_SCROLL_UP:
+				for( row = 0 ; row < MATRIX_HEIGHT ; row++ )
+				{
+					for( byte_idx = 0 ; byte_idx < MATRIX_BYTES_PER_ROW ; byte_idx++ )
+					{
+						rows[ row ][ byte_idx ] = ( row < MATRIX_HEIGHT - 1 ) ? rows[ row + 1 ][ byte_idx ] : 0;
+					}
+				}
+				break;
+
+			/* Row y takes row y - 1, the first row is cleared */
+			case MATRIX_SCROLL_DOWN:
+				for( row = MATRIX_HEIGHT ; row > 0 ; row-- )
+				{
+					for( byte_idx = 0 ; byte_idx < MATRIX_BYTES_PER_ROW ; byte_idx++ )
+					{
+						rows[ row - 1 ][ byte_idx ] = ( row > 1 ) ? rows[ row - 2 ][ byte_idx ] : 0;
+					}
+				}
+				break;
+
+			default:
+				break;
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Requests to show the drawing frame when the scan of the current frame ends.
+ *
+ * The swap is done by the scan interrupt between two frames, so a half drawn
+ * frame is never seen. After the swap the drawing frame holds the previously
+ * shown frame, call MATRIX_CopyFront() to continue from the shown frame.
+ * In single buffer mode this function does nothing.
+ */
+void MATRIX_Swap( void )
+{
+	#if MATRIX_BUFFERING == MATRIX_DOUBLE_BUFFER
+
+		g_MATRIX_SwapPending = true;
+
+	#endif
+}
+
+
+
+
+
+/*
+ * @brief Checks if a requested swap is still waiting for the end of the frame.
+ *
+ * @return (bool) true if the swap is not done yet, false otherwise.
+ */
+bool MATRIX_IsSwapPending( void )
+{
+	return g_MATRIX_SwapPending;
+}
+
+
+
+
+
+/*
+ * @brief Copies the shown frame to the drawing frame.
+ *
+ * Used to change the shown frame a little (for example MATRIX_Scroll) instead
+ * of drawing all of it again. In single buffer mode this function does nothing.
+ */
+void MATRIX_CopyFront( void )
+{
+	#if MATRIX_BUFFERING == MATRIX_DOUBLE_BUFFER
+
+		uint8 front = g_MATRIX_Front;
+		uint8 * source      = &g_MATRIX_Buffers[ front ][ 0 ][ 0 ][ 0 ];
+		uint8 * destination = &g_MATRIX_Buffers[ 1 - front ][ 0 ][ 0 ][ 0 ];
+
+		for( uint16 i = 0 ; i < sizeof( g_MATRIX_Buffers[ 0 ] ) ; i++ )
+		{
+			destination[ i ] = source[ i ];
+		}
+
+	#endif
+}
+
+
+
+
+
+/*
+ * @brief Gets the number of frames scanned since initialization.
+ *
+ * The value changes once per full scan of the matrix, so it can be used as
+ * the time base of the application (it wraps around after 65535).
+ *
+ * @return (uint16) Number of scanned frames.
+ */
+uint16 MATRIX_GetFrameCount( void )
+{
+	/* Save global interrupt flag */
+	uint8 sreg = SREG;
+
+	/* Disable global interrupt to read the 16-bit value at once */
+	CLR_BIT( SREG , I );
+
+	uint16 frames = g_MATRIX_FrameCount;
+
+	/* Restore global interrupt flag */
+	SREG = sreg;
+
+	return frames;
+}
+
+
+
+
+
+/*
+ * @brief Gets the measured CPU load of the scan interrupt.
+ *
+ * The time of every scan interrupt is measured with TCNT1 and summed for the
+ * last full frame, then compared with the frame time (MATRIX_FRAME_TICKS).
+ *
+ * @return (uint8) Percentage of the CPU time used by the scan interrupt in the last frame.
+ */
+uint8 MATRIX_GetIsrLoad( void )
+{
+	/* Save global interrupt flag */
+	uint8 sreg = SREG;
+
+	/* Disable global interrupt to read the 32-bit value at once */
+	CLR_BIT( SREG , I );
+
+	uint32 ticks = g_MATRIX_IsrTicksFrame;
+
+	/* Restore global interrupt flag */
+	SREG = sreg;
+
+	/* Convert to a percentage of the frame time */
+	ticks = ( ticks * 100 ) / MATRIX_FRAME_TICKS;
+
+	return ( ticks > 100 ) ? 100 : (uint8)ticks;
+}
+
+
+
+
+
+/*
+ * @brief Timer1 Compare Match A callback that scans the matrix.
+ *
+ * Latches the prepared bit plane, keeps it for its weight, then shifts out
+ * the next bit plane. The whole scan of a frame needs only
+ * MATRIX_HEIGHT * MATRIX_BRIGHTNESS_BITS interrupts for 2^bits levels.
+ */
+static void MATRIX_ScanHandler( void )
+{
+	/* Show the Row and Bit Plane shifted out in the previous interrupt */
+	SHIFT_OUT_Latch();
+
+	/* Keep it for a time proportional to the weight of its Bit Plane */
+	TIMER1_SetCompare_A_Value( ( (uint16)MATRIX_BCM_BASE_TICKS << g_MATRIX_Plane ) - 1 );
+
+	/* Move to the next Bit Plane, then to the next Row */
+	g_MATRIX_Plane++;
+	if ( g_MATRIX_Plane >= MATRIX_BRIGHTNESS_BITS )
+	{
+		g_MATRIX_Plane = 0;
+		g_MATRIX_Row++;
+
+		/* End of Frame */
+		if ( g_MATRIX_Row >= MATRIX_HEIGHT )
+		{
+			g_MATRIX_Row = 0;
+			g_MATRIX_FrameCount++;
+
+			/* Show the drawing Frame Buffer from the next Frame (vsync swap) */
+			if ( g_MATRIX_SwapPending )
+			{
+				g_MATRIX_Front ^= 1;
+				g_MATRIX_SwapPending = false;
+			}
+
+			/* Store the ISR time of the finished frame */
+			g_MATRIX_IsrTicksFrame = g_MATRIX_IsrTicksSum;
+			g_MATRIX_IsrTicksSum   = 0;
+		}
+	}
+
+	/* Prepare the next Row and Bit Plane in the shift registers */
+	MATRIX_ShiftRow( g_MATRIX_Row , g_MATRIX_Plane );
+
+	/* Measure the ISR time (TCNT1 restarted from 0 at the compare match) */
+	g_MATRIX_IsrTicksSum += TIMER1_GetTimerValue();
+}
@@ -0,0 +1,208 @@
+/****************************************************************************
+ * @file    MATRIX.h
+ * @author  Boles Medhat
+ * @brief   LED Matrix Driver Header File
+ * @version 1.0
+ * @date    [2024-12-07]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file provides an abstraction for an LED matrix driven by chained
+ * 74HC595 shift registers (row select registers, then column registers).
+ * The matrix is scanned in the background from the Timer1 Compare Match A
+ * interrupt with binary code modulation (BCM): every pixel has
+ * MATRIX_BRIGHTNESS_BITS of brightness, stored as bit planes, and every bit
+ * plane of a row is shown for a time proportional to its weight.
+ *
+ * The frame is bit packed (bit x%8 of byte x/8 is the column x), so lines,
+ * rectangles, sprites and scrolling are drawn 8 or 16 pixels at a time.
+ * In double buffer mode all the drawing functions change the back frame,
+ * and MATRIX_Swap() shows it when the scan of the current frame ends (vsync).
+ *
+ * @note
+ * - ⚠️ IMPORTANT: You must initialize the TIMER1 module **after** calling MATRIX_Init.
+ * 				   This driver does not initialize TIMER1 module internally.
+ * - Do not use SHIFT_OUT functions outside this driver, they are used by the ISR.
+ * - In double buffer mode, do not draw while MATRIX_IsSwapPending() is true.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef MATRIX_H_
+#define MATRIX_H_
+
+#include "../../MCAL/TIMER1/TIMER1.h"
+#include "../ShiftRegister/Shift.h"
+#include "MATRIX_config.h"
+
+
+/*
+ * @brief Initializes the LED matrix driver.
+ *
+ * This function initializes the shift-out pins, clears the frame buffers and
+ * registers the scan routine on the Timer1 Compare Match A interrupt.
+ */
+void MATRIX_Init( void );
+
+
+
+/*
+ * @brief Turns off all the pixels of the drawing frame.
+ */
+void MATRIX_Clear( void );
+
+
+
+/*
+ * @brief Sets the brightness of one pixel.
+ *
+ * @param x:     Column of the pixel (from 0 to MATRIX_WIDTH  - 1).
+ * @param y:     Row    of the pixel (from 0 to MATRIX_HEIGHT - 1).
+ * @param level: Brightness (from MATRIX_LEVEL_OFF to MATRIX_LEVEL_MAX).
+ */
+void MATRIX_SetPixel( uint8 x , uint8 y , uint8 level );
+
+
+
+/*
+ * @brief Gets the brightness of one pixel of the drawing frame.
+ *
+ * @param x: Column of the pixel.
+ * @param y: Row    of the pixel.
+ *
+ * @return (uint8) Brightness (from MATRIX_LEVEL_OFF to MATRIX_LEVEL_MAX).
+ */
+uint8 MATRIX_GetPixel( uint8 x , uint8 y );
+
+
+
+/*
+ * @brief Draws a line between two pixels (Bresenham).
+ *
+ * Horizontal lines are written a byte (8 pixels) at a time.
+ * Pixels outside the matrix are clipped.
+ *
+ * @param x0:    Column of the first pixel.
+ * @param y0:    Row    of the first pixel.
+ * @param x1:    Column of the last pixel.
+ * @param y1:    Row    of the last pixel.
+ * @param level: Brightness (from MATRIX_LEVEL_OFF to MATRIX_LEVEL_MAX).
+ */
+void MATRIX_DrawLine( uint8 x0 , uint8 y0 , uint8 x1 , uint8 y1 , uint8 level );
+
+
+
+/*
+ * @brief Draws the outline of a rectangle.
+ *
+ * @param x:      Column of the top left pixel.
+ * @param y:      Row    of the top left pixel.
+ * @param width:  Width  of the rectangle in pixels.
+ * @param height: Height of the rectangle in pixels.
+ * @param level:  Brightness (from MATRIX_LEVEL_OFF to MATRIX_LEVEL_MAX).
+ */
+void MATRIX_DrawRect( uint8 x , uint8 y , uint8 width , uint8 height , uint8 level );
+
+
+
+/*
+ * @brief Fills a rectangle, a byte (8 pixels) of each row at a time.
+ *
+ * @param x:      Column of the top left pixel.
+ * @param y:      Row    of the top left pixel.
+ * @param width:  Width  of the rectangle in pixels.
+ * @param height: Height of the rectangle in pixels.
+ * @param level:  Brightness (from MATRIX_LEVEL_OFF to MATRIX_LEVEL_MAX).
+ */
+void MATRIX_FillRect( uint8 x , uint8 y , uint8 width , uint8 height , uint8 level );
+
+
+
+/*
+ * @brief Draws a 1-bit sprite at any position.
+ *
+ * The sprite is stored row by row with (width + 7) / 8 bytes per row, bit c%8
+ * of byte c/8 is the column c (same packing as the frame). Every sprite byte
+ * is shifted to its position as a 16-bit word and written to two frame bytes.
+ * The set bits are drawn with the level, the cleared bits are transparent.
+ * The sprite may be partly (or fully) outside the matrix.
+ *
+ * @param x:      Column of the top left pixel (may be negative).
+ * @param y:      Row    of the top left pixel (may be negative).
+ * @param sprite: Pointer to the sprite bytes.
+ * @param width:  Width  of the sprite in pixels.
+ * @param height: Height of the sprite in pixels.
+ * @param level:  Brightness (from MATRIX_LEVEL_OFF to MATRIX_LEVEL_MAX).
+ */
+void MATRIX_DrawSprite( sint16 x , sint16 y , const uint8 * sprite , uint8 width , uint8 height , uint8 level );
+
+
+
+/*
+ * @brief Moves the whole drawing frame one pixel, the empty column or row is turned off.
+ *
+ * @param direction: Scroll direction [ MATRIX_SCROLL_LEFT , MATRIX_SCROLL_RIGHT , MATRIX_SCROLL_UP , MATRIX_SCROLL_DOWN ].
+ */
+void MATRIX_Scroll( uint8 direction );
+
+
+
+/*
+ * @brief Requests to show the drawing frame when the scan of the current frame ends.
+ *
+ * The swap is done by the scan interrupt between two frames, so a half drawn
+ * frame is never seen. After the swap the drawing frame holds the previously
+ * shown frame, call MATRIX_CopyFront() to continue from the shown frame.
+ * In single buffer mode this function does nothing.
+ */
+void MATRIX_Swap( void );
+
+
+
+/*
+ * @brief Checks if a requested swap is still waiting for the end of the frame.
+ *
+ * @return (bool) true if the swap is not done yet, false otherwise.
+ */
+bool MATRIX_IsSwapPending( void );
+
+
+
+/*
+ * @brief Copies the shown frame to the drawing frame.
+ *
+ * Used to change the shown frame a little (for example MATRIX_Scroll) instead
+ * of drawing all of it again. In single buffer mode this function does nothing.
+ */
+void MATRIX_CopyFront( void );
+
+
+
+/*
+ * @brief Gets the number of frames scanned since initialization.
+ *
+ * The value changes once per full scan of the matrix, so it can be used as
+ * the time base of the application (it wraps around after 65535).
+ *
+ * @return (uint16) Number of scanned frames.
+ */
+uint16 MATRIX_GetFrameCount( void );
+
+
+
+/*
+ * @brief Gets the measured CPU load of the scan interrupt.
+ *
+ * The time of every scan interrupt is measured with TCNT1 and summed for the
+ * last full frame, then compared with the frame time (MATRIX_FRAME_TICKS).
+ *
+ * @return (uint8) Percentage of the CPU time used by the scan interrupt in the last frame.
+ */
+uint8 MATRIX_GetIsrLoad( void );
+
+
+#endif /* MATRIX_H_ */
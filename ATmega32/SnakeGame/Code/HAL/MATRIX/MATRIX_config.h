@@ -0,0 +1,91 @@
+/****************************************************************************
+ * @file    MATRIX_config.h
+ * @author  Boles Medhat
+ * @brief   LED Matrix Driver Configuration Header File
+ * @version 1.0
+ * @date    [2024-12-07]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @note
+ * - ⚠️ IMPORTANT: You must initialize the TIMER1 module in TIMER1_CTC_OCR1A_MODE mode
+ * 				   with the Compare Match A interrupt enabled. This driver does not
+ * 				   initialize TIMER1 module internally.
+ * - The 74HC595 pins are set in `Shift_config.h`.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef MATRIX_CONFIG_H_
+#define MATRIX_CONFIG_H_
+
+#include "MATRIX_def.h"
+#include "../../MCAL/TIMER1/TIMER1.h"
+
+
+/*Set the width and height of the matrix in pixels (multiples of 8 up to 248)*/
+#define MATRIX_WIDTH						16
+#define MATRIX_HEIGHT						16
+
+
+/*Set the number of brightness bits per pixel (from 1 to 4)
+ * every row is shown once per bit (bit plane), the bit plane n is shown for
+ * (MATRIX_BCM_BASE_TICKS << n) ticks, so 2^bits levels cost only "bits" interrupts per row
+ */
+#define MATRIX_BRIGHTNESS_BITS				2
+
+
+/*Set the frame buffering
+ * choose between:
+ * 1. MATRIX_SINGLE_BUFFER		: drawing functions change the displayed frame directly (half drawn frames may be seen)
+ * 2. MATRIX_DOUBLE_BUFFER		: drawing functions change a back frame, MATRIX_Swap() shows it at the end of the current scan
+ */
+#define MATRIX_BUFFERING					MATRIX_DOUBLE_BUFFER
+
+
+/*Set the Timer1 ticks of the least significant bit plane
+ * it must be longer than the time of shifting out one row (row and column bytes),
+ * refresh rate = F_CPU / ( TIMER1_PRESCALER * MATRIX_FRAME_TICKS )
+ * (800 ticks = 400us at 16MHz/8, 2 bits, 16 rows: 19.2ms frame = 52Hz)
+ */
+#define MATRIX_BCM_BASE_TICKS				800
+
+
+/* You must initialize Timer1 manually "TIMER1_Init()" before using this driver */
+#ifndef TIMER1_IN_HAL
+#define TIMER1_IN_HAL
+	#warning "⚠️ Initialize Timer1 manually before using this driver."
+#endif
+
+/* Configure Timer1 to CTC mode (OCR1A is the period of the bit plane) */
+#if TIMER1_WAVEFORM_GENERATION_MODE != TIMER1_CTC_OCR1A_MODE
+	#warning "⚠️ Configure Timer1 in TIMER1_CTC_OCR1A_MODE mode."
+#endif
+
+/* The Matrix is scanned from the Compare Match A Interrupt */
+#if TIMER1_COMPA_INT_STATUS != TIMER1_COMPA_INT_ENABLE
+	#warning "⚠️ Enable Timer1 Compare Match A Interrupt."
+#endif
+
+#if ( MATRIX_BRIGHTNESS_BITS < 1 ) || ( MATRIX_BRIGHTNESS_BITS > 4 )
+	#error "Wrong \"MATRIX_BRIGHTNESS_BITS\" configuration option"
+#endif
+
+#if ( MATRIX_BUFFERING != MATRIX_SINGLE_BUFFER ) && ( MATRIX_BUFFERING != MATRIX_DOUBLE_BUFFER )
+	#error "Wrong \"MATRIX_BUFFERING\" configuration option"
+#endif
+
+#if ( MATRIX_WIDTH % 8 ) != 0 || ( MATRIX_HEIGHT % 8 ) != 0 || MATRIX_WIDTH > 248 || MATRIX_HEIGHT > 248
+	#error "MATRIX_WIDTH and MATRIX_HEIGHT must be multiples of 8 up to 248"
+#endif
+
+/* The longest bit plane must fit in the 16-bit OCR1A */
+#if ( MATRIX_BCM_BASE_TICKS * ( 1UL << ( MATRIX_BRIGHTNESS_BITS - 1 ) ) ) > 65535
+	#error "MATRIX_BCM_BASE_TICKS is too big for MATRIX_BRIGHTNESS_BITS"
+#endif
+
+
+#endif /* MATRIX_CONFIG_H_ */
@@ -0,0 +1,56 @@
+/****************************************************************************
+ * @file    MATRIX_def.h
+ * @author  Boles Medhat
+ * @brief   LED Matrix Driver Definitions Header File
+ * @version 1.0
+ * @date    [2024-12-07]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the macro definitions and constants used by the LED
+ * Matrix Driver (74HC595 rows and columns, binary code modulation brightness).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef MATRIX_DEF_H_
+#define MATRIX_DEF_H_
+
+#include "../../LIB/STD_TYPES.h"
+
+
+/*------------------------------------------   modes    -----------------------------------------*/
+
+/*Frame buffering (the value is the number of frame buffers)*/
+#define MATRIX_SINGLE_BUFFER				1			/*Draw directly on the displayed frame*/
+#define MATRIX_DOUBLE_BUFFER				2			/*Draw on a back frame and show it with MATRIX_Swap()*/
+
+/*Scroll directions*/
+#define MATRIX_SCROLL_LEFT					0			/*Move the frame one column to the left*/
+#define MATRIX_SCROLL_RIGHT					1			/*Move the frame one column to the right*/
+#define MATRIX_SCROLL_UP					2			/*Move the frame one row up*/
+#define MATRIX_SCROLL_DOWN					3			/*Move the frame one row down*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Brightness levels*/
+#define MATRIX_LEVEL_OFF					0											/*Pixel is off*/
+#define MATRIX_LEVEL_MAX					( ( 1 << MATRIX_BRIGHTNESS_BITS ) - 1 )		/*Pixel at full brightness*/
+
+/*Frame buffer size*/
+#define MATRIX_BYTES_PER_ROW				( MATRIX_WIDTH / 8 )						/*Number of bytes (74HC595 column registers) per row*/
+#define MATRIX_ROW_BYTES					( MATRIX_HEIGHT / 8 )						/*Number of 74HC595 row registers*/
+
+/*Timer1 ticks of one full frame (each row is shown for 1 + 2 + 4 + ... base times)*/
+#define MATRIX_FRAME_TICKS					( (uint32)MATRIX_HEIGHT * MATRIX_LEVEL_MAX * MATRIX_BCM_BASE_TICKS )
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* MATRIX_DEF_H_ */
@@ -96,10 +96,10 @@ void ADC_Init(void)
         CLR_BIT(ADCSRA, ADATE);
 
         /* Clear the ADC auto trigger source bits */
-        SFIOR &= ADC_AUTO_TRIG_clr_msk;
+        ADC_TRIG_REG &= ADC_AUTO_TRIG_clr_msk;
 
         /* Set the ADC auto trigger source bits */
-        SFIOR |= ADC_AUTO_TRIG_SRC;
+        ADC_TRIG_REG |= ADC_AUTO_TRIG_SRC;
 
         /* Enable ADC auto trigger */
         SET_BIT(ADCSRA, ADATE);
@@ -355,17 +355,17 @@ void ADC_Disable ( void )
 /*
  * @brief Enables ADC Auto Triggering.
  *
- * This function enables ADC auto triggering by setting the appropriate bits in the ADCSRA and SFIOR registers.
+ * This function enables ADC auto triggering by setting the appropriate bits in the ADCSRA and SFIOR (ADCSRB) registers.
  */
 void ADC_AutoTriggerEnable ( void )
 {
 	/* Enable ADC Auto Trigger */
 
 	/* Clear the ADC AUTO TRIGGER Source Bits */
-	SFIOR &= ADC_AUTO_TRIG_clr_msk;
+	ADC_TRIG_REG &= ADC_AUTO_TRIG_clr_msk;
 
 	/* Set the ADC AUTO TRIGGER Source Bits */
-	SFIOR |= ADC_AUTO_TRIG_SRC;
+	ADC_TRIG_REG |= ADC_AUTO_TRIG_SRC;
 
 	/* Enable ADC Auto Trigger */
 	SET_BIT( ADCSRA , ADATE );
@@ -458,8 +458,8 @@ void ADC_SetCallback( void (*CopyFuncPtr)(uint16) )
  *
  * @see ADC_SetCallback for setting the callback function.
  */
-void __vector_16(void)		__attribute__((signal));
-void __vector_16(void)
+void DEVICE_ADC_VECTOR(void)		__attribute__((signal));
+void DEVICE_ADC_VECTOR(void)
 {
 
 	/* Check that the pointer is valid */
@@ -117,7 +117,7 @@ void ADC_Disable( void );
 /*
  * @brief Enables ADC Auto Triggering.
  *
- * This function enables ADC auto triggering by setting the appropriate bits in the ADCSRA and SFIOR registers.
+ * This function enables ADC auto triggering by setting the appropriate bits in the ADCSRA and SFIOR (ADCSRB) registers.
  */
 void ADC_AutoTriggerEnable( void );
 
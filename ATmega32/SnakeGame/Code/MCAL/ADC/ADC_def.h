@@ -26,19 +26,20 @@
 #define ADC_DEF_H_
 
 #include "../../LIB/STD_TYPES.h"
+#include "../DEVICE/DEVICE.h"
 
 
 /*---------------------------------------    Registers    ---------------------------------------*/
 
 /*ADC Registers*/
-#define ADC									*((volatile uint16 *)0x24)	/*ADC 10-bit Result Register (combined ADCL and ADCH)*/
-#define ADCL								*((volatile uint8 *)0x24)	/*ADC 8 BIT LOW Register*/
-#define ADCH								*((volatile uint8 *)0x25)	/*ADC 8 BIT HIGH Register*/
+#define ADC									*((volatile uint16 *)DEVICE_ADCL)	/*ADC 10-bit Result Register (combined ADCL and ADCH)*/
+#define ADCL								*((volatile uint8 *)DEVICE_ADCL)	/*ADC 8 BIT LOW Register*/
+#define ADCH								*((volatile uint8 *)DEVICE_ADCH)	/*ADC 8 BIT HIGH Register*/
 
 /*ADC Control Registers*/
-#define ADCSRA								*((volatile uint8 *)0x26)	/*ADC Control and Status Register A*/
-#define ADMUX								*((volatile uint8 *)0x27)	/*ADC Multiplexer Selection Register*/
-#define SFIOR								*((volatile uint8 *)0x50)	/*Special Function I/O Register*/
+#define ADCSRA								*((volatile uint8 *)DEVICE_ADCSRA)	/*ADC Control and Status Register A*/
+#define ADMUX								*((volatile uint8 *)DEVICE_ADMUX)	/*ADC Multiplexer Selection Register*/
+#define ADC_TRIG_REG							*((volatile uint8 *)DEVICE_ADC_TRIGGER)	/*ADC Auto Trigger Source Register (SFIOR or ADCSRB)*/
 
 /*Interrupt Register*/
 #define SREG								*((volatile uint8 *)0x5F)	/*status register*/
@@ -68,10 +69,10 @@
 #define REFS0								6	/*Reference Selection Bit 0*/
 #define REFS1								7	/*Reference Selection Bit 1*/
 
-/*SFIOR Register*/
-#define ADTS0								5	/*ADC Auto Trigger Source Bit 0*/
-#define ADTS1								6	/*ADC Auto Trigger Source Bit 1*/
-#define ADTS2								7	/*ADC Auto Trigger Source Bit 2*/
+/*SFIOR (ATmega32) or ADCSRB (ATmega644P/1284P) Register*/
+#define ADTS0								DEVICE_ADTS0				/*ADC Auto Trigger Source Bit 0*/
+#define ADTS1								( DEVICE_ADTS0 + 1 )		/*ADC Auto Trigger Source Bit 1*/
+#define ADTS2								( DEVICE_ADTS0 + 2 )		/*ADC Auto Trigger Source Bit 2*/
 
 /*SREG Register*/
 #define	I									7	/*Global Interrupt Enable*/
@@ -154,14 +155,14 @@
 #define ADC_MODE_AUTO_TRIGGER				1		/*Auto Trigger Enable*/
 
 /*ADC AUTO TRIGGER Source*/
-#define ADC_ATS_FREE_RUNNING_msk			0x00	/*(0000 0000)	Free Running mode*/
-#define ADC_ATS_ANALOG_COMP_msk				0x20	/*(0010 0000)	Analog Comparator*/
-#define ADC_ATS_EXTI0_msk					0x40	/*(0100 0000)	External Interrupt Request 0*/
-#define ADC_ATS_TIMER0_COMP_msk				0x60	/*(0110 0000)	Timer/Counter0 Compare Match*/
-#define ADC_ATS_TIMER0_OVF_msk				0x80	/*(1000 0000)	Timer/Counter0 Overflow*/
-#define ADC_ATS_TIMER1_COMP_msk				0xA0	/*(1010 0000)	Timer/Counter1 Compare Match B*/
-#define ADC_ATS_TIMER1_OVF_msk				0xC0	/*(1100 0000)	Timer/Counter1 Overflow*/
-#define ADC_ATS_TIMER1_CAPT_msk				0xE0	/*(1110 0000)	Timer/Counter1 Capture Event*/
+#define ADC_ATS_FREE_RUNNING_msk			( 0 << ADTS0 )	/*Free Running mode*/
+#define ADC_ATS_ANALOG_COMP_msk				( 1 << ADTS0 )	/*Analog Comparator*/
+#define ADC_ATS_EXTI0_msk					( 2 << ADTS0 )	/*External Interrupt Request 0*/
+#define ADC_ATS_TIMER0_COMP_msk				( 3 << ADTS0 )	/*Timer/Counter0 Compare Match*/
+#define ADC_ATS_TIMER0_OVF_msk				( 4 << ADTS0 )	/*Timer/Counter0 Overflow*/
+#define ADC_ATS_TIMER1_COMP_msk				( 5 << ADTS0 )	/*Timer/Counter1 Compare Match B*/
+#define ADC_ATS_TIMER1_OVF_msk				( 6 << ADTS0 )	/*Timer/Counter1 Overflow*/
+#define ADC_ATS_TIMER1_CAPT_msk				( 7 << ADTS0 )	/*Timer/Counter1 Capture Event*/
 
 /*ADC prescaler*/
 #define ADC_PRESCALER_2_msk					0x00	/*ADC Frequency = F_CPU / 2	  (CLK/2)*/
@@ -179,7 +180,7 @@
 
 #define ADC_PRESCALER_clr_msk 				0xF8	/*ADC PRESCALER Clear mask*/
 #define ADC_CHANNEL_clr_msk 				0xE0	/*ADC channel clear mask*/
-#define ADC_AUTO_TRIG_clr_msk 				0x1F	/*ADC AUTO TRIGGER Source clear mask*/
+#define ADC_AUTO_TRIG_clr_msk 				( (uint8)~( 0x07 << ADTS0 ) )	/*ADC AUTO TRIGGER Source clear mask*/
 /*_______________________________________________________________________________________________*/
 
 
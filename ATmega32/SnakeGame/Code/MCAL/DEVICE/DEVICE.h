@@ -0,0 +1,159 @@
+/****************************************************************************
+ * @file    DEVICE.h
+ * @author  Boles Medhat
+ * @brief   Device Register Map Header File - AVR ATmega32/644P/1284P
+ * @version 1.0
+ * @date    [2024-12-07]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file maps the registers, bits and interrupt vectors that differ
+ * between the supported microcontrollers, so the same MCAL drivers run on
+ * the ATmega32 and on the pin compatible ATmega644P/1284P (more RAM, flash
+ * and EEPROM for bigger buffers).
+ *
+ * The drivers define their registers with these addresses (DIO, ADC,
+ * TIMER1, WDT), the bit positions that moved, and the ISR names
+ * (`void DEVICE_ADC_VECTOR (void) __attribute__((signal));`).
+ * The applications can size their buffers with DEVICE_RAM_SIZE.
+ *
+ * @note
+ * - The differences handled by the drivers:
+ *   ADC auto trigger source in SFIOR (ATmega32) or ADCSRB (644P/1284P),
+ *   TIMER1 interrupts in TIMSK/TIFR (shared) or TIMSK1/TIFR1 (own bits),
+ *   WDT time-out change with a timed sequence on the 644P/1284P.
+ * - Scope: only the drivers of this project (DIO, ADC, TIMER1, WDT). The
+ *   UART, TIMER0/TIMER2 and EEPROM drivers of PID_Motor and delivery_car keep
+ *   the ATmega32 registers and vector numbers (UART __vector_13/__vector_15,
+ *   one USART, the 644P/1284P second USART is not mapped), and their
+ *   APP_config.h stops a build for another microcontroller.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ******************************************************************************/
+
+#ifndef DEVICE_H_
+#define DEVICE_H_
+
+#include "DEVICE_config.h"
+
+
+#if DEVICE_MCU == DEVICE_ATMEGA32
+
+	/*Memories*/
+	#define DEVICE_FLASH_SIZE				32768UL
+	#define DEVICE_RAM_SIZE					2048
+	#define DEVICE_EEPROM_SIZE				1024
+
+	/*DIO Registers*/
+	#define DEVICE_PINA						0x39
+	#define DEVICE_DDRA						0x3A
+	#define DEVICE_PORTA					0x3B
+	#define DEVICE_PINB						0x36
+	#define DEVICE_DDRB						0x37
+	#define DEVICE_PORTB					0x38
+	#define DEVICE_PINC						0x33
+	#define DEVICE_DDRC						0x34
+	#define DEVICE_PORTC					0x35
+	#define DEVICE_PIND						0x30
+	#define DEVICE_DDRD						0x31
+	#define DEVICE_PORTD					0x32
+
+	/*ADC Registers*/
+	#define DEVICE_ADCL						0x24
+	#define DEVICE_ADCH						0x25
+	#define DEVICE_ADCSRA					0x26
+	#define DEVICE_ADMUX					0x27
+	#define DEVICE_ADC_TRIGGER				0x50	/*SFIOR*/
+	#define DEVICE_ADTS0					5		/*First auto trigger source bit*/
+	#define DEVICE_ADC_VECTOR				__vector_16
+
+	/*TIMER1 Registers*/
+	#define DEVICE_ICR1						0x46
+	#define DEVICE_OCR1B					0x48
+	#define DEVICE_OCR1A					0x4A
+	#define DEVICE_TCNT1					0x4C
+	#define DEVICE_TCCR1B					0x4E
+	#define DEVICE_TCCR1A					0x4F
+	#define DEVICE_TIMSK1					0x59	/*TIMSK (shared with TIMER0 and TIMER2)*/
+	#define DEVICE_TIFR1					0x58	/*TIFR  (shared with TIMER0 and TIMER2)*/
+	#define DEVICE_TIMER1_OVF_BIT			2		/*TOIE1 and TOV1*/
+	#define DEVICE_TIMER1_COMPB_BIT			3		/*OCIE1B and OCF1B*/
+	#define DEVICE_TIMER1_COMPA_BIT			4		/*OCIE1A and OCF1A*/
+	#define DEVICE_TIMER1_CAPT_BIT			5		/*TICIE1 and ICF1*/
+	#define DEVICE_TIMER1_CAPT_VECTOR		__vector_6
+	#define DEVICE_TIMER1_COMPA_VECTOR		__vector_7
+	#define DEVICE_TIMER1_COMPB_VECTOR		__vector_8
+	#define DEVICE_TIMER1_OVF_VECTOR		__vector_9
+
+	/*WDT Registers*/
+	#define DEVICE_WDTCR					0x41	/*WDTCR*/
+	#define DEVICE_MCUCSR					0x54	/*MCUCSR*/
+	#define DEVICE_WDT_TIMED_CHANGE			0		/*The time-out can be changed without the timed sequence*/
+
+#else
+
+	/*Memories*/
+	#if DEVICE_MCU == DEVICE_ATMEGA644P
+		#define DEVICE_FLASH_SIZE			65536UL
+		#define DEVICE_RAM_SIZE				4096
+		#define DEVICE_EEPROM_SIZE			2048
+	#else
+		#define DEVICE_FLASH_SIZE			131072UL
+		#define DEVICE_RAM_SIZE				16384
+		#define DEVICE_EEPROM_SIZE			4096
+	#endif
+
+	/*DIO Registers*/
+	#define DEVICE_PINA						0x20
+	#define DEVICE_DDRA						0x21
+	#define DEVICE_PORTA					0x22
+	#define DEVICE_PINB						0x23
+	#define DEVICE_DDRB						0x24
+	#define DEVICE_PORTB					0x25
+	#define DEVICE_PINC						0x26
+	#define DEVICE_DDRC						0x27
+	#define DEVICE_PORTC					0x28
+	#define DEVICE_PIND						0x29
+	#define DEVICE_DDRD						0x2A
+	#define DEVICE_PORTD					0x2B
+
+	/*ADC Registers*/
+	#define DEVICE_ADCL						0x78
+	#define DEVICE_ADCH						0x79
+	#define DEVICE_ADCSRA					0x7A
+	#define DEVICE_ADMUX					0x7C
+	#define DEVICE_ADC_TRIGGER				0x7B	/*ADCSRB*/
+	#define DEVICE_ADTS0					0		/*First auto trigger source bit*/
+	#define DEVICE_ADC_VECTOR				__vector_24
+
+	/*TIMER1 Registers*/
+	#define DEVICE_ICR1						0x86
+	#define DEVICE_OCR1B					0x8A
+	#define DEVICE_OCR1A					0x88
+	#define DEVICE_TCNT1					0x84
+	#define DEVICE_TCCR1B					0x81
+	#define DEVICE_TCCR1A					0x80
+	#define DEVICE_TIMSK1					0x6F	/*TIMSK1*/
+	#define DEVICE_TIFR1					0x36	/*TIFR1*/
+	#define DEVICE_TIMER1_OVF_BIT			0		/*TOIE1 and TOV1*/
+	#define DEVICE_TIMER1_COMPA_BIT			1		/*OCIE1A and OCF1A*/
+	#define DEVICE_TIMER1_COMPB_BIT			2		/*OCIE1B and OCF1B*/
+	#define DEVICE_TIMER1_CAPT_BIT			5		/*ICIE1 and ICF1*/
+	#define DEVICE_TIMER1_CAPT_VECTOR		__vector_12
+	#define DEVICE_TIMER1_COMPA_VECTOR		__vector_13
+	#define DEVICE_TIMER1_COMPB_VECTOR		__vector_14
+	#define DEVICE_TIMER1_OVF_VECTOR		__vector_15
+
+	/*WDT Registers*/
+	#define DEVICE_WDTCR					0x60	/*WDTCSR*/
+	#define DEVICE_MCUCSR					0x54	/*MCUSR*/
+	#define DEVICE_WDT_TIMED_CHANGE			1		/*The time-out is changed with the timed sequence (WDCE then the new value)*/
+
+#endif
+
+
+#endif /* DEVICE_H_ */
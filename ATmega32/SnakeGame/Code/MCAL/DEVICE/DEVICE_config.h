@@ -0,0 +1,48 @@
+/****************************************************************************
+ * @file    DEVICE_config.h
+ * @author  Boles Medhat
+ * @brief   Device Selection Configuration Header File - AVR ATmega32/644P/1284P
+ * @version 1.0
+ * @date    [2024-12-07]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @note
+ * - Build with the same microcontroller in the compiler option (-mmcu=atmega32,
+ *   -mmcu=atmega644p or -mmcu=atmega1284p), a different one stops the build.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ******************************************************************************/
+
+#ifndef DEVICE_CONFIG_H_
+#define DEVICE_CONFIG_H_
+
+#include "DEVICE_def.h"
+
+
+/*Set the Microcontroller
+ * choose between:
+ * 1. DEVICE_ATMEGA32
+ * 2. DEVICE_ATMEGA644P
+ * 3. DEVICE_ATMEGA1284P
+ */
+#define DEVICE_MCU							DEVICE_ATMEGA32
+
+
+
+#if   ( DEVICE_MCU != DEVICE_ATMEGA32 ) && ( DEVICE_MCU != DEVICE_ATMEGA644P ) && ( DEVICE_MCU != DEVICE_ATMEGA1284P )
+	#error "Wrong \"DEVICE_MCU\" configuration option"
+#endif
+
+/* Compare with the microcontroller of the compiler (defined by avr-gcc -mmcu) */
+#if   ( defined(__AVR_ATmega32__)   && ( DEVICE_MCU != DEVICE_ATMEGA32 ) )   || \
+	  ( defined(__AVR_ATmega644P__) && ( DEVICE_MCU != DEVICE_ATMEGA644P ) ) || \
+	  ( defined(__AVR_ATmega1284P__) && ( DEVICE_MCU != DEVICE_ATMEGA1284P ) )
+	#error "DEVICE_MCU is not the microcontroller selected by -mmcu"
+#endif
+
+
+#endif /* DEVICE_CONFIG_H_ */
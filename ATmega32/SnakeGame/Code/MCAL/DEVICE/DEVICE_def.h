@@ -0,0 +1,32 @@
+/****************************************************************************
+ * @file    DEVICE_def.h
+ * @author  Boles Medhat
+ * @brief   Device Selection Definitions Header File - AVR ATmega32/644P/1284P
+ * @version 1.0
+ * @date    [2024-12-07]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the microcontrollers supported by the MCAL drivers.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ******************************************************************************/
+
+#ifndef DEVICE_DEF_H_
+#define DEVICE_DEF_H_
+
+
+/*------------------------------------------   modes    -----------------------------------------*/
+
+/*Microcontroller*/
+#define DEVICE_ATMEGA32						0	/*ATmega32   : 32 KB flash, 2 KB RAM,  1 KB EEPROM*/
+#define DEVICE_ATMEGA644P					1	/*ATmega644P : 64 KB flash, 4 KB RAM,  2 KB EEPROM (same pinout as the ATmega32)*/
+#define DEVICE_ATMEGA1284P					2	/*ATmega1284P: 128 KB flash, 16 KB RAM, 4 KB EEPROM (same pinout as the ATmega32)*/
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* DEVICE_DEF_H_ */
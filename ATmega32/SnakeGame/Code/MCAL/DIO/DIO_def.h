@@ -24,27 +24,28 @@
 #define DIO_DIF_H_
 
 #include "../../LIB/STD_TYPES.h"
+#include "../DEVICE/DEVICE.h"
 
 
 /*---------------------------------------    Registers    ---------------------------------------*/
 
 /*Direction Registers*/
-#define DDRA								*((volatile uint8 *)0x3A)	/*Port A Data Direction Register*/
-#define DDRB								*((volatile uint8 *)0x37)	/*Port B Data Direction Register*/
-#define DDRC								*((volatile uint8 *)0x34)	/*Port C Data Direction Register*/
-#define DDRD								*((volatile uint8 *)0x31)	/*Port D Data Direction Register*/
+#define DDRA								*((volatile uint8 *)DEVICE_DDRA)	/*Port A Data Direction Register*/
+#define DDRB								*((volatile uint8 *)DEVICE_DDRB)	/*Port B Data Direction Register*/
+#define DDRC								*((volatile uint8 *)DEVICE_DDRC)	/*Port C Data Direction Register*/
+#define DDRD								*((volatile uint8 *)DEVICE_DDRD)	/*Port D Data Direction Register*/
 
 /*Data Registers*/
-#define PORTA								*((volatile uint8 *)0x3B)	/*Port A Data Direction Register*/
-#define PORTB								*((volatile uint8 *)0x38)	/*Port B Data Direction Register*/
-#define PORTC								*((volatile uint8 *)0x35)	/*Port C Data Direction Register*/
-#define PORTD								*((volatile uint8 *)0x32)	/*Port D Data Direction Register*/
+#define PORTA								*((volatile uint8 *)DEVICE_PORTA)	/*Port A Data Direction Register*/
+#define PORTB								*((volatile uint8 *)DEVICE_PORTB)	/*Port B Data Direction Register*/
+#define PORTC								*((volatile uint8 *)DEVICE_PORTC)	/*Port C Data Direction Register*/
+#define PORTD								*((volatile uint8 *)DEVICE_PORTD)	/*Port D Data Direction Register*/
 
 /*Input Registers*/
-#define PINA								*((volatile uint8 *)0x39)	/*Port A Input Pins Address Register*/
-#define PINB								*((volatile uint8 *)0x36)	/*Port B Input Pins Address Register*/
-#define PINC								*((volatile uint8 *)0x33)	/*Port C Input Pins Address Register*/
-#define PIND								*((volatile uint8 *)0x30)	/*Port D Input Pins Address Register*/
+#define PINA								*((volatile uint8 *)DEVICE_PINA)	/*Port A Input Pins Address Register*/
+#define PINB								*((volatile uint8 *)DEVICE_PINB)	/*Port B Input Pins Address Register*/
+#define PINC								*((volatile uint8 *)DEVICE_PINC)	/*Port C Input Pins Address Register*/
+#define PIND								*((volatile uint8 *)DEVICE_PIND)	/*Port D Input Pins Address Register*/
 /*_______________________________________________________________________________________________*/
 
 
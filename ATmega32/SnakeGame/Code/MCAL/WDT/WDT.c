@@ -30,6 +30,32 @@
 
 
 
+#if DEVICE_WDT_TIMED_CHANGE == 1
+
+/*
+ * @brief Turns off the Watchdog Timer at startup (before main).
+ *
+ * On the ATmega644P/1284P a watchdog reset (WDT_RESET_MCU) sets WDRF, and WDRF
+ * keeps the watchdog on with the 16ms timeout after the reset, so the MCU would
+ * reset again before main. This code runs in the .init3 section (after the
+ * stack pointer is set, before the variables are initialized) and turns it off.
+ *
+ * WDT_Disable clears WDRF (and the other reset flags of MCUSR), so main can
+ * not read the reset cause. A reset log (like RESET_LOG of delivery_car) must
+ * copy MCUSR to a .noinit variable here, before WDT_Disable.
+ */
+static void WDT_StartupDisable( void ) __attribute__((naked , used , section(".init3")));
+static void WDT_StartupDisable( void )
+{
+	WDT_Disable();
+}
+
+#endif
+
+
+
+
+
 /*
  * @brief Enables the Watchdog Timer (WDT) with a specified timeout period.
  *
@@ -49,6 +75,26 @@
 void WDT_Enable( uint8 time_out )
 {
 
+#if DEVICE_WDT_TIMED_CHANGE == 1
+
+	/* Prepare the new value before the timed sequence (it must be written within 4 cycles) */
+	uint8 wdt_value = ( WDTCR & WDT_TIME_OUT_clr_msk ) | time_out | ( 1 << WDE );
+
+	/* Save the Status Register and disable the Global Interrupt */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	/* Write logical one to WDCE and WDE */
+	WDTCR = WDT_Disable_msk;
+
+	/* Set Prescaler (Time-out) bits and enable the Watchdog Timer (Start count) */
+	WDTCR = wdt_value;
+
+	/* Restore the Status Register */
+	SREG = sreg;
+
+#else
+
 	/* Clear Prescaler (Time-out) bits */
 	WDTCR &= WDT_TIME_OUT_clr_msk;
 
@@ -57,6 +103,8 @@ void WDT_Enable( uint8 time_out )
 
 	/* Enable the Watchdog Timer (Start count) */
 	SET_BIT( WDTCR , WDE );
+
+#endif
 }
 
 
@@ -71,11 +119,33 @@ void WDT_Enable( uint8 time_out )
 void WDT_Disable()
 {
 
+#if DEVICE_WDT_TIMED_CHANGE == 1
+
+	/* Clear the Watchdog Reset Flag (WDE can not be cleared while it is set) */
+	CLR_BIT( MCUCSR , WDRF );
+
+	/* Save the Status Register and disable the Global Interrupt */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	/* Write logical one to WDCE and WDE */
+	WDTCR = WDT_Disable_msk;
+
+	/* Turn off WDT */
+	WDTCR = 0;
+
+	/* Restore the Status Register */
+	SREG = sreg;
+
+#else
+
 	/* Write logical one to WDTOE and WDE */
 	WDTCR = WDT_Disable_msk;
 
 	/* Turn off WDT */
 	WDTCR = 0;
+
+#endif
 }
 
 
@@ -64,6 +64,8 @@ void WDT_Disable();
  *
  * This function forces a reset by configuring the Watchdog Timer with the shortest timeout (16ms)
  * and enabling it. The MCU will then enter an infinite loop, causing the WDT to reset the MCU.
+ * On the ATmega644P/1284P the WDT stays on after this reset, the driver turns it off
+ * at startup before main (.init3 section).
  */
 void WDT_RESET_MCU();
 
@@ -25,12 +25,17 @@
 #define WDT_DEF_H_
 
 #include "../../LIB/STD_TYPES.h"
+#include "../DEVICE/DEVICE.h"
 
 
 /*---------------------------------------    Registers    ---------------------------------------*/
 
 /*Watchdog Control Register*/
-#define WDTCR								*((volatile uint8 *)0x41)	/*Watchdog Timer Control Register*/
+#define WDTCR								*((volatile uint8 *)DEVICE_WDTCR)	/*Watchdog Timer Control Register (WDTCR or WDTCSR)*/
+#define MCUCSR								*((volatile uint8 *)DEVICE_MCUCSR)	/*MCU Control and Status Register (MCUCSR or MCUSR)*/
+
+/*Interrupt Register*/
+#define SREG								*((volatile uint8 *)0x5F)	/*status register*/
 /*_______________________________________________________________________________________________*/
 
 
@@ -42,7 +47,13 @@
 #define WDP1								1	/*Watchdog Timer Prescaler bit 1*/
 #define WDP2								2	/*Watchdog Timer Prescaler bit 2*/
 #define WDE									3	/*Watchdog Enable*/
-#define WDTOE								4	/*Watchdog Turn-off Enable*/
+#define WDTOE								4	/*Watchdog Turn-off Enable (WDCE: Watchdog Change Enable on the ATmega644P/1284P)*/
+
+/*MCUCSR Register*/
+#define WDRF								3	/*Watchdog Reset Flag*/
+
+/*SREG Register*/
+#define	I									7	/*Global Interrupt Enable*/
 
 /*_______________________________________________________________________________________________*/
 
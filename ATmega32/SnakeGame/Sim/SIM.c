@@ -0,0 +1,226 @@
+/****************************************************************************
+ * @file    SIM.c
+ * @author  Boles Medhat
+ * @brief   Snake Game Host Runner Source File
+ * @version 1.0
+ * @date    [2024-12-07]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file runs the game engine (`Code/APP/SNAKE.c`, the same file that is
+ * built for the MCU) on Linux:
+ * - Bot run: the self-play bot plays SNAKE_Step for a number of moves (a new
+ *   game starts when one ends) and the run prints the moves per second and
+ *   the time of one move (SNAKE_BotInput and SNAKE_Step).
+ * - Replay: every recorded game of `SIM_LOGS.h` is replayed with
+ *   SNAKE_Replay and its hash is compared with the recorded one. The run
+ *   fails (exit code 1) if a hash is different, so a change of the game
+ *   logic is found.
+ * - Record: plays a new game (the bot with random turns, like a player) and
+ *   prints it in the format of `SIM_LOGS.h`.
+ *
+ * @note
+ * - Build and run (from the SnakeGame folder):
+ *       gcc -std=gnu99 -O2 -Wall -o snake_sim Sim/SIM.c Code/APP/SNAKE.c
+ *       ./snake_sim [moves]
+ *       ./snake_sim record <name> <seed> <moves> <turn_period>
+ * - The recorded hashes are for the default APP_config.h (16x16 map without
+ *   wrapping, a queue of 3 turns). Record the games again after an intended
+ *   change of the game logic or of these options.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "../Code/APP/SNAKE.h"
+#include "SIM_LOGS.h"
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+#define SIM_DEFAULT_MOVES			5000000UL	/*Moves of the bot run*/
+#define SIM_RECORD_SIZE				16000		/*Largest recorded game (inputs)*/
+/*_______________________________________________________________________________________________*/
+
+
+
+
+
+/*
+ * @brief Get a monotonic time.
+ *
+ * @return (double) Time (s).
+ */
+static double Sim_Time( void )
+{
+	struct timespec now;
+
+	clock_gettime( CLOCK_MONOTONIC , &now );
+
+	return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+
+
+
+
+/*
+ * @brief Run the bot for a number of moves and print the speed.
+ *
+ * @param moves: Number of SNAKE_Step calls.
+ */
+static void Sim_BotRun( unsigned long moves )
+{
+	static SnakeGame game;
+	unsigned long games = 0 , score_sum = 0;
+	uint16 seed = 1;
+
+	SNAKE_Init( &game , seed );
+
+	double start = Sim_Time();
+
+	for ( unsigned long move = 0 ; move < moves ; move++ )
+	{
+		SNAKE_Step( &game , SNAKE_BotInput( &game ) );
+
+		if ( game.game_over )
+		{
+			games++;
+			score_sum += game.score;
+
+			SNAKE_Init( &game , ++seed );
+		}
+	}
+
+	double time = Sim_Time() - start;
+
+	printf( "bot run: %lu moves in %.3f s: %.2f M moves/s, %.1f ns per move\n" ,
+			moves , time , moves / time / 1e6 , time * 1e9 / moves );
+	printf( "         %lu games ended, average score %.1f, the last game is at move %lu\n" ,
+			games , games ? (double)score_sum / games : 0.0 , (unsigned long)game.tick );
+}
+
+
+
+
+
+/*
+ * @brief Replay the recorded games and compare their hashes.
+ *
+ * @return (int) Number of games with a different hash.
+ */
+static int Sim_Replay( void )
+{
+	static SnakeGame game;
+	int failed = 0;
+
+	printf( "\n%-16s %6s %7s %6s %6s %6s  %s\n" , "game" , "seed" , "inputs" , "score" , "hash" , "replay" , "result" );
+
+	for ( unsigned int i = 0 ; i < sizeof( sim_logs ) / sizeof( sim_logs[0] ) ; i++ )
+	{
+		const SimLog * log = &sim_logs[ i ];
+		uint16 hash = SNAKE_Replay( &game , &log->log );
+		bool same = ( hash == log->hash );
+
+		printf( "%-16s %6u %7u %6u 0x%04X 0x%04X  %s\n" , log->name , log->log.seed , log->log.length , game.score ,
+				log->hash , hash , same ? "ok" : "DIFFERENT" );
+
+		failed += !same;
+	}
+
+	return failed;
+}
+
+
+
+
+
+/*
+ * @brief Record a game and print it as a SIM_LOGS.h entry.
+ *
+ * The bot plays, and every turn_period moves the player turns to a random
+ * direction (once or twice between two moves), so the game can end by a
+ * collision.
+ *
+ * @param name:        Name of the game.
+ * @param seed:        Seed of the game.
+ * @param moves:       Largest number of moves.
+ * @param turn_period: Moves between two random turns (0: bot only).
+ */
+static void Sim_Record( const char * name , uint16 seed , unsigned long moves , unsigned long turn_period )
+{
+	static SnakeGame game;
+	static uint8 inputs[ SIM_RECORD_SIZE ];
+	SnakeLog log = { seed , inputs , SIM_RECORD_SIZE , 0 };
+
+	srand( seed );
+	SNAKE_Init( &game , seed );
+
+	for ( unsigned long move = 0 ; ( move < moves ) && !game.game_over && ( log.length + 3 <= log.size ) ; move++ )
+	{
+		if ( ( turn_period != 0 ) && ( ( rand() % turn_period ) == 0 ) )
+		{
+			SNAKE_Record( &game , &log , LEFT + rand() % 4 );
+
+			if ( ( rand() % 2 ) == 0 )
+			{
+				SNAKE_Record( &game , &log , LEFT + rand() % 4 );
+			}
+		}
+		else
+		{
+			uint8 input = SNAKE_BotInput( &game );
+
+			/* A repeated direction is ignored by the game, it is not recorded */
+			if ( input != game.direction )
+			{
+				SNAKE_Record( &game , &log , input );
+			}
+		}
+
+		SNAKE_Record( &game , &log , STOP );
+	}
+
+	printf( "/* %s: %lu moves, score %u%s */\n" , name , (unsigned long)game.tick , game.score , game.game_over ? ", game over" : "" );
+	printf( "static uint8 %s_inputs[ %u ] =\n{" , name , log.length );
+
+	for ( uint16 i = 0 ; i < log.length ; i++ )
+	{
+		printf( "%s%u%s" , ( i % 32 ) ? "" : "\n\t" , inputs[ i ] , ( i + 1 < log.length ) ? "," : "" );
+	}
+
+	printf( "\n};\n#define " );
+
+	for ( const char * c = name ; *c != '\0' ; c++ )
+	{
+		putchar( toupper( (unsigned char)*c ) );
+	}
+
+	printf( "_LOG\t\t{ \"%s\" , { %u , %s_inputs , %u , %u } , 0x%04X }\n" ,
+			name , seed , name , log.length , log.length , SNAKE_Hash( &game ) );
+}
+
+
+
+
+
+int main( int argc , char * argv[] )
+{
+	if ( ( argc == 6 ) && ( argv[1][0] == 'r' ) )
+	{
+		Sim_Record( argv[2] , (uint16)strtoul( argv[3] , NULL , 0 ) , strtoul( argv[4] , NULL , 0 ) , strtoul( argv[5] , NULL , 0 ) );
+		return 0;
+	}
+
+	Sim_BotRun( ( argc > 1 ) ? strtoul( argv[1] , NULL , 0 ) : SIM_DEFAULT_MOVES );
+
+	return ( Sim_Replay() == 0 ) ? 0 : 1;
+}
@@ -0,0 +1,376 @@
+/****************************************************************************
+ * @file    SIM_LOGS.h
+ * @author  Boles Medhat
+ * @brief   Snake Game Recorded Games Header File
+ * @version 1.0
+ * @date    [2024-12-07]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file holds recorded games (the seed, the SnakeLog inputs and the
+ * SNAKE_Hash of the final state) that `SIM.c` replays to check that the game
+ * logic did not change. The entries are printed by
+ * `./snake_sim record <name> <seed> <moves> <turn_period>`:
+ * - player_turns: random turns every 30 moves on average, ends on a collision.
+ * - player_long:  random turns every 300 moves on average, ends on a collision.
+ * - bot_only:     the bot alone for 2000 moves.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef SIM_LOGS_H_
+#define SIM_LOGS_H_
+
+#include "../Code/APP/SNAKE.h"
+
+
+/*------------------------------------------   types    -----------------------------------------*/
+
+/*Recorded game*/
+typedef struct
+{
+	const char * name;
+	SnakeLog log;
+	uint16 hash;							/*SNAKE_Hash of the final state*/
+}SimLog;
+/*_______________________________________________________________________________________________*/
+
+
+
+/*-----------------------------------------   games    ------------------------------------------*/
+
+/* player_turns: 1299 moves, score 11, game over */
+static uint8 player_turns_inputs[ 1546 ] =
+{
+	2,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,3,3,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+	4,0,1,0,0,0,0,2,4,0,2,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,
+	2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,2,
+	1,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,
+	0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,3,0,1,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,3,0,2,1,0,0,0,0,0,0,0,
+	0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,
+	0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+	4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,
+	1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,3,0,2,0,0,0,0,4,0,1,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,2,0,0,0,1,0,0,0,0,0,0,3,4,0,1,2,0,0,0,0,0,0,0,0,0,1,0,3,0,0,0,
+	0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,2,0,0,0,0,
+	0,0,4,0,2,0,0,0,0,2,2,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,
+	0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
+	4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,
+	2,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,1,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,4,0,0,0,0,
+	0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,4,0,2,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,1,0,0,
+	0,0,0,0,0,4,1,0,1,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,3,0,1,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,2,0,0,0,0,0,0,0,0,4,0,
+	1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,
+	2,1,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,2,0,0,0,0,4,0,2,0,0,2,
+	0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,1,1,0,0,0,0,0,4,0,2,0,0,
+	0,2,0,0,0,0,0,0,4,4,0,1,0,0,0,0,0,0,3,3,0,2,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,3,4,0,1,0,0,0,0,4,0,2,
+	0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,2,0,0,0,0,0,0,0,0,0,4,0,2,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,1,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,
+	0,0,0,0,0,0,0,0,4,0,1,0,0,2,2,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,2,4,0,
+	2,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,1,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,1,4,0,1,0,0,
+	0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
+	4,0,2,0,0,4,0,1,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,2,1,0,0,0,0,0,
+	0,0,0,0,0,0,0,2,3,0
+};
+#define PLAYER_TURNS_LOG		{ "player_turns" , { 133 , player_turns_inputs , 1546 , 1546 } , 0x2842 }
+
+/* player_long: 5059 moves, score 73, game over */
+static uint8 player_long_inputs[ 5808 ] =
+{
+	2,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,2,0,0,0,0,0,0,0,0,0,0,0,4,0,
+	1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,
+	0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,
+	0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,
+	0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,
+	0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+	4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,
+	1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,
+	0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,
+	0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,
+	0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,
+	0,0,4,0,1,0,0,0,0,0,0,2,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,2,4,0,1,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,
+	0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+	4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,
+	1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,
+	0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,
+	0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,
+	0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,
+	0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+	4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,
+	1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,
+	0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,
+	0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,
+	0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,
+	0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+	4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,2,1,0,0,0,0,0,0,0,
+	4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,
+	0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,
+	0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,
+	0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,
+	0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,
+	0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+	4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,
+	0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,
+	0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,
+	0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,
+	0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,
+	0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,
+	4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,
+	0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,
+	0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,
+	0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,
+	0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,1,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,2,2,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,2,0,0,0,0,
+	0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,
+	0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,2,0,0,0,0,0,0,0,0,0,0,2,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
+	4,0,2,0,0,0,0,0,0,0,0,0,1,0,2,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,
+	4,0,4,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,
+	0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,
+	0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,
+	0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,
+	0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,
+	0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	2,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,4,4,0,2,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,
+	0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,
+	0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,
+	0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,1,4,0,1,0,0,0,0,4,0,2,
+	0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,
+	0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,
+	0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,2,0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,
+	0,4,0,2,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,
+	0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,
+	0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,
+	0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,1,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,1,3,0
+};
+#define PLAYER_LONG_LOG		{ "player_long" , { 11 , player_long_inputs , 5808 , 5808 } , 0x60C6 }
+
+/* bot_only: 2000 moves, score 25 */
+static uint8 bot_only_inputs[ 2287 ] =
+{
+	2,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,
+	0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,0,0,0,4,
+	0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,3,0,0,0,0,0,0,0,0,0,0,0,0,0,2,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,
+	0,0,0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,
+	0,0,0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,
+	0,0,0,0,0,4,0,1,0,0,0,0,0,0,0,0,0,0,0,0,4,0,2,0,0,0,0,0,0,0,0,0,
+	0,0,0,4,0,1,0,0,0,0,0,0,0,0,0
+};
+#define BOT_ONLY_LOG		{ "bot_only" , { 7 , bot_only_inputs , 2287 , 2287 } , 0x800A }
+
+static const SimLog sim_logs[] =
+{
+	PLAYER_TURNS_LOG,
+	PLAYER_LONG_LOG,
+	BOT_ONLY_LOG,
+};
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* SIM_LOGS_H_ */
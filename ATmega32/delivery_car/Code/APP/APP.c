@@ -1,36 +1,9 @@
 #include "APP.h"
 
 
-uint8 input_pass[ PASS_SIZE ] = {};
-uint8 pass[ PASS_SIZE ] = {};
-
-
-uint8 gear = MIN_GEAR;
-uint8 command = STOP;
-uint8 reversed_mode = STOP;
-
-
-uint8 tcnt;
-uint16 ovfCounts = 0;
 extern uint16 g_TIMER0_Overflow;
 
 
-
-uint16 front_distance;
-uint16 back_distance;
-
-bool front_blocked = false;
-bool back_blocked  = false;
-
-bool car_connected = true;
-
-char uart_rx_buffer[34] = "";
-
-
-struct reverse stack[ MAX_MOVES ] = {};
-uint8 top = 0;
-
-
 Motor right_motor = {
 		RIGHT_MOTOR_PORT,
 		RIGHT_MOTOR_F_PIN,
@@ -55,28 +28,21 @@ Usonic back_usonic  = {
 		BACK_USONIC_TRIG_PIN
 };
 
+Servo box_servo = {
+		BOX_SERVO_PORT,
+		BOX_SERVO_PIN
+};
 
 
 
-void Back_Reverse();
-
-void Save_Move();
-
-void UART_Get_Cmd();
-
-void UART_Get_LCD_msg();
-
-void Check_Connection();
-
-void Keypad_Get_Pass( uint8 * password );
 
-void Save_pass( uint8 * password );
+void Shell_Commit( const char * args );
 
-bool Is_Pass_Valid();
+void Shell_Path( const char * args );
 
-void Check_Pass();
+void Shell_Trace( const char * args );
 
-void Obstacle_Detection();
+void Shell_Resets( const char * args );
 
 void APP_Init();
 
@@ -85,338 +51,227 @@ void APP_main_loop();
 
 
 
-void Back_Reverse()
+void Shell_Commit( const char * args )
 {
-	static volatile uint16 counter = 0;
-	counter++;
+	(void)args;
 
-	if (counter < ovfCounts) return;
-	counter = 0;
-
-	if (top == 0)
-	{
-		MOTOR_BothStop( right_motor , left_motor );
-		WDT_RESET_MCU();
-		return;
-	}
+	EEPROM_MIRROR_Commit();
+	SHELL_Print_P( PSTR( "EEPROM saved\r\n" ) );
+}
 
-	top--;
+void Shell_Path( const char * args )
+{
+	(void)args;
 
-	if (reversed_mode != STOP)
+	for ( uint16 i = 0 ; i < path.top ; i++ )
 	{
-		ovfCounts = stack[ top ].ovfs;
-		TIMER0_SetTimerValue( stack[ top ].tcnt );
-		TIMER2_SetCompareValue( 51 * stack[ top ].gear );
-		MOTOR_SET_Direction( right_motor , left_motor , stack[ top ].mode );
+		SHELL_PrintNumber( i );
+		SHELL_Print_P( PSTR( ": mode " ) );
+		UART_WriteByte( path.moves[i].mode + '0' );
+		SHELL_Print_P( PSTR( " gear " ) );
+		SHELL_PrintNumber( path.moves[i].gear );
+		SHELL_Print_P( PSTR( " ovfs " ) );
+		SHELL_PrintNumber( path.moves[i].ovfs );
+		SHELL_Print_P( PSTR( " tcnt " ) );
+		SHELL_PrintNumber( path.moves[i].tcnt );
+		SHELL_Print_P( PSTR( "\r\n" ) );
 	}
 }
 
-void Save_Move()
+void Shell_Trace( const char * args )
 {
-	if( (reversed_mode != STOP) && (top < MAX_MOVES) )
+	if ( strcmp( args , "clear" ) == 0 )
 	{
-		stack[ top ].tcnt = TIMER0_GetTimerValue();
-		stack[ top ].ovfs = g_TIMER0_Overflow;
-		stack[ top ].mode = reversed_mode;
-		stack[ top ].gear = gear;
-
-		top++;
+		TRACE_Clear();
 	}
 
-	TIMER0_RESET();
+	TRACE_Report( UART_WriteByte );
 }
 
-void UART_Get_Cmd()
+void Shell_Resets( const char * args )
 {
-	command = uart_rx_buffer[0];
-	car_connected = true;
-
-	switch ( command )
+	if ( strcmp( args , "clear" ) == 0 )
 	{
+		RESET_LOG_ClearCounts();
+	}
 
-		case FORWARD:
-
-			MOTOR_BothForward( right_motor , left_motor );
-			Save_Move();
-			reversed_mode = BACKWARD;
-			break;
-
-		case BACKWARD:
-
-			MOTOR_BothBackward( right_motor , left_motor );
-			Save_Move();
-			reversed_mode = FORWARD;
-			break;
-
-		case STOP:
-
-			MOTOR_BothStop( right_motor , left_motor );
-			Save_Move();
-			reversed_mode = STOP;
-			break;
-
-		case STEER_RIGHT:
-
-			MOTOR_TurnRight( right_motor , left_motor );
-			Save_Move();
-			reversed_mode = STEER_LEFT;
-			break;
-
-		case STEER_LEFT:
-
-			MOTOR_TurnLeft( right_motor , left_motor );
-			Save_Move();
-			reversed_mode = STEER_RIGHT;
-			break;
-
-		case GEARUP:
-
-			if(gear < MAX_GEAR)
-			{
-				gear++;
-				TIMER2_SetCompareValue( 51 * gear );
-				Save_Move();
-			}
-			break;
-
-
-		case GEARDOWN:
-
-			if(gear > MIN_GEAR)
-			{
-				gear--;
-				TIMER2_SetCompareValue( 51 * gear );
-				Save_Move();
-			}
-			break;
-
-
-		case CLR_SCREEN:
-
-			LCD_ClearScreen();
-			break;
-
-		case SEND_LCD:
-
-			UART_Set_RX_Callback( UART_Get_LCD_msg , (uint8 *) uart_rx_buffer , 34 , UART_STOPCHAR );
-			break;
-
-		case REVERSE:
+	RESET_LOG_Report( UART_WriteByte );
+}
 
-			Save_Move();
+void CAR_PORT_SetMotors( uint8 move )
+{
+	switch ( move )
+	{
+		case FORWARD:		MOTOR_BothForward( right_motor , left_motor );	break;
+		case BACKWARD:		MOTOR_BothBackward( right_motor , left_motor );	break;
+		case STEER_RIGHT:	MOTOR_TurnRight( right_motor , left_motor );	break;
+		case STEER_LEFT:	MOTOR_TurnLeft( right_motor , left_motor );		break;
+		default:			MOTOR_BothStop( right_motor , left_motor );		break;
+	}
+}
 
-			MOTOR_BothStop( right_motor , left_motor );
-			UART_InterruptDisable( UART_INT_RX_ID );
-			TIMER0_SetCallback( TIMER0_OVF_ID , Back_Reverse );
-			ovfCounts = 0;
-			TIMER0_SetTimerValue( 255 );
-			break;
+void CAR_PORT_SetSpeed( uint8 duty )
+{
+	TIMER2_SetCompareValue( duty );
+}
 
-		case BUZZER_ON:
+void CAR_PORT_SetBuzzer( bool on )
+{
+	DIO_SetPinValue( BUZZER_PORT , BUZZER_PIN , on ? HIGH : LOW );
+}
 
-			DIO_SetPinValue(BUZZER_PORT,BUZZER_PIN,HIGH);
-			break;
+void CAR_PORT_OpenBox()
+{
+	SERVO_SetAngle( BOX_SERVO , 90 );
+}
 
-		case BUZZER_OFF:
+uint16 CAR_PORT_ReadDistance( uint8 sensor )
+{
+	return USONIC_Read( ( sensor == CAR_FRONT_SENSOR ) ? front_usonic : back_usonic );
+}
 
-			DIO_SetPinValue(BUZZER_PORT,BUZZER_PIN,LOW);
-			break;
+uint16 CAR_PORT_GetTimerOverflows()
+{
+	return g_TIMER0_Overflow;
+}
 
-	}
+uint8 CAR_PORT_GetTimerValue()
+{
+	return TIMER0_GetTimerValue();
+}
 
+void CAR_PORT_SetTimerValue( uint8 value )
+{
+	TIMER0_SetTimerValue( value );
 }
 
-void UART_Get_LCD_msg()
+void CAR_PORT_ResetTimer()
 {
-	LCD_ClearScreen();
-	LCD_PrintString(uart_rx_buffer);
-	UART_Set_RX_Callback( UART_Get_Cmd , (uint8 *)uart_rx_buffer , 1 , UART_STOPCHAR );
-	car_connected = true;
+	TIMER0_RESET();
 }
 
-void Check_Connection()
+void CAR_PORT_EnableTimer( bool enable )
 {
-	static volatile uint16 counter = 0;
-	counter++;
-	if(counter >= ovfCounts)
+	if ( enable )
+	{
+		TIMER0_Enable();
+	}
+	else
 	{
-		TIMER0_SetTimerValue( tcnt );
-		counter = 0;
-
-		if( car_connected == false )
-		{
-			Save_Move();
-			MOTOR_BothStop( right_motor , left_motor );
-			UART_InterruptDisable( UART_INT_RX_ID );
-			TIMER0_SetCallback( TIMER0_OVF_ID , Back_Reverse );
-			ovfCounts = 0;
-			TIMER0_SetTimerValue( 255 );
-			command = REVERSE;
-		}
-		else if( (command == STOP) || (command == SEND_LCD) )
-		{
-			car_connected = true;
-		}
-		else
-		{
-			car_connected = false;
-		}
+		TIMER0_Disable();
 	}
 }
 
-void Keypad_Get_Pass( uint8 * password )
+void CAR_PORT_SetTimerCallback( void (*callback)(void) )
 {
-	LCD_ClearScreen();
-	LCD_PrintString("set pass:");
+	TIMER0_SetCallback( TIMER0_OVF_ID , callback );
+}
 
-	uint8 key;
+void CAR_PORT_SetReceiver( void (*callback)(void) , uint8 * buffer , uint8 size )
+{
+	UART_Set_RX_Callback( callback , buffer , size , UART_STOPCHAR );
+}
 
-	for ( uint8 i = 0 ; i < PASS_SIZE ; i++ )
-	{
-		do
-		{
-			key = KEYPAD_GetPressedKey();
-		}while ( key == KEYPAD_NOT_PRESSED );
+void CAR_PORT_DisableReceiver()
+{
+	UART_InterruptDisable( UART_INT_RX_ID );
+}
 
-		password[i] = key;
+void CAR_PORT_StartShell()
+{
+	SHELL_Start( Shell_Exit );
+}
 
-		LCD_PrintCharacter( key );
-		_delay_ms(500);
+uint8 CAR_PORT_GetKey()
+{
+	uint8 key = KEYPAD_GetPressedKey();
 
-		LCD_SetCursor( 0 , 9 + i );
-		LCD_PrintCharacter('*');
+	return ( key == KEYPAD_NOT_PRESSED ) ? CAR_NO_KEY : key;
+}
 
-	}
-	_delay_ms(500);
+void CAR_PORT_ClearScreen()
+{
 	LCD_ClearScreen();
+}
 
-
+void CAR_PORT_SetCursor( uint8 row , uint8 col )
+{
+	LCD_SetCursor( row , col );
 }
 
-void Save_pass( uint8 * password )
+void CAR_PORT_PrintChar( uint8 character )
 {
-	EEPROM_WriteArray( PASS_ADDRESS , password , PASS_SIZE );
+	LCD_PrintCharacter( character );
+}
 
-	LCD_ClearScreen();
-	LCD_PrintString("Password is set");
-	_delay_ms(1000);
-	LCD_ClearScreen();
+void CAR_PORT_PrintString( const char * string )
+{
+	LCD_PrintString( (char *)string );
 }
 
-bool Is_Pass_Valid()
+void CAR_PORT_DelayMs( uint16 ms )
 {
-	for ( uint8 i = 0 ; i < PASS_SIZE ; i++ )
+	/* _delay_ms needs a constant time */
+	while ( ms-- )
 	{
-		if( input_pass[i] != pass[i] )
-		{
-			LCD_ClearScreen();
-			LCD_PrintString("Wrong password");
-
-			return false;
-		}
+		_delay_ms( 1 );
 	}
-
-	LCD_ClearScreen();
-	LCD_PrintString("Password correct");
-
-	return true;
 }
 
-void Check_Pass()
+void CAR_PORT_ReadStorage( uint16 address , uint8 * data , uint8 size )
 {
-	uint8 key = KEYPAD_GetPressedKey();
-
-	if ( (key != KEYPAD_NOT_PRESSED) && (key != '*') )
-	{
-		Keypad_Get_Pass( input_pass );
-
-		if ( Is_Pass_Valid() )
-		{
-
-			LCD_SetCursor(1,3);
-			LCD_PrintString("BOX OPENED");
-			SERVO_SetAngle( 90 );
-		}
+	EEPROM_MIRROR_ReadArray( address , data , size );
+}
 
-		_delay_ms(1000);
-		LCD_ClearScreen();
+void CAR_PORT_WriteStorage( uint16 address , const uint8 * data , uint8 size )
+{
+	EEPROM_MIRROR_WriteArray( address , data , size );
+	EEPROM_MIRROR_Commit();
+}
 
-	}
-	else if (key == '*')
-	{
-		LCD_ClearScreen();
-		LCD_PrintString(" Enter old pass");
-		_delay_ms(1000);
-
-		Keypad_Get_Pass( input_pass );
-
-		if( Is_Pass_Valid() )
-		{
-			LCD_SetCursor( 1 , 0 );
-			LCD_PrintString(" Enter new pass");
-			_delay_ms(1000);
-
-			Keypad_Get_Pass( pass );
-			Save_pass( pass );
-		}
-		else
-		{
-			_delay_ms(1000);
-			LCD_ClearScreen();
-		}
-	}
+void CAR_PORT_IsrBegin( uint8 id )
+{
+	RESET_LOG_ISR( id );
+	TRACE_ISR( id );
 }
 
-void Obstacle_Detection()
+void CAR_PORT_IsrEnd()
 {
-	front_distance = USONIC_Read(front_usonic);
-	back_distance = USONIC_Read(back_usonic);
+	TRACE_ISR_END();
+	RESET_LOG_ISR_END();
+}
 
-	if (((command == FORWARD) || ((command == REVERSE) && (reversed_mode == FORWARD))) && front_distance < 10)
-	{
-		if (!front_blocked)
-		{
-			MOTOR_BothStop(right_motor, left_motor);
-			TIMER0_Disable();
-			front_blocked = true;
-		}
-	}
-	else if (front_blocked && front_distance >= 10)
-	{
-		MOTOR_BothForward(right_motor, left_motor);
-		TIMER0_Enable();
-		front_blocked = false;
-	}
+void CAR_PORT_Tick()
+{
+	RESET_LOG_TICK();
+}
 
-	if (((command == BACKWARD) || ((command == REVERSE) && (reversed_mode == BACKWARD))) && back_distance < 10)
-	{
-		if (!back_blocked)
-		{
-			MOTOR_BothStop(right_motor, left_motor);
-			TIMER0_Disable();
-			back_blocked = true;
-		}
-	}
-	else if (back_blocked && back_distance >= 10)
-	{
-		MOTOR_BothBackward(right_motor, left_motor);
-		TIMER0_Enable();
-		back_blocked = false;
-	}
+void CAR_PORT_Restart()
+{
+	RESET_LOG_Restart();
 }
 
 void APP_Init()
 {
+	RESET_LOG_Init();
+
+	SHELL_Init();
+
 	TIMER0_Init();
 	TIMER1_Init();
 	TIMER2_Init();
 
+	TRACE_Init();
+
 	UART_Init();
 
 	LCD_Init();
 
 	KEYPAD_Init();
 
+	SERVO_Init();
+	SERVO_Attach( BOX_SERVO , box_servo );
+
 
 	MOTOR_Init( right_motor );
 	MOTOR_Init( left_motor );
@@ -428,42 +283,66 @@ void APP_Init()
 	LCD_SetCursor( 0 , 5 );
 	LCD_PrintString( "HELLO!" );
 
-	SERVO_SetAngle( 90 );
+	SERVO_SetAngle( BOX_SERVO , 90 );
 	_delay_ms( 500 );
-	SERVO_SetAngle( -90 );
+	SERVO_SetAngle( BOX_SERVO , -90 );
 	_delay_ms( 500 );
 
 	LCD_ClearScreen();
 
-	TIMER2_SetCompareValue( 51 * MIN_GEAR );
+	CAR_Init();
 
 
-	if ( EEPROM_ReadByte( PASS_STATUS_ADDRESS ) == NO_PASS )
-	{
-		Keypad_Get_Pass( pass );
-		Save_pass( pass );
-		EEPROM_WriteByte( PASS_STATUS_ADDRESS , PASS_SAVED );
-	}
-	else
-	{
-		EEPROM_ReadArray( PASS_ADDRESS , pass , PASS_SIZE );
-	}
+	EEPROM_MIRROR_Init();
+	RESET_LOG_Count();
+	WDT_ClearResetFlags();
 
+	Load_pass();
 
-	UART_Set_RX_Callback( UART_Get_Cmd , (uint8 *)uart_rx_buffer , 1 , UART_STOPCHAR );
 
+	SHELL_RegisterVariable( PSTR( "command" ) , &command , SHELL_UINT8 );
+	SHELL_RegisterVariable( PSTR( "gear" ) , &path.gear , SHELL_UINT8 );
+	SHELL_RegisterVariable( PSTR( "moves" ) , &path.top , SHELL_UINT16 );
+	SHELL_RegisterVariable( PSTR( "front" ) , &front_distance , SHELL_UINT16 );
+	SHELL_RegisterVariable( PSTR( "back" ) , &back_distance , SHELL_UINT16 );
+	SHELL_RegisterCommand( PSTR( "commit" ) , Shell_Commit );
+	SHELL_RegisterCommand( PSTR( "path" ) , Shell_Path );
+	SHELL_RegisterCommand( PSTR( "trace" ) , Shell_Trace );
+	SHELL_RegisterCommand( PSTR( "resets" ) , Shell_Resets );
 
-	TIMER0_RESET();
-	TIMER0_Calc_ISR_Timing_ms( 5000 , &ovfCounts , &tcnt );
-	TIMER0_SetCallback( TIMER0_OVF_ID , Check_Connection );
+	RESET_LOG_Report( UART_WriteByte );
+
+
+	uint16 ovfs;
+	uint8 timer_value;
+
+	TIMER0_Calc_ISR_Timing_ms( 5000 , &ovfs , &timer_value );
+	CAR_Start( ovfs , timer_value );
 }
 
 void APP_main_loop()
 {
 	while(1)
 	{
+		RESET_LOG_TASK( CRUMB_CHECK_PASS );
+		TRACE_TASK( CRUMB_CHECK_PASS );
 		Check_Pass();
+
+		RESET_LOG_TASK( CRUMB_OBSTACLE );
+		TRACE_TASK( CRUMB_OBSTACLE );
 		Obstacle_Detection();
+
+		RESET_LOG_TASK( CRUMB_EEPROM );
+		TRACE_TASK( CRUMB_EEPROM );
+		EEPROM_MIRROR_Task();
+
+		RESET_LOG_TASK( CRUMB_SHELL );
+		TRACE_TASK( CRUMB_SHELL );
+		SHELL_Task();
+
+		RESET_LOG_TASK( CRUMB_LCD_MSG );
+		TRACE_TASK( CRUMB_LCD_MSG );
+		Print_LCD_msg();
 	}
 }
 
@@ -5,6 +5,8 @@
 /*--------------------------- Include Dependencies --------------------------*/
 #include "APP_config.h"
 #include "APP_def.h"
+#include "CAR.h"
+#include <string.h>
 
 #include "../MCAL/UART/UART.h"
 #include "../MCAL/TIMER0/TIMER0.h"
@@ -18,6 +20,10 @@
 #include "../HAL/KEYPAD/Keypad.h"
 #include "../HAL/USONIC/USONIC.h"
 #include "../HAL/SERVO/SERVO.h"
+#include "../HAL/EEPROM_MIRROR/EEPROM_MIRROR.h"
+#include "../HAL/SHELL/SHELL.h"
+#include "../HAL/RESET_LOG/RESET_LOG.h"
+#include "../HAL/TRACE/TRACE.h"
 
 
 /*---------------------------- Function Prototypes --------------------------*/
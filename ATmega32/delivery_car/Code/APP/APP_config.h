@@ -16,6 +16,7 @@
 #define BACK_USONIC_PORT			DIO_PORTB	/* Port used for the back ultrasonic sensor */
 
 #define BUZZER_PORT					DIO_PORTD	/* Port used for the buzzer control pin */
+#define BOX_SERVO_PORT				DIO_PORTD	/* Port used for the box servo signal pin */
 
 
 
@@ -43,6 +44,14 @@
 #define BACK_USONIC_TRIG_PIN		DIO_PIN3	/* Trigger output pin for back ultrasonic sensor */
 
 #define BUZZER_PIN					DIO_PIN6	/* Output pin connected to the buzzer */
+#define BOX_SERVO_PIN				DIO_PIN4	/* Output pin connected to the box servo (OC1B) */
+
+
+/*The UART, TIMER, ADC and EEPROM drivers use the ATmega32 registers and vector numbers
+ * (UART __vector_13/__vector_15 and one USART), the ATmega644P/1284P layer is only in SnakeGame (MCAL/DEVICE)*/
+#if defined(__AVR__) && !defined(__AVR_ATmega32__)
+	#error "The MCAL drivers of this project are for the ATmega32 only (build with -mmcu=atmega32)"
+#endif
 
 
 #endif /* APP_CONFIG_H_ */
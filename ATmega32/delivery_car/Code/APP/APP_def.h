@@ -46,9 +46,33 @@ struct reverse
 #define REVERSE						';'		/* Start reverse playback of recorded path */
 #define BUZZER_ON					'o'		/* Turn the buzzer ON */
 #define BUZZER_OFF					'f'		/* Turn the buzzer OFF */
+#define SHELL_MODE					'$'		/* Stop the car and start the UART command shell */
+
+/*LCD messages*/
+#define LCD_MSG_SIZE				( POOL_BLOCK_SIZE - 1 )	/* Largest LCD message with its UART_STOPCHAR (one pool block, the last byte ends the string) */
+#define LCD_MSG_QUEUE_SIZE			4		/* Received LCD messages waiting to be printed (a power of 2, not less than POOL_BLOCKS) */
+
+/*Obstacle stop distance*/
+#define OBSTACLE_DISTANCE			10		/* The car stops if an obstacle is closer than this distance (cm) */
+
+/*Servo channel of the box lock*/
+#define BOX_SERVO					0		/* Servo ID of the box lock servo */
 
 /*Movement recording limit for reverse playback*/
 #define MAX_MOVES					300		/* Maximum number of moves to store for reverse playback */
+
+/*Reset log crumbs and trace ids of the main loop tasks (0 is RESET_LOG_NO_TASK)*/
+#define CRUMB_CHECK_PASS			1		/* Check_Pass() */
+#define CRUMB_OBSTACLE				2		/* Obstacle_Detection() */
+#define CRUMB_EEPROM				3		/* EEPROM_MIRROR_Task() */
+#define CRUMB_SHELL					4		/* SHELL_Task() */
+#define CRUMB_LCD_MSG				5		/* Print_LCD_msg() */
+
+/*Reset log crumbs and trace ids of the interrupts (0 is RESET_LOG_NO_ISR)*/
+#define CRUMB_ISR_UART_CMD			1		/* UART_Get_Cmd() */
+#define CRUMB_ISR_LCD_MSG			2		/* UART_Get_LCD_msg() */
+#define CRUMB_ISR_CONNECTION		3		/* Check_Connection() */
+#define CRUMB_ISR_REVERSE			4		/* Back_Reverse() */
 /*_______________________________________________________________________________________________*/
 
 
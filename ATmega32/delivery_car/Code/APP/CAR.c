@@ -0,0 +1,518 @@
+/****************************************************************************
+ * @file    CAR.c
+ * @author  Boles Medhat
+ * @brief   Delivery Car Application Logic Source File
+ * @version 1.0
+ * @date    [2024-08-03]
+ *
+ * @details
+ * This file contains the application logic of the delivery car. The
+ * hardware is used only through the CAR_PORT_ functions, so this file is
+ * built unchanged for the car (with `APP.c`) and for the host simulation
+ * (with `Sim/SIM_PORT.c`).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ******************************************************************************/
+
+#include "CAR.h"
+#include "../LIB/POOL/POOL.h"
+#include "../LIB/QUEUE/QUEUE.h"
+
+
+uint8 input_pass[ PASS_SIZE ] = {};
+uint8 pass[ PASS_SIZE ] = {};
+
+
+uint8 command = STOP;
+
+
+uint8 tcnt;
+uint16 ovfCounts = 0;
+
+/* Overflow counters of Back_Reverse and Check_Connection */
+static volatile uint16 reverse_counter = 0;
+static volatile uint16 connection_counter = 0;
+
+
+
+uint16 front_distance;
+uint16 back_distance;
+
+bool front_blocked = false;
+bool back_blocked  = false;
+
+bool car_connected = true;
+
+/* Received command (the second byte is for the UART_STOPCHAR) */
+uint8 uart_command[2];
+
+/* Pool block of the LCD message being received (NULL when the message is skipped) */
+uint8 * lcd_msg_block = NULL;
+
+/* LCD clear received and waiting for the main loop (a message received after it clears the screen anyway) */
+volatile bool lcd_clear_pending = false;
+
+/* Received LCD messages (pool blocks) waiting to be printed by the main loop */
+QUEUE_DEFINE( LCD_MSG , uint8 * , LCD_MSG_QUEUE_SIZE )
+LCD_MSG_Queue lcd_msg_queue;
+
+#if LCD_MSG_QUEUE_SIZE < POOL_BLOCKS
+	#error "LCD_MSG_QUEUE_SIZE must not be less than POOL_BLOCKS"
+#endif
+
+
+DrivePath path;
+
+
+
+
+void Save_Move();
+
+void UART_Get_LCD_msg();
+
+void UART_Skip_LCD_msg();
+
+void Keypad_Get_Pass( uint8 * password );
+
+void Save_pass( uint8 * password );
+
+bool Is_Pass_Valid();
+
+
+
+
+void CAR_Init()
+{
+	command = STOP;
+	ovfCounts = 0;
+	reverse_counter = 0;
+	connection_counter = 0;
+
+	front_blocked = false;
+	back_blocked  = false;
+	car_connected = true;
+
+	lcd_msg_block = NULL;
+	lcd_clear_pending = false;
+
+	POOL_Init();
+	LCD_MSG_Init( &lcd_msg_queue );
+
+	DRIVE_Init( &path );
+
+	CAR_PORT_SetSpeed( 51 * MIN_GEAR );
+}
+
+void CAR_Start( uint16 ovfs , uint8 timer_value )
+{
+	CAR_PORT_SetReceiver( UART_Get_Cmd , uart_command , 1 );
+
+	ovfCounts = ovfs;
+	tcnt = timer_value;
+
+	CAR_PORT_ResetTimer();
+	CAR_PORT_SetTimerCallback( Check_Connection );
+}
+
+void Back_Reverse()
+{
+	reverse_counter++;
+
+	CAR_PORT_Tick();
+
+	if (reverse_counter < ovfCounts) return;
+	reverse_counter = 0;
+
+	CAR_PORT_IsrBegin( CRUMB_ISR_REVERSE );
+
+	struct reverse move;
+
+	if ( !DRIVE_PopMove( &path , &move ) )
+	{
+		CAR_PORT_SetMotors( STOP );
+		CAR_PORT_Restart();
+		return;
+	}
+
+	if (path.reversed_mode != STOP)
+	{
+		ovfCounts = move.ovfs;
+		CAR_PORT_SetTimerValue( move.tcnt );
+		CAR_PORT_SetSpeed( 51 * move.gear );
+
+		/* The mode keeps the low 3 bits of the move command ('1' to '5') */
+		CAR_PORT_SetMotors( '0' + move.mode );
+	}
+
+	CAR_PORT_IsrEnd();
+}
+
+void Save_Move()
+{
+	DRIVE_SaveMove( &path , CAR_PORT_GetTimerOverflows() , CAR_PORT_GetTimerValue() );
+
+	CAR_PORT_ResetTimer();
+}
+
+void UART_Get_Cmd()
+{
+	CAR_PORT_IsrBegin( CRUMB_ISR_UART_CMD );
+
+	command = uart_command[0];
+	car_connected = true;
+
+	switch ( command )
+	{
+
+		case FORWARD:
+		case BACKWARD:
+		case STOP:
+		case STEER_RIGHT:
+		case STEER_LEFT:
+
+			CAR_PORT_SetMotors( command );
+			Save_Move();
+			DRIVE_SetMove( &path , command );
+			break;
+
+
+		case GEARUP:
+
+			if(path.gear < MAX_GEAR)
+			{
+				Save_Move();
+				path.gear++;
+				CAR_PORT_SetSpeed( 51 * path.gear );
+			}
+			break;
+
+
+		case GEARDOWN:
+
+			if(path.gear > MIN_GEAR)
+			{
+				Save_Move();
+				path.gear--;
+				CAR_PORT_SetSpeed( 51 * path.gear );
+			}
+			break;
+
+
+		case CLR_SCREEN:
+
+			/* The main loop drives the LCD, clear it there */
+			lcd_clear_pending = true;
+			break;
+
+		case SEND_LCD:
+
+			lcd_msg_block = POOL_Alloc();
+
+			if ( lcd_msg_block != NULL )
+			{
+				CAR_PORT_SetReceiver( UART_Get_LCD_msg , lcd_msg_block , LCD_MSG_SIZE );
+			}
+			else
+			{
+				/* All the blocks wait to be printed, skip the message bytes */
+				CAR_PORT_SetReceiver( UART_Skip_LCD_msg , uart_command , 1 );
+			}
+			break;
+
+		case REVERSE:
+
+			Save_Move();
+
+			CAR_PORT_SetMotors( STOP );
+			CAR_PORT_DisableReceiver();
+			CAR_PORT_SetTimerCallback( Back_Reverse );
+			ovfCounts = 0;
+			CAR_PORT_SetTimerValue( 255 );
+			break;
+
+		case BUZZER_ON:
+
+			CAR_PORT_SetBuzzer( true );
+			break;
+
+		case BUZZER_OFF:
+
+			CAR_PORT_SetBuzzer( false );
+			break;
+
+		case SHELL_MODE:
+
+			CAR_PORT_SetMotors( STOP );
+			Save_Move();
+			DRIVE_SetMove( &path , STOP );
+			CAR_PORT_StartShell();
+			break;
+
+	}
+
+	CAR_PORT_IsrEnd();
+}
+
+void UART_Get_LCD_msg()
+{
+	CAR_PORT_IsrBegin( CRUMB_ISR_LCD_MSG );
+
+	/* Hand the block to the main loop (the queue has a place for every block) */
+	LCD_MSG_Push( &lcd_msg_queue , lcd_msg_block );
+	lcd_msg_block = NULL;
+
+	/* The message clears the screen before it is printed */
+	lcd_clear_pending = false;
+
+	CAR_PORT_SetReceiver( UART_Get_Cmd , uart_command , 1 );
+	car_connected = true;
+
+	CAR_PORT_IsrEnd();
+}
+
+void UART_Skip_LCD_msg()
+{
+	if ( uart_command[0] == UART_STOPCHAR )
+	{
+		CAR_PORT_SetReceiver( UART_Get_Cmd , uart_command , 1 );
+		car_connected = true;
+	}
+}
+
+void Print_LCD_msg()
+{
+	uint8 * msg;
+
+	while ( LCD_MSG_Pop( &lcd_msg_queue , &msg ) )
+	{
+		/* End the string at the UART_STOPCHAR (or at the end of a full block) */
+		msg[ LCD_MSG_SIZE ] = '\0';
+
+		for ( uint8 i = 0 ; i < LCD_MSG_SIZE ; i++ )
+		{
+			if ( msg[i] == UART_STOPCHAR )
+			{
+				msg[i] = '\0';
+				break;
+			}
+		}
+
+		CAR_PORT_ClearScreen();
+		CAR_PORT_PrintString( (char *)msg );
+
+		POOL_Free( msg );
+	}
+
+	/* A clear received after the last message */
+	if ( lcd_clear_pending )
+	{
+		lcd_clear_pending = false;
+		CAR_PORT_ClearScreen();
+	}
+}
+
+void Shell_Exit()
+{
+	command = STOP;
+	CAR_PORT_SetReceiver( UART_Get_Cmd , uart_command , 1 );
+}
+
+void Check_Connection()
+{
+	connection_counter++;
+
+	CAR_PORT_Tick();
+	CAR_PORT_IsrBegin( CRUMB_ISR_CONNECTION );
+	if(connection_counter >= ovfCounts)
+	{
+		CAR_PORT_SetTimerValue( tcnt );
+		connection_counter = 0;
+
+		if( car_connected == false )
+		{
+			Save_Move();
+			CAR_PORT_SetMotors( STOP );
+			CAR_PORT_DisableReceiver();
+			CAR_PORT_SetTimerCallback( Back_Reverse );
+			ovfCounts = 0;
+			CAR_PORT_SetTimerValue( 255 );
+			command = REVERSE;
+		}
+		else if( (command == STOP) || (command == SEND_LCD) || (command == SHELL_MODE) )
+		{
+			car_connected = true;
+		}
+		else
+		{
+			car_connected = false;
+		}
+	}
+
+	CAR_PORT_IsrEnd();
+}
+
+void Keypad_Get_Pass( uint8 * password )
+{
+	CAR_PORT_ClearScreen();
+	CAR_PORT_PrintString("set pass:");
+
+	uint8 key;
+
+	for ( uint8 i = 0 ; i < PASS_SIZE ; i++ )
+	{
+		do
+		{
+			key = CAR_PORT_GetKey();
+		}while ( key == CAR_NO_KEY );
+
+		password[i] = key;
+
+		CAR_PORT_PrintChar( key );
+		CAR_PORT_DelayMs(500);
+
+		CAR_PORT_SetCursor( 0 , 9 + i );
+		CAR_PORT_PrintChar('*');
+
+	}
+	CAR_PORT_DelayMs(500);
+	CAR_PORT_ClearScreen();
+
+
+}
+
+void Save_pass( uint8 * password )
+{
+	CAR_PORT_WriteStorage( PASS_ADDRESS , password , PASS_SIZE );
+
+	CAR_PORT_ClearScreen();
+	CAR_PORT_PrintString("Password is set");
+	CAR_PORT_DelayMs(1000);
+	CAR_PORT_ClearScreen();
+}
+
+void Load_pass()
+{
+	uint8 status;
+
+	CAR_PORT_ReadStorage( PASS_STATUS_ADDRESS , &status , 1 );
+
+	if ( status == NO_PASS )
+	{
+		Keypad_Get_Pass( pass );
+		Save_pass( pass );
+
+		status = PASS_SAVED;
+		CAR_PORT_WriteStorage( PASS_STATUS_ADDRESS , &status , 1 );
+	}
+	else
+	{
+		CAR_PORT_ReadStorage( PASS_ADDRESS , pass , PASS_SIZE );
+	}
+}
+
+bool Is_Pass_Valid()
+{
+	for ( uint8 i = 0 ; i < PASS_SIZE ; i++ )
+	{
+		if( input_pass[i] != pass[i] )
+		{
+			CAR_PORT_ClearScreen();
+			CAR_PORT_PrintString("Wrong password");
+
+			return false;
+		}
+	}
+
+	CAR_PORT_ClearScreen();
+	CAR_PORT_PrintString("Password correct");
+
+	return true;
+}
+
+void Check_Pass()
+{
+	uint8 key = CAR_PORT_GetKey();
+
+	if ( (key != CAR_NO_KEY) && (key != '*') )
+	{
+		Keypad_Get_Pass( input_pass );
+
+		if ( Is_Pass_Valid() )
+		{
+
+			CAR_PORT_SetCursor(1,3);
+			CAR_PORT_PrintString("BOX OPENED");
+			CAR_PORT_OpenBox();
+		}
+
+		CAR_PORT_DelayMs(1000);
+		CAR_PORT_ClearScreen();
+
+	}
+	else if (key == '*')
+	{
+		CAR_PORT_ClearScreen();
+		CAR_PORT_PrintString(" Enter old pass");
+		CAR_PORT_DelayMs(1000);
+
+		Keypad_Get_Pass( input_pass );
+
+		if( Is_Pass_Valid() )
+		{
+			CAR_PORT_SetCursor( 1 , 0 );
+			CAR_PORT_PrintString(" Enter new pass");
+			CAR_PORT_DelayMs(1000);
+
+			Keypad_Get_Pass( pass );
+			Save_pass( pass );
+		}
+		else
+		{
+			CAR_PORT_DelayMs(1000);
+			CAR_PORT_ClearScreen();
+		}
+	}
+}
+
+void Obstacle_Detection()
+{
+	front_distance = CAR_PORT_ReadDistance( CAR_FRONT_SENSOR );
+	back_distance = CAR_PORT_ReadDistance( CAR_BACK_SENSOR );
+
+	bool moving_forward  = (command == FORWARD)  || ((command == REVERSE) && (path.reversed_mode == FORWARD));
+	bool moving_backward = (command == BACKWARD) || ((command == REVERSE) && (path.reversed_mode == BACKWARD));
+
+	switch ( DRIVE_CheckObstacle( moving_forward , front_distance , &front_blocked ) )
+	{
+		case DRIVE_OBSTACLE_STOP:
+
+			CAR_PORT_SetMotors( STOP );
+			CAR_PORT_EnableTimer( false );
+			break;
+
+		case DRIVE_OBSTACLE_RESUME:
+
+			CAR_PORT_SetMotors( FORWARD );
+			CAR_PORT_EnableTimer( true );
+			break;
+	}
+
+	switch ( DRIVE_CheckObstacle( moving_backward , back_distance , &back_blocked ) )
+	{
+		case DRIVE_OBSTACLE_STOP:
+
+			CAR_PORT_SetMotors( STOP );
+			CAR_PORT_EnableTimer( false );
+			break;
+
+		case DRIVE_OBSTACLE_RESUME:
+
+			CAR_PORT_SetMotors( BACKWARD );
+			CAR_PORT_EnableTimer( true );
+			break;
+	}
+}
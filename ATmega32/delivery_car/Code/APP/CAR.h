@@ -0,0 +1,333 @@
+/****************************************************************************
+ * @file    CAR.h
+ * @author  Boles Medhat
+ * @brief   Delivery Car Application Logic Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ *
+ * @details
+ * This file declares the application logic of the delivery car: the UART
+ * commands, the connection check, the reverse playback, the obstacle stop,
+ * the LCD messages and the keypad password of the box.
+ * The logic does not call the drivers directly, it calls the CAR_PORT_
+ * functions declared at the end of this file:
+ * - On the car they are implemented by `APP.c` with the MCAL and HAL drivers.
+ * - On the host they are implemented by `Sim/SIM_PORT.c` with the simulated
+ *   vehicle, UART peer, keypad and LCD.
+ * So the same `CAR.c` runs on the car and in the simulation.
+ *
+ * @note
+ * - The callbacks that are called from an interrupt (UART_Get_Cmd,
+ *   UART_Get_LCD_msg, UART_Skip_LCD_msg, Check_Connection, Back_Reverse) only
+ *   use the port functions that do not wait.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ***************************************************************************/
+
+#ifndef CAR_H_
+#define CAR_H_
+
+#include "../LIB/STD_TYPES.h"
+#include "APP_def.h"
+#include "DRIVE.h"
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Distance sensors of CAR_PORT_ReadDistance*/
+#define CAR_FRONT_SENSOR			0		/*Front ultrasonic sensor*/
+#define CAR_BACK_SENSOR				1		/*Back ultrasonic sensor*/
+
+/*Returned by CAR_PORT_GetKey when no key is pressed*/
+#define CAR_NO_KEY					0xFF
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   state    -----------------------------------------*/
+
+/*Last received command*/
+extern uint8 command;
+
+/*Last measured distances (cm)*/
+extern uint16 front_distance;
+extern uint16 back_distance;
+
+/*Recorded path and gear*/
+extern DrivePath path;
+/*_______________________________________________________________________________________________*/
+
+
+
+/*---------------------------- Function Prototypes --------------------------*/
+
+
+/*
+ * @brief Initialize the logic state (stopped, no recorded moves, lowest gear, no LCD messages).
+ */
+void CAR_Init( void );
+
+
+/*
+ * @brief Load the box password, or ask for a new one on the keypad if none is saved.
+ */
+void Load_pass( void );
+
+
+/*
+ * @brief Start receiving the UART commands and checking the connection.
+ *
+ * @param ovfs:        Timer0 overflows of the connection check period.
+ * @param timer_value: Timer0 preload value of the connection check period.
+ */
+void CAR_Start( uint16 ovfs , uint8 timer_value );
+
+
+/*
+ * @brief UART callback of the commands.
+ */
+void UART_Get_Cmd( void );
+
+
+/*
+ * @brief Timer0 overflow callback while driving (stops and replays the path if no command comes in a period).
+ */
+void Check_Connection( void );
+
+
+/*
+ * @brief Timer0 overflow callback of the reverse playback.
+ */
+void Back_Reverse( void );
+
+
+/*
+ * @brief Return to the commands after the UART shell exits.
+ */
+void Shell_Exit( void );
+
+
+/*
+ * @brief Main loop task: open the box or change the password when a key is pressed.
+ */
+void Check_Pass( void );
+
+
+/*
+ * @brief Main loop task: stop the car before an obstacle and continue after it is removed.
+ */
+void Obstacle_Detection( void );
+
+
+/*
+ * @brief Main loop task: print the received LCD messages.
+ */
+void Print_LCD_msg( void );
+
+
+
+/*------------------------------ Port Functions -----------------------------*/
+
+
+/*
+ * @brief Drive the motors.
+ *
+ * @param move: [ FORWARD , BACKWARD , STOP , STEER_RIGHT , STEER_LEFT ].
+ */
+void CAR_PORT_SetMotors( uint8 move );
+
+
+/*
+ * @brief Set the speed of the motors (OC2 compare value).
+ *
+ * @param duty: Duty from 0 to 255.
+ */
+void CAR_PORT_SetSpeed( uint8 duty );
+
+
+/*
+ * @brief Turn the buzzer ON or OFF.
+ *
+ * @param on: true to turn it ON.
+ */
+void CAR_PORT_SetBuzzer( bool on );
+
+
+/*
+ * @brief Open the box lock.
+ */
+void CAR_PORT_OpenBox( void );
+
+
+/*
+ * @brief Measure a distance (waits for the echo).
+ *
+ * @param sensor: [ CAR_FRONT_SENSOR , CAR_BACK_SENSOR ].
+ *
+ * @return (uint16) Distance in cm.
+ */
+uint16 CAR_PORT_ReadDistance( uint8 sensor );
+
+
+/*
+ * @brief Get the Timer0 overflows since the last CAR_PORT_ResetTimer.
+ */
+uint16 CAR_PORT_GetTimerOverflows( void );
+
+
+/*
+ * @brief Get the Timer0 counter value.
+ */
+uint8 CAR_PORT_GetTimerValue( void );
+
+
+/*
+ * @brief Set the Timer0 counter value.
+ *
+ * @param value: Counter value.
+ */
+void CAR_PORT_SetTimerValue( uint8 value );
+
+
+/*
+ * @brief Set the Timer0 counter and overflows to 0.
+ */
+void CAR_PORT_ResetTimer( void );
+
+
+/*
+ * @brief Start or stop Timer0 (the path timing and the connection check).
+ *
+ * @param enable: true to start it.
+ */
+void CAR_PORT_EnableTimer( bool enable );
+
+
+/*
+ * @brief Set the Timer0 overflow callback.
+ *
+ * @param callback: Called from the Timer0 overflow interrupt, before the overflows are counted.
+ */
+void CAR_PORT_SetTimerCallback( void (*callback)(void) );
+
+
+/*
+ * @brief Set the UART receive buffer and its callback (as UART_Set_RX_Callback with UART_STOPCHAR).
+ *
+ * @param callback: Called from the UART RX interrupt when the buffer is full or UART_STOPCHAR is received.
+ * @param buffer:   Receive buffer.
+ * @param size:     Size of the buffer.
+ */
+void CAR_PORT_SetReceiver( void (*callback)(void) , uint8 * buffer , uint8 size );
+
+
+/*
+ * @brief Stop receiving UART bytes.
+ */
+void CAR_PORT_DisableReceiver( void );
+
+
+/*
+ * @brief Start the UART shell (it calls Shell_Exit when it exits).
+ */
+void CAR_PORT_StartShell( void );
+
+
+/*
+ * @brief Get the pressed key (does not wait).
+ *
+ * @return (uint8) The key character, or CAR_NO_KEY.
+ */
+uint8 CAR_PORT_GetKey( void );
+
+
+/*
+ * @brief Clear the LCD.
+ */
+void CAR_PORT_ClearScreen( void );
+
+
+/*
+ * @brief Move the LCD cursor.
+ *
+ * @param row: Row (0 or 1).
+ * @param col: Column (0 to 15).
+ */
+void CAR_PORT_SetCursor( uint8 row , uint8 col );
+
+
+/*
+ * @brief Print a character on the LCD.
+ *
+ * @param character: The character.
+ */
+void CAR_PORT_PrintChar( uint8 character );
+
+
+/*
+ * @brief Print a string on the LCD.
+ *
+ * @param string: The string.
+ */
+void CAR_PORT_PrintString( const char * string );
+
+
+/*
+ * @brief Wait.
+ *
+ * @param ms: Time in ms.
+ */
+void CAR_PORT_DelayMs( uint16 ms );
+
+
+/*
+ * @brief Read bytes of the EEPROM.
+ *
+ * @param address: EEPROM address.
+ * @param data:    Buffer of the bytes.
+ * @param size:    Number of bytes.
+ */
+void CAR_PORT_ReadStorage( uint16 address , uint8 * data , uint8 size );
+
+
+/*
+ * @brief Write bytes to the EEPROM (they are saved when the function returns).
+ *
+ * @param address: EEPROM address.
+ * @param data:    The bytes.
+ * @param size:    Number of bytes.
+ */
+void CAR_PORT_WriteStorage( uint16 address , const uint8 * data , uint8 size );
+
+
+/*
+ * @brief Mark the start of an interrupt callback (reset log crumb).
+ *
+ * @param id: CRUMB_ISR_ id of the callback.
+ */
+void CAR_PORT_IsrBegin( uint8 id );
+
+
+/*
+ * @brief Mark the end of an interrupt callback.
+ */
+void CAR_PORT_IsrEnd( void );
+
+
+/*
+ * @brief Count the reset log timestamp (called on every Timer0 overflow).
+ */
+void CAR_PORT_Tick( void );
+
+
+/*
+ * @brief Restart the car (after the reverse playback, does not return on the car).
+ */
+void CAR_PORT_Restart( void );
+
+
+#endif /* CAR_H_ */
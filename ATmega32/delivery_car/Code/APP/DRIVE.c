@@ -0,0 +1,166 @@
+/****************************************************************************
+ * @file    DRIVE.c
+ * @author  Boles Medhat
+ * @brief   Delivery Car Drive Logic Source File
+ * @version 1.0
+ * @date    [2024-08-03]
+ *
+ * @details
+ * This file contains the hardware independent logic of the delivery car:
+ * move recording for the reverse playback and the obstacle decisions.
+ * All the state is passed in a DrivePath struct.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ******************************************************************************/
+
+
+#include "DRIVE.h"
+
+
+
+
+
+/*
+ * @brief Initialize the path (no moves, stopped, lowest gear).
+ *
+ * @param path: Pointer to the path.
+ */
+void DRIVE_Init( DrivePath * path )
+{
+	path->top           = 0;
+	path->reversed_mode = STOP;
+	path->gear          = MIN_GEAR;
+}
+
+
+
+
+
+/*
+ * @brief Get the move that cancels a move.
+ *
+ * @param mode: Move [ FORWARD , BACKWARD , STEER_RIGHT , STEER_LEFT , STOP ].
+ *
+ * @return (uint8) Reverse move, STOP for any other command.
+ */
+uint8 DRIVE_ReverseOf( uint8 mode )
+{
+	switch ( mode )
+	{
+		case FORWARD:		return BACKWARD;
+		case BACKWARD:		return FORWARD;
+		case STEER_RIGHT:	return STEER_LEFT;
+		case STEER_LEFT:	return STEER_RIGHT;
+		default:			return STOP;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Record the end of the current move.
+ *
+ * The reverse of the current move is pushed with its gear and duration,
+ * a stopped car (or a full path) records nothing.
+ *
+ * @param path: Pointer to the path.
+ * @param ovfs: Timer0 overflows since the start of the current move.
+ * @param tcnt: Timer0 counter value at the end of the current move.
+ */
+void DRIVE_SaveMove( DrivePath * path , uint16 ovfs , uint8 tcnt )
+{
+	if( ( path->reversed_mode != STOP ) && ( path->top < MAX_MOVES ) )
+	{
+		path->moves[ path->top ].tcnt = tcnt;
+		path->moves[ path->top ].ovfs = ovfs;
+		path->moves[ path->top ].mode = path->reversed_mode;
+		path->moves[ path->top ].gear = path->gear;
+
+		path->top++;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Start a new move (the previous move must be saved first).
+ *
+ * @param path: Pointer to the path.
+ * @param mode: New move [ FORWARD , BACKWARD , STEER_RIGHT , STEER_LEFT , STOP ].
+ */
+void DRIVE_SetMove( DrivePath * path , uint8 mode )
+{
+	path->reversed_mode = DRIVE_ReverseOf( mode );
+}
+
+
+
+
+
+/*
+ * @brief Take the last recorded move for the reverse playback.
+ *
+ * @param path: Pointer to the path.
+ * @param move: Pointer to store the move.
+ *
+ * @return (bool) true if a move is taken, false if the path is empty (the car is back at the start).
+ */
+bool DRIVE_PopMove( DrivePath * path , struct reverse * move )
+{
+	if ( path->top == 0 )
+	{
+		return false;
+	}
+
+	path->top--;
+
+	*move = path->moves[ path->top ];
+
+	return true;
+}
+
+
+
+
+
+/*
+ * @brief Decide to stop or resume the car for one distance sensor.
+ *
+ * @param moving_to: true if the car moves toward the side of the sensor.
+ * @param distance:  Measured distance in cm.
+ * @param blocked:   Pointer to the blocked state of the side (updated by the function).
+ *
+ * @return (uint8) Decision [ DRIVE_OBSTACLE_NONE , DRIVE_OBSTACLE_STOP , DRIVE_OBSTACLE_RESUME ].
+ */
+uint8 DRIVE_CheckObstacle( bool moving_to , uint16 distance , bool * blocked )
+{
+	if ( moving_to && ( distance < OBSTACLE_DISTANCE ) )
+	{
+		/* Stop once when the obstacle is found */
+		if ( !( *blocked ) )
+		{
+			*blocked = true;
+			return DRIVE_OBSTACLE_STOP;
+		}
+	}
+	else if ( *blocked && ( distance >= OBSTACLE_DISTANCE ) )
+	{
+		*blocked = false;
+		return DRIVE_OBSTACLE_RESUME;
+	}
+
+	return DRIVE_OBSTACLE_NONE;
+}
+
+
+
+
+
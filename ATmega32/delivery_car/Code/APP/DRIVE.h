@@ -0,0 +1,124 @@
+/****************************************************************************
+ * @file    DRIVE.h
+ * @author  Boles Medhat
+ * @brief   Delivery Car Drive Logic Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ *
+ * @details
+ * This file declares the hardware independent logic of the delivery car:
+ * the recording of the moves for the reverse playback, and the obstacle
+ * stop / resume decision. All the state is kept in a DrivePath struct and
+ * the times are passed as Timer0 overflows and counter values, so the same
+ * functions can be driven by the firmware or by a simulated vehicle on the
+ * host (commands in, motor modes and recorded path out).
+ *
+ * @note
+ * - The logic does not include any MCAL or HAL driver, it can be compiled
+ *   for the host as it is.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ***************************************************************************/
+
+#ifndef DRIVE_H_
+#define DRIVE_H_
+
+#include "../LIB/STD_TYPES.h"
+#include "APP_def.h"
+
+
+/*------------------------------------------   types    -----------------------------------------*/
+
+/*Recorded path of the car*/
+typedef struct
+{
+	struct reverse moves[ MAX_MOVES ];		/*Recorded moves, each one is the reverse of a driven move*/
+	uint16 top;								/*Number of recorded moves*/
+	uint8  reversed_mode;					/*Reverse of the current move [ FORWARD , BACKWARD , STEER_RIGHT , STEER_LEFT , STOP ]*/
+	uint8  gear;							/*Current gear (from MIN_GEAR to MAX_GEAR)*/
+}DrivePath;
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Obstacle decisions*/
+#define DRIVE_OBSTACLE_NONE			0		/*Nothing to change*/
+#define DRIVE_OBSTACLE_STOP			1		/*An obstacle is closer than OBSTACLE_DISTANCE, stop the car*/
+#define DRIVE_OBSTACLE_RESUME		2		/*The obstacle is removed, continue the stopped move*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*---------------------------- Function Prototypes --------------------------*/
+
+
+/*
+ * @brief Initialize the path (no moves, stopped, lowest gear).
+ *
+ * @param path: Pointer to the path.
+ */
+void DRIVE_Init( DrivePath * path );
+
+
+/*
+ * @brief Get the move that cancels a move.
+ *
+ * @param mode: Move [ FORWARD , BACKWARD , STEER_RIGHT , STEER_LEFT , STOP ].
+ *
+ * @return (uint8) Reverse move, STOP for any other command.
+ */
+uint8 DRIVE_ReverseOf( uint8 mode );
+
+
+/*
+ * @brief Record the end of the current move.
+ *
+ * The reverse of the current move is pushed with its gear and duration,
+ * a stopped car (or a full path) records nothing.
+ *
+ * @param path: Pointer to the path.
+ * @param ovfs: Timer0 overflows since the start of the current move.
+ * @param tcnt: Timer0 counter value at the end of the current move.
+ */
+void DRIVE_SaveMove( DrivePath * path , uint16 ovfs , uint8 tcnt );
+
+
+/*
+ * @brief Start a new move (the previous move must be saved first).
+ *
+ * @param path: Pointer to the path.
+ * @param mode: New move [ FORWARD , BACKWARD , STEER_RIGHT , STEER_LEFT , STOP ].
+ */
+void DRIVE_SetMove( DrivePath * path , uint8 mode );
+
+
+/*
+ * @brief Take the last recorded move for the reverse playback.
+ *
+ * @param path: Pointer to the path.
+ * @param move: Pointer to store the move.
+ *
+ * @return (bool) true if a move is taken, false if the path is empty (the car is back at the start).
+ */
+bool DRIVE_PopMove( DrivePath * path , struct reverse * move );
+
+
+/*
+ * @brief Decide to stop or resume the car for one distance sensor.
+ *
+ * @param moving_to: true if the car moves toward the side of the sensor.
+ * @param distance:  Measured distance in cm.
+ * @param blocked:   Pointer to the blocked state of the side (updated by the function).
+ *
+ * @return (uint8) Decision [ DRIVE_OBSTACLE_NONE , DRIVE_OBSTACLE_STOP , DRIVE_OBSTACLE_RESUME ].
+ */
+uint8 DRIVE_CheckObstacle( bool moving_to , uint16 distance , bool * blocked );
+
+
+#endif /* DRIVE_H_ */
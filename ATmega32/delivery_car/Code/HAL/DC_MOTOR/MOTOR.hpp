@@ -0,0 +1,145 @@
+/****************************************************************************
+ * @file    MOTOR.hpp
+ * @author  Boles Medhat
+ * @brief   DC Motor Compile-Time Templates Header File (C++)
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This optional C++ header is the MOTOR driver with the H-Bridge pins as
+ * template parameters (see `DIO.hpp`), so a direction change is two register
+ * bit instructions instead of two DIO_SetPinValue calls, and the two pins can
+ * be on different ports:
+ *
+ *     typedef io::Motor< io::Pin< io::Port< RIGHT_MOTOR_PORT > , RIGHT_MOTOR_F_PIN > ,
+ *                        io::Pin< io::Port< RIGHT_MOTOR_PORT > , RIGHT_MOTOR_S_PIN > > Right;
+ *     typedef io::Motor< io::Pin< io::Port< LEFT_MOTOR_PORT >  , LEFT_MOTOR_F_PIN > ,
+ *                        io::Pin< io::Port< LEFT_MOTOR_PORT >  , LEFT_MOTOR_S_PIN > >  Left;
+ *     typedef io::MotorPair< Right , Left > Car;
+ *     Car::Init();
+ *     Car::SetDirection( MOTOR_TURN_RIGHT );
+ *
+ * Motor::ToC() returns the C `Motor` structure of the same pins, for the C
+ * MOTOR functions.
+ *
+ * @note
+ * - Needs a C++ compiler, see `DIO.hpp`.
+ * - The turns follow MOTOR_STEERING_MODE, the same as the C driver.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ******************************************************************************/
+
+#ifndef MOTOR_HPP_
+#define MOTOR_HPP_
+
+#include "../../MCAL/DIO/DIO.hpp"
+
+extern "C"
+{
+	#include "MOTOR.h"
+}
+
+
+namespace io
+{
+
+/*
+ * @brief DC motor on the two H-Bridge pin types.
+ */
+template< class FIRST , class SECOND >
+struct Motor
+{
+	/* Sets the control pins as outputs */
+	static void Init( void )		{ FIRST::SetOutput(); SECOND::SetOutput(); }
+
+	/* Moves the motor forward */
+	static void Forward( void )		{ FIRST::High(); SECOND::Low(); }
+
+	/* Moves the motor backward */
+	static void Backward( void )	{ FIRST::Low();  SECOND::High(); }
+
+	/* Stops the motor */
+	static void Stop( void )		{ FIRST::Low();  SECOND::Low(); }
+
+	/* Returns the C `Motor` structure of the same pins (both pins must be on one port) */
+	static ::Motor ToC( void )
+	{
+		static_assert( FIRST::port == SECOND::port , "The C Motor structure needs both pins on one port" );
+
+		::Motor motor = { FIRST::port , FIRST::pin , SECOND::pin };
+		return motor;
+	}
+};
+
+
+
+
+/*
+ * @brief Right and left DC motors of a car (same functions as MOTOR_Both* and MOTOR_Turn*).
+ */
+template< class RIGHT , class LEFT >
+struct MotorPair
+{
+	/* Sets the control pins of both motors as outputs */
+	static void Init( void )		{ RIGHT::Init();     LEFT::Init(); }
+
+	/* Moves both motors forward */
+	static void Forward( void )		{ LEFT::Forward();   RIGHT::Forward(); }
+
+	/* Moves both motors backward */
+	static void Backward( void )	{ LEFT::Backward();  RIGHT::Backward(); }
+
+	/* Stops both motors */
+	static void Stop( void )		{ LEFT::Stop();      RIGHT::Stop(); }
+
+	/* Turns right (the right motor stops or reverses by MOTOR_STEERING_MODE) */
+	static void TurnRight( void )
+	{
+		LEFT::Forward();
+
+		#if   MOTOR_STEERING_MODE == MOTOR_STOP_ON_TURN
+			RIGHT::Stop();
+		#elif MOTOR_STEERING_MODE == MOTOR_REVERSE_ON_TURN
+			RIGHT::Backward();
+		#else
+			#error "Wrong \"MOTOR_STEERING_MODE\" configuration option"
+		#endif
+	}
+
+	/* Turns left (the left motor stops or reverses by MOTOR_STEERING_MODE) */
+	static void TurnLeft( void )
+	{
+		RIGHT::Forward();
+
+		#if   MOTOR_STEERING_MODE == MOTOR_STOP_ON_TURN
+			LEFT::Stop();
+		#elif MOTOR_STEERING_MODE == MOTOR_REVERSE_ON_TURN
+			LEFT::Backward();
+		#else
+			#error "Wrong \"MOTOR_STEERING_MODE\" configuration option"
+		#endif
+	}
+
+	/* Sets the direction (MOTOR_FORWARD, MOTOR_BACKWARD, MOTOR_TURN_RIGHT, MOTOR_TURN_LEFT, any other value stops) */
+	static void SetDirection( uint8 direction )
+	{
+		switch ( direction )
+		{
+			case MOTOR_FORWARD:		Forward();		break;
+			case MOTOR_BACKWARD:	Backward();		break;
+			case MOTOR_TURN_RIGHT:	TurnRight();	break;
+			case MOTOR_TURN_LEFT:	TurnLeft();		break;
+			default:				Stop();			break;
+		}
+	}
+};
+
+}
+
+
+#endif /* MOTOR_HPP_ */
@@ -0,0 +1,372 @@
+/****************************************************************************
+ * @file    EEPROM_MIRROR.c
+ * @author  Boles Medhat
+ * @brief   EEPROM RAM Mirror Source File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file implements the RAM mirror of an EEPROM region.
+ * A bitmap has one bit per block of the mirror. The write-back takes the
+ * next dirty block, clears its bit (so a write during the write-back marks
+ * it again), then compares its bytes with the EEPROM and writes only the
+ * bytes that are different, which also saves the EEPROM endurance.
+ * The block being written back has no dirty bit and its position is not kept
+ * through a reset, so the brown-out flush does not trust the bitmap: it marks
+ * every block as dirty and compares the whole region with the EEPROM.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include "EEPROM_MIRROR.h"
+
+
+#if EEPROM_MIRROR_BROWNOUT_FLUSH == EEPROM_MIRROR_BROWNOUT_FLUSH_ENABLE
+/* Keep the mirror through a reset (not cleared by the startup code) */
+#define EEPROM_MIRROR_NOINIT		__attribute__((section(".noinit")))
+#else
+#define EEPROM_MIRROR_NOINIT
+#endif
+
+/* RAM copy of the mirrored region */
+static uint8 g_EEPROM_MIRROR_Data[ EEPROM_MIRROR_SIZE ] EEPROM_MIRROR_NOINIT;
+
+/* Dirty blocks bitmap (bit b%8 of byte b/8 is the block b) */
+static uint8 g_EEPROM_MIRROR_Dirty[ EEPROM_MIRROR_DIRTY_BYTES ] EEPROM_MIRROR_NOINIT;
+
+/* Sum of the bytes of the RAM copy (checks the mirror after a reset) */
+static uint8 g_EEPROM_MIRROR_Sum EEPROM_MIRROR_NOINIT;
+
+/* Equals EEPROM_MIRROR_GUARD when the mirror in RAM is valid */
+static uint16 g_EEPROM_MIRROR_Guard EEPROM_MIRROR_NOINIT;
+
+/* Block being written back and its next byte */
+static uint8 g_EEPROM_MIRROR_Block = EEPROM_MIRROR_NO_BLOCK;
+static uint8 g_EEPROM_MIRROR_Byte  = 0;
+
+
+
+
+
+/*
+ * @brief Calculates the sum of the bytes of the RAM copy.
+ *
+ * @return (uint8) Sum of the bytes (modulo 256).
+ */
+static uint8 EEPROM_MIRROR_Checksum( void )
+{
+	uint8 sum = 0;
+
+	for ( uint16 index = 0 ; index < EEPROM_MIRROR_SIZE ; index++ )
+	{
+		sum += g_EEPROM_MIRROR_Data[ index ];
+	}
+
+	return sum;
+}
+
+
+
+
+
+/*
+ * @brief Writes back one step of the dirty blocks.
+ *
+ * Takes the next dirty block if no block is being written back, then compares
+ * its bytes with the EEPROM until a changed byte is found and written.
+ *
+ * @return (bool) true if a byte is written to the EEPROM, false otherwise.
+ */
+static bool EEPROM_MIRROR_WriteBackStep( void )
+{
+
+	/* Take the next dirty block */
+	if ( g_EEPROM_MIRROR_Block == EEPROM_MIRROR_NO_BLOCK )
+	{
+		for ( uint8 block = 0 ; block < EEPROM_MIRROR_BLOCKS ; block++ )
+		{
+			if ( GET_BIT( g_EEPROM_MIRROR_Dirty[ block / 8 ] , block % 8 ) )
+			{
+				/* Clear the bit first, a write to the block from now marks it again */
+				CLR_BIT( g_EEPROM_MIRROR_Dirty[ block / 8 ] , block % 8 );
+
+				g_EEPROM_MIRROR_Block = block;
+				g_EEPROM_MIRROR_Byte  = 0;
+				break;
+			}
+		}
+
+		/* Stop if there is no dirty block */
+		if ( g_EEPROM_MIRROR_Block == EEPROM_MIRROR_NO_BLOCK )
+		{
+			return false;
+		}
+	}
+
+	/* Write the next byte of the block that is different from the EEPROM */
+	while ( g_EEPROM_MIRROR_Byte < EEPROM_MIRROR_BLOCK_SIZE )
+	{
+		uint16 index = (uint16)g_EEPROM_MIRROR_Block * EEPROM_MIRROR_BLOCK_SIZE + g_EEPROM_MIRROR_Byte;
+
+		g_EEPROM_MIRROR_Byte++;
+
+		if ( EEPROM_ReadByte( EEPROM_MIRROR_START + index ) != g_EEPROM_MIRROR_Data[ index ] )
+		{
+			EEPROM_WriteByte( EEPROM_MIRROR_START + index , g_EEPROM_MIRROR_Data[ index ] );
+
+			return true;
+		}
+	}
+
+	/* The block is written back */
+	g_EEPROM_MIRROR_Block = EEPROM_MIRROR_NO_BLOCK;
+
+	return false;
+}
+
+
+
+
+
+/*
+ * @brief Initializes the mirror.
+ *
+ * Loads the mirrored region from the EEPROM. In brown-out flush mode, after a
+ * brown-out reset with a valid mirror in RAM, the whole region is compared
+ * with the EEPROM and the unsaved changes are written instead (this blocks
+ * for about 8.5ms per changed byte).
+ */
+void EEPROM_MIRROR_Init( void )
+{
+
+#if EEPROM_MIRROR_BROWNOUT_FLUSH == EEPROM_MIRROR_BROWNOUT_FLUSH_ENABLE
+
+	/* Check that the reset is a brown-out and the RAM copy survived it */
+	if ( GET_BIT( WDT_GetResetFlags() , BORF ) &&
+		 ( g_EEPROM_MIRROR_Guard == EEPROM_MIRROR_GUARD ) &&
+		 ( g_EEPROM_MIRROR_Sum == EEPROM_MIRROR_Checksum() ) )
+	{
+		/* Compare every block, the block that was being written back has no dirty bit */
+		for ( uint8 block = 0 ; block < EEPROM_MIRROR_BLOCKS ; block++ )
+		{
+			SET_BIT( g_EEPROM_MIRROR_Dirty[ block / 8 ] , block % 8 );
+		}
+
+		/* Write the changes that were not written before the brown-out */
+		EEPROM_MIRROR_Commit();
+	}
+	else
+
+#endif
+	{
+		/* Load the mirrored region */
+		EEPROM_ReadArray( EEPROM_MIRROR_START , g_EEPROM_MIRROR_Data , EEPROM_MIRROR_SIZE );
+
+		/* All blocks are equal to the EEPROM */
+		for ( uint8 byte = 0 ; byte < EEPROM_MIRROR_DIRTY_BYTES ; byte++ )
+		{
+			g_EEPROM_MIRROR_Dirty[ byte ] = 0;
+		}
+	}
+
+	/* Mark the RAM copy as valid */
+	g_EEPROM_MIRROR_Sum   = EEPROM_MIRROR_Checksum();
+	g_EEPROM_MIRROR_Guard = EEPROM_MIRROR_GUARD;
+}
+
+
+
+
+
+/*
+ * @brief Reads a byte.
+ *
+ * @param address: EEPROM address (0-1023), read from RAM if it is in the mirrored region.
+ *
+ * @return (uint8) The byte at the address.
+ */
+uint8 EEPROM_MIRROR_ReadByte( uint16 address )
+{
+
+	/* Read from RAM if the address is mirrored */
+	if ( ( address >= EEPROM_MIRROR_START ) && ( address < EEPROM_MIRROR_END ) )
+	{
+		return g_EEPROM_MIRROR_Data[ address - EEPROM_MIRROR_START ];
+	}
+
+	/* Read other addresses from the EEPROM */
+	return EEPROM_ReadByte( address );
+}
+
+
+
+
+
+/*
+ * @brief Writes a byte.
+ *
+ * In the mirrored region only the RAM copy is changed and its block is marked
+ * as dirty (if the value is different). Other addresses are written directly.
+ *
+ * @param address: EEPROM address (0-1023).
+ * @param data:    The byte to be written.
+ */
+void EEPROM_MIRROR_WriteByte( uint16 address , uint8 data )
+{
+
+	/* Write other addresses to the EEPROM */
+	if ( ( address < EEPROM_MIRROR_START ) || ( address >= EEPROM_MIRROR_END ) )
+	{
+		EEPROM_WriteByte( address , data );
+		return;
+	}
+
+	uint16 index = address - EEPROM_MIRROR_START;
+
+	/* Nothing to do if the value is not changed */
+	if ( g_EEPROM_MIRROR_Data[ index ] != data )
+	{
+		/* Keep the checksum of the RAM copy up to date */
+		g_EEPROM_MIRROR_Sum += data - g_EEPROM_MIRROR_Data[ index ];
+
+		g_EEPROM_MIRROR_Data[ index ] = data;
+
+		/* Mark the block of the byte as dirty */
+		uint8 block = index / EEPROM_MIRROR_BLOCK_SIZE;
+		SET_BIT( g_EEPROM_MIRROR_Dirty[ block / 8 ] , block % 8 );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Reads an array of bytes.
+ *
+ * @param address:    Start EEPROM address to read from.
+ * @param data_array: Pointer to the array to store read data.
+ * @param array_size: Number of bytes to read (up to EEPROM_SIZE).
+ */
+void EEPROM_MIRROR_ReadArray( uint16 address , uint8 * data_array , uint16 array_size )
+{
+	/* Check that the address of the array and the EEPROM address valid */
+	if ( ( data_array == NULL ) || ( address > EEPROM_SIZE ) || ( array_size > EEPROM_SIZE - address ) )
+	{
+		/* Stop if not valid */
+		return;
+	}
+
+	/* Loops through each byte in the data array and read it */
+	for ( uint16 byte = 0 ; byte < array_size ; byte++ )
+	{
+		data_array[ byte ] = EEPROM_MIRROR_ReadByte( address + byte );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Writes an array of bytes.
+ *
+ * @param address:    Start EEPROM address to write to.
+ * @param data_array: Pointer to the array of bytes to write.
+ * @param array_size: Number of bytes to write (up to EEPROM_SIZE).
+ */
+void EEPROM_MIRROR_WriteArray( uint16 address , const uint8 * data_array , uint16 array_size )
+{
+	/* Check that the address of the array and the EEPROM address valid */
+	if ( ( data_array == NULL ) || ( address > EEPROM_SIZE ) || ( array_size > EEPROM_SIZE - address ) )
+	{
+		/* Stop if not valid */
+		return;
+	}
+
+	/* Loops through each byte in the data array and write it */
+	for ( uint16 byte = 0 ; byte < array_size ; byte++ )
+	{
+		EEPROM_MIRROR_WriteByte( address + byte , data_array[ byte ] );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Writes back the dirty blocks in the background.
+ *
+ * Call it from the main loop. If the EEPROM is busy it returns at once,
+ * otherwise it writes at most one changed byte of the dirty blocks,
+ * so it never waits for an EEPROM write.
+ */
+void EEPROM_MIRROR_Task( void )
+{
+
+	/* Wait for the previous write in the next call */
+	if ( EEPROM_IsReady() )
+	{
+		EEPROM_MIRROR_WriteBackStep();
+	}
+}
+
+
+
+
+
+/*
+ * @brief Writes all the dirty blocks to the EEPROM now.
+ *
+ * Used for the values that must be saved before continuing (blocks for about
+ * 8.5ms per changed byte).
+ */
+void EEPROM_MIRROR_Commit( void )
+{
+
+	/* Write back until no block is dirty (EEPROM_WriteByte waits for the previous write) */
+	while ( EEPROM_MIRROR_IsDirty() )
+	{
+		EEPROM_MIRROR_WriteBackStep();
+	}
+}
+
+
+
+
+
+/*
+ * @brief Checks if the mirror has changes that are not written to the EEPROM yet.
+ *
+ * @return (bool) true if there are dirty blocks, false otherwise.
+ */
+bool EEPROM_MIRROR_IsDirty( void )
+{
+
+	/* A block is being written back */
+	if ( g_EEPROM_MIRROR_Block != EEPROM_MIRROR_NO_BLOCK )
+	{
+		return true;
+	}
+
+	for ( uint8 byte = 0 ; byte < EEPROM_MIRROR_DIRTY_BYTES ; byte++ )
+	{
+		if ( g_EEPROM_MIRROR_Dirty[ byte ] != 0 )
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+
+
+
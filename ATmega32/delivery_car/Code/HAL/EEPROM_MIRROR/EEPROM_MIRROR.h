@@ -0,0 +1,130 @@
+/****************************************************************************
+ * @file    EEPROM_MIRROR.h
+ * @author  Boles Medhat
+ * @brief   EEPROM RAM Mirror Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file provides a RAM copy (mirror) of a region of the EEPROM.
+ * The region is loaded once by EEPROM_MIRROR_Init(), then every read of it
+ * is a RAM read (no EEWE polling and no EEPROM read cycle).
+ * Writes change the RAM copy and mark their block as dirty, the dirty blocks
+ * are written back one byte at a time by EEPROM_MIRROR_Task() when the EEPROM
+ * is idle, or all at once by EEPROM_MIRROR_Commit().
+ * Addresses outside the mirrored region are passed to the EEPROM driver.
+ *
+ * In EEPROM_MIRROR_BROWNOUT_FLUSH_ENABLE mode the mirror is kept in the
+ * .noinit section with a guard word and a checksum. After a brown-out reset
+ * the RAM still holds the unsaved changes, so EEPROM_MIRROR_Init() writes
+ * them to the EEPROM instead of loading the old values.
+ *
+ * @note
+ * - Do not call the functions of this driver from an ISR.
+ * - Clear the reset flags (WDT_ClearResetFlags) after EEPROM_MIRROR_Init(),
+ *   so an old brown-out flag is not used again after the next reset.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef EEPROM_MIRROR_H_
+#define EEPROM_MIRROR_H_
+
+#include "../../MCAL/EEPROM/EEPROM.h"
+#include "../../MCAL/WDT/WDT.h"
+#include "EEPROM_MIRROR_config.h"
+
+
+/*
+ * @brief Initializes the mirror.
+ *
+ * Loads the mirrored region from the EEPROM. In brown-out flush mode, after a
+ * brown-out reset with a valid mirror in RAM, the whole region is compared
+ * with the EEPROM and the unsaved changes are written instead (this blocks
+ * for about 8.5ms per changed byte).
+ */
+void EEPROM_MIRROR_Init( void );
+
+
+
+/*
+ * @brief Reads a byte.
+ *
+ * @param address: EEPROM address (0-1023), read from RAM if it is in the mirrored region.
+ *
+ * @return (uint8) The byte at the address.
+ */
+uint8 EEPROM_MIRROR_ReadByte( uint16 address );
+
+
+
+/*
+ * @brief Writes a byte.
+ *
+ * In the mirrored region only the RAM copy is changed and its block is marked
+ * as dirty (if the value is different). Other addresses are written directly.
+ *
+ * @param address: EEPROM address (0-1023).
+ * @param data:    The byte to be written.
+ */
+void EEPROM_MIRROR_WriteByte( uint16 address , uint8 data );
+
+
+
+/*
+ * @brief Reads an array of bytes.
+ *
+ * @param address:    Start EEPROM address to read from.
+ * @param data_array: Pointer to the array to store read data.
+ * @param array_size: Number of bytes to read (up to EEPROM_SIZE).
+ */
+void EEPROM_MIRROR_ReadArray( uint16 address , uint8 * data_array , uint16 array_size );
+
+
+
+/*
+ * @brief Writes an array of bytes.
+ *
+ * @param address:    Start EEPROM address to write to.
+ * @param data_array: Pointer to the array of bytes to write.
+ * @param array_size: Number of bytes to write (up to EEPROM_SIZE).
+ */
+void EEPROM_MIRROR_WriteArray( uint16 address , const uint8 * data_array , uint16 array_size );
+
+
+
+/*
+ * @brief Writes back the dirty blocks in the background.
+ *
+ * Call it from the main loop. If the EEPROM is busy it returns at once,
+ * otherwise it writes at most one changed byte of the dirty blocks,
+ * so it never waits for an EEPROM write.
+ */
+void EEPROM_MIRROR_Task( void );
+
+
+
+/*
+ * @brief Writes all the dirty blocks to the EEPROM now.
+ *
+ * Used for the values that must be saved before continuing (blocks for about
+ * 8.5ms per changed byte).
+ */
+void EEPROM_MIRROR_Commit( void );
+
+
+
+/*
+ * @brief Checks if the mirror has changes that are not written to the EEPROM yet.
+ *
+ * @return (bool) true if there are dirty blocks, false otherwise.
+ */
+bool EEPROM_MIRROR_IsDirty( void );
+
+
+#endif /* EEPROM_MIRROR_H_ */
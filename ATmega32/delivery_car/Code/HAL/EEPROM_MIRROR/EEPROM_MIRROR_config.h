@@ -0,0 +1,66 @@
+/****************************************************************************
+ * @file    EEPROM_MIRROR_config.h
+ * @author  Boles Medhat
+ * @brief   EEPROM RAM Mirror Configuration Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @note
+ * - The mirror uses EEPROM_MIRROR_SIZE bytes of RAM.
+ * - The brown-out flush needs the brown-out detector enabled by the BODEN fuse.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef EEPROM_MIRROR_CONFIG_H_
+#define EEPROM_MIRROR_CONFIG_H_
+
+#include "EEPROM_MIRROR_def.h"
+#include "../../MCAL/EEPROM/EEPROM.h"
+
+
+/*Set the first EEPROM address and the size (in bytes) of the mirrored region*/
+#define EEPROM_MIRROR_START					0x20
+#define EEPROM_MIRROR_SIZE					32
+
+
+/*Set the size of a dirty block (in bytes)
+ * a write to the mirror marks its block as dirty, only the dirty blocks are
+ * compared with the EEPROM on write-back, and only the changed bytes are written
+ */
+#define EEPROM_MIRROR_BLOCK_SIZE			8
+
+
+/*Set the brown-out flush
+ * choose between:
+ * 1. EEPROM_MIRROR_BROWNOUT_FLUSH_DISABLE
+ * 2. EEPROM_MIRROR_BROWNOUT_FLUSH_ENABLE	: the RAM usually keeps its data during a brown-out reset,
+ * 											  so the unsaved changes are written by EEPROM_MIRROR_Init()
+ */
+#define EEPROM_MIRROR_BROWNOUT_FLUSH		EEPROM_MIRROR_BROWNOUT_FLUSH_ENABLE
+
+
+
+#if ( EEPROM_MIRROR_SIZE == 0 ) || ( EEPROM_MIRROR_END > EEPROM_SIZE )
+	#error "The mirrored region must be inside the EEPROM"
+#endif
+
+#if ( EEPROM_MIRROR_BLOCK_SIZE == 0 ) || ( EEPROM_MIRROR_SIZE % EEPROM_MIRROR_BLOCK_SIZE ) != 0 || ( EEPROM_MIRROR_BLOCK_SIZE > 255 )
+	#error "EEPROM_MIRROR_SIZE must be a multiple of EEPROM_MIRROR_BLOCK_SIZE (from 1 to 255)"
+#endif
+
+#if EEPROM_MIRROR_BLOCKS >= EEPROM_MIRROR_NO_BLOCK
+	#error "EEPROM_MIRROR_BLOCKS must be less than 255, use bigger blocks"
+#endif
+
+#if ( EEPROM_MIRROR_BROWNOUT_FLUSH != EEPROM_MIRROR_BROWNOUT_FLUSH_DISABLE ) && ( EEPROM_MIRROR_BROWNOUT_FLUSH != EEPROM_MIRROR_BROWNOUT_FLUSH_ENABLE )
+	#error "Wrong \"EEPROM_MIRROR_BROWNOUT_FLUSH\" configuration option"
+#endif
+
+
+#endif /* EEPROM_MIRROR_CONFIG_H_ */
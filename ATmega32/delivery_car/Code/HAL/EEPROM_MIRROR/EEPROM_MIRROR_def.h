@@ -0,0 +1,50 @@
+/****************************************************************************
+ * @file    EEPROM_MIRROR_def.h
+ * @author  Boles Medhat
+ * @brief   EEPROM RAM Mirror Definitions Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the macro definitions and constants used by the EEPROM
+ * RAM Mirror (a region of the EEPROM kept in RAM with dirty block write-back).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef EEPROM_MIRROR_DEF_H_
+#define EEPROM_MIRROR_DEF_H_
+
+#include "../../LIB/STD_TYPES.h"
+
+
+/*------------------------------------------   modes    -----------------------------------------*/
+
+/*Brown-out flush*/
+#define EEPROM_MIRROR_BROWNOUT_FLUSH_DISABLE	0	/*The mirror is loaded from the EEPROM after every reset (unsaved changes are lost)*/
+#define EEPROM_MIRROR_BROWNOUT_FLUSH_ENABLE		1	/*The mirror is kept in .noinit RAM and its unsaved changes are written after a brown-out reset*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Mirror size*/
+#define EEPROM_MIRROR_END					( EEPROM_MIRROR_START + EEPROM_MIRROR_SIZE )				/*First EEPROM address after the mirrored region*/
+#define EEPROM_MIRROR_BLOCKS				( EEPROM_MIRROR_SIZE / EEPROM_MIRROR_BLOCK_SIZE )		/*Number of blocks of the mirror*/
+#define EEPROM_MIRROR_DIRTY_BYTES			( ( EEPROM_MIRROR_BLOCKS + 7 ) / 8 )					/*Number of bytes of the dirty blocks bitmap*/
+
+/*Write-back cursor*/
+#define EEPROM_MIRROR_NO_BLOCK				0xFF		/*No block is being written back*/
+
+/*Value of the guard word when the .noinit mirror is valid*/
+#define EEPROM_MIRROR_GUARD					0xA55A
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* EEPROM_MIRROR_DEF_H_ */
@@ -0,0 +1,310 @@
+/****************************************************************************
+ * @file    RESET_LOG.c
+ * @author  Boles Medhat
+ * @brief   Reset Log Source File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file implements the reset log.
+ * The breadcrumb area is in the .noinit section, so the startup code does not
+ * clear it and after a watchdog, brown-out or external reset it still holds
+ * the last task, interrupt and tick of the run before the reset. A guard word
+ * tells if the area is valid (it is random after a power-on reset).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include "RESET_LOG.h"
+#include "../../LIB/DataConvert/DataConvert.h"
+#include <avr/pgmspace.h>
+
+
+/* Breadcrumb area of this run (not cleared by the startup code) */
+volatile ResetCrumb g_RESET_LOG_Crumb __attribute__((section(".noinit")));
+
+/* Breadcrumbs of the run before the reset */
+static ResetCrumb g_RESET_LOG_Last;
+
+/* True when g_RESET_LOG_Last holds valid breadcrumbs */
+static bool g_RESET_LOG_LastValid = false;
+
+/* Cause of the last reset */
+static uint8 g_RESET_LOG_Cause = RESET_LOG_UNKNOWN;
+
+/* Names of the reset causes (in the flash) */
+static const char g_RESET_LOG_Names[ RESET_LOG_CAUSES ][ RESET_LOG_NAME_SIZE ] PROGMEM = RESET_LOG_NAMES;
+
+
+
+
+
+/*
+ * @brief Sends a string from the flash.
+ *
+ * @param write_byte: Function that sends one byte.
+ * @param string:     String to send (in the flash).
+ */
+static void RESET_LOG_WriteString( void (*write_byte)(uint8) , const char * string )
+{
+	char character;
+
+	while ( ( character = pgm_read_byte( string++ ) ) != '\0' )
+	{
+		write_byte( character );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Sends a number as decimal text.
+ *
+ * @param write_byte: Function that sends one byte.
+ * @param number:     Number to send.
+ */
+static void RESET_LOG_WriteNumber( void (*write_byte)(uint8) , uint16 number )
+{
+	char string[6];
+
+	DC_itoa( number , string , 10 );
+
+	for ( uint8 index = 0 ; string[ index ] != '\0' ; index++ )
+	{
+		write_byte( string[ index ] );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Writes the EEPROM counter of a cause.
+ *
+ * @param cause: The reset cause.
+ * @param count: Number of resets of the cause.
+ */
+static void RESET_LOG_WriteCount( uint8 cause , uint16 count )
+{
+	uint16 address = RESET_LOG_EEPROM_ADDRESS + ( cause * 2 );
+
+	EEPROM_MIRROR_WriteByte( address     , (uint8)count );
+	EEPROM_MIRROR_WriteByte( address + 1 , (uint8)( count >> 8 ) );
+}
+
+
+
+
+
+/*
+ * @brief Finds the reset cause and keeps the breadcrumbs of the last run.
+ *
+ * The cause is read from the reset flags (power-on, then brown-out, then
+ * external, then watchdog), a watchdog reset asked by RESET_LOG_Restart() is
+ * a software reset. The breadcrumbs are kept only if the .noinit area
+ * survived the reset, then the area is cleared for this run.
+ */
+void RESET_LOG_Init( void )
+{
+	uint8 flags = WDT_GetResetFlags();
+	bool valid  = ( g_RESET_LOG_Crumb.guard == RESET_LOG_GUARD );
+
+	/* Find the cause (a power-on reset can also set the other flags) */
+	if ( GET_BIT( flags , PORF ) )
+	{
+		g_RESET_LOG_Cause = RESET_LOG_POWER_ON;
+		valid = false;
+	}
+	else if ( GET_BIT( flags , BORF ) )
+	{
+		g_RESET_LOG_Cause = RESET_LOG_BROWN_OUT;
+	}
+	else if ( GET_BIT( flags , EXTRF ) )
+	{
+		g_RESET_LOG_Cause = RESET_LOG_EXTERNAL;
+	}
+	else if ( GET_BIT( flags , WDRF ) )
+	{
+		if ( valid && ( g_RESET_LOG_Crumb.restart == RESET_LOG_RESTART_MAGIC ) )
+		{
+			g_RESET_LOG_Cause = RESET_LOG_SOFTWARE;
+		}
+		else
+		{
+			g_RESET_LOG_Cause = RESET_LOG_WATCHDOG;
+		}
+	}
+	else
+	{
+		g_RESET_LOG_Cause = RESET_LOG_UNKNOWN;
+	}
+
+	/* Keep the breadcrumbs of the last run */
+	if ( valid )
+	{
+		g_RESET_LOG_Last.task = g_RESET_LOG_Crumb.task;
+		g_RESET_LOG_Last.isr  = g_RESET_LOG_Crumb.isr;
+		g_RESET_LOG_Last.tick = g_RESET_LOG_Crumb.tick;
+	}
+	g_RESET_LOG_LastValid = valid;
+
+	/* Clear the area for this run */
+	g_RESET_LOG_Crumb.task    = RESET_LOG_NO_TASK;
+	g_RESET_LOG_Crumb.isr     = RESET_LOG_NO_ISR;
+	g_RESET_LOG_Crumb.tick    = 0;
+	g_RESET_LOG_Crumb.restart = 0;
+	g_RESET_LOG_Crumb.guard   = RESET_LOG_GUARD;
+}
+
+
+
+
+
+/*
+ * @brief Adds the reset to the EEPROM counter of its cause.
+ *
+ * The counter is written through the EEPROM mirror and committed, a full
+ * counter stops at RESET_LOG_COUNT_MAX.
+ */
+void RESET_LOG_Count( void )
+{
+	uint16 count = RESET_LOG_GetCount( g_RESET_LOG_Cause );
+
+	if ( count < RESET_LOG_COUNT_MAX )
+	{
+		RESET_LOG_WriteCount( g_RESET_LOG_Cause , count + 1 );
+		EEPROM_MIRROR_Commit();
+	}
+}
+
+
+
+
+
+/*
+ * @brief Resets the MCU on purpose.
+ *
+ * Marks the reset as a software reset, then resets the MCU by the watchdog
+ * (WDT_RESET_MCU), so this function does not return.
+ */
+void RESET_LOG_Restart( void )
+{
+	g_RESET_LOG_Crumb.restart = RESET_LOG_RESTART_MAGIC;
+
+	WDT_RESET_MCU();
+}
+
+
+
+
+
+/*
+ * @brief Gets the cause of the last reset.
+ *
+ * @return (uint8) The reset cause (RESET_LOG_POWER_ON ... RESET_LOG_UNKNOWN).
+ */
+uint8 RESET_LOG_GetCause( void )
+{
+	return g_RESET_LOG_Cause;
+}
+
+
+
+
+
+/*
+ * @brief Gets the number of resets of a cause.
+ *
+ * @param cause: The reset cause (RESET_LOG_POWER_ON ... RESET_LOG_UNKNOWN).
+ *
+ * @return (uint16) Number of resets of the cause (0 for a wrong cause).
+ */
+uint16 RESET_LOG_GetCount( uint8 cause )
+{
+	if ( cause >= RESET_LOG_CAUSES )
+	{
+		return 0;
+	}
+
+	uint16 address = RESET_LOG_EEPROM_ADDRESS + ( cause * 2 );
+	uint16 count   = EEPROM_MIRROR_ReadByte( address ) | ( (uint16)EEPROM_MIRROR_ReadByte( address + 1 ) << 8 );
+
+	/* A counter that was never written reads as 0 */
+	if ( count == RESET_LOG_COUNT_ERASED )
+	{
+		count = 0;
+	}
+
+	return count;
+}
+
+
+
+
+
+/*
+ * @brief Sets all the reset counters to 0 (and commits them to the EEPROM).
+ */
+void RESET_LOG_ClearCounts( void )
+{
+	for ( uint8 cause = 0 ; cause < RESET_LOG_CAUSES ; cause++ )
+	{
+		RESET_LOG_WriteCount( cause , 0 );
+	}
+
+	EEPROM_MIRROR_Commit();
+}
+
+
+
+
+
+/*
+ * @brief Sends the reset cause, the breadcrumbs and the counters as text.
+ *
+ * Sends two lines:
+ * "reset <cause> task <id> isr <id> tick <tick>\r\n" (task, isr and tick are
+ * "-" when the breadcrumbs did not survive the reset), then
+ * "resets <cause> <count> <cause> <count> ...\r\n".
+ *
+ * @param write_byte: Function that sends one byte (for example UART_WriteByte).
+ */
+void RESET_LOG_Report( void (*write_byte)(uint8) )
+{
+	RESET_LOG_WriteString( write_byte , PSTR( "reset " ) );
+	RESET_LOG_WriteString( write_byte , g_RESET_LOG_Names[ g_RESET_LOG_Cause ] );
+
+	if ( g_RESET_LOG_LastValid )
+	{
+		RESET_LOG_WriteString( write_byte , PSTR( " task " ) );
+		RESET_LOG_WriteNumber( write_byte , g_RESET_LOG_Last.task );
+		RESET_LOG_WriteString( write_byte , PSTR( " isr " ) );
+		RESET_LOG_WriteNumber( write_byte , g_RESET_LOG_Last.isr );
+		RESET_LOG_WriteString( write_byte , PSTR( " tick " ) );
+		RESET_LOG_WriteNumber( write_byte , g_RESET_LOG_Last.tick );
+	}
+	else
+	{
+		RESET_LOG_WriteString( write_byte , PSTR( " task - isr - tick -" ) );
+	}
+
+	RESET_LOG_WriteString( write_byte , PSTR( "\r\nresets" ) );
+
+	for ( uint8 cause = 0 ; cause < RESET_LOG_CAUSES ; cause++ )
+	{
+		write_byte( ' ' );
+		RESET_LOG_WriteString( write_byte , g_RESET_LOG_Names[ cause ] );
+		write_byte( ' ' );
+		RESET_LOG_WriteNumber( write_byte , RESET_LOG_GetCount( cause ) );
+	}
+
+	RESET_LOG_WriteString( write_byte , PSTR( "\r\n" ) );
+}
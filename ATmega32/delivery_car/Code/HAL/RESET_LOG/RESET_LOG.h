@@ -0,0 +1,134 @@
+/****************************************************************************
+ * @file    RESET_LOG.h
+ * @author  Boles Medhat
+ * @brief   Reset Log Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file provides the reset cause and the breadcrumbs of the last run,
+ * so a field stall (brown-out or watchdog hang) can be told apart from an
+ * intended restart:
+ * - RESET_LOG_Init() reads the reset flags of MCUCSR at boot and keeps the
+ *   breadcrumbs of the run before the reset.
+ * - RESET_LOG_TASK / RESET_LOG_ISR / RESET_LOG_ISR_END record the last main
+ *   loop task and the interrupt being executed in a .noinit RAM area, and
+ *   RESET_LOG_TICK counts the timestamp, all in one or two RAM writes.
+ * - RESET_LOG_Restart() marks the reset as intended before WDT_RESET_MCU(),
+ *   so it is counted as software and not as a watchdog hang.
+ * - RESET_LOG_Count() adds the reset to a counter per cause in the EEPROM.
+ * - RESET_LOG_Report() sends the cause, the breadcrumbs and the counters as
+ *   text, the output function is a parameter (for example UART_WriteByte).
+ *
+ * @note
+ * - Call RESET_LOG_Init() first in the initialization (before any crumb),
+ *   and RESET_LOG_Count() after EEPROM_MIRROR_Init() and before
+ *   WDT_ClearResetFlags().
+ * - Every task or interrupt id must be used by one context only.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef RESET_LOG_H_
+#define RESET_LOG_H_
+
+#include "../../MCAL/WDT/WDT.h"
+#include "../EEPROM_MIRROR/EEPROM_MIRROR.h"
+#include "RESET_LOG_config.h"
+
+
+/* Breadcrumb area (used by the macros) */
+extern volatile ResetCrumb g_RESET_LOG_Crumb;
+
+/* Records the main loop task that starts */
+#define RESET_LOG_TASK( id )				( g_RESET_LOG_Crumb.task = (id) )
+
+/* Records the interrupt that starts (call RESET_LOG_ISR_END before every return of the interrupt) */
+#define RESET_LOG_ISR( id )					( g_RESET_LOG_Crumb.isr = (id) )
+
+/* Records the end of the interrupt */
+#define RESET_LOG_ISR_END()					( g_RESET_LOG_Crumb.isr = RESET_LOG_NO_ISR )
+
+/* Counts the timestamp (call it from one periodic interrupt) */
+#define RESET_LOG_TICK()					( g_RESET_LOG_Crumb.tick++ )
+
+
+
+/*
+ * @brief Finds the reset cause and keeps the breadcrumbs of the last run.
+ *
+ * The cause is read from the reset flags (power-on, then brown-out, then
+ * external, then watchdog), a watchdog reset asked by RESET_LOG_Restart() is
+ * a software reset. The breadcrumbs are kept only if the .noinit area
+ * survived the reset, then the area is cleared for this run.
+ */
+void RESET_LOG_Init( void );
+
+
+
+/*
+ * @brief Adds the reset to the EEPROM counter of its cause.
+ *
+ * The counter is written through the EEPROM mirror and committed, a full
+ * counter stops at RESET_LOG_COUNT_MAX.
+ */
+void RESET_LOG_Count( void );
+
+
+
+/*
+ * @brief Resets the MCU on purpose.
+ *
+ * Marks the reset as a software reset, then resets the MCU by the watchdog
+ * (WDT_RESET_MCU), so this function does not return.
+ */
+void RESET_LOG_Restart( void );
+
+
+
+/*
+ * @brief Gets the cause of the last reset.
+ *
+ * @return (uint8) The reset cause (RESET_LOG_POWER_ON ... RESET_LOG_UNKNOWN).
+ */
+uint8 RESET_LOG_GetCause( void );
+
+
+
+/*
+ * @brief Gets the number of resets of a cause.
+ *
+ * @param cause: The reset cause (RESET_LOG_POWER_ON ... RESET_LOG_UNKNOWN).
+ *
+ * @return (uint16) Number of resets of the cause (0 for a wrong cause).
+ */
+uint16 RESET_LOG_GetCount( uint8 cause );
+
+
+
+/*
+ * @brief Sets all the reset counters to 0 (and commits them to the EEPROM).
+ */
+void RESET_LOG_ClearCounts( void );
+
+
+
+/*
+ * @brief Sends the reset cause, the breadcrumbs and the counters as text.
+ *
+ * Sends two lines:
+ * "reset <cause> task <id> isr <id> tick <tick>\r\n" (task, isr and tick are
+ * "-" when the breadcrumbs did not survive the reset), then
+ * "resets <cause> <count> <cause> <count> ...\r\n".
+ *
+ * @param write_byte: Function that sends one byte (for example UART_WriteByte).
+ */
+void RESET_LOG_Report( void (*write_byte)(uint8) );
+
+
+#endif /* RESET_LOG_H_ */
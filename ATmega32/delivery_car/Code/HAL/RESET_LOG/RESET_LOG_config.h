@@ -0,0 +1,39 @@
+/****************************************************************************
+ * @file    RESET_LOG_config.h
+ * @author  Boles Medhat
+ * @brief   Reset Log Configuration Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @note
+ * - The counters are written through the EEPROM mirror, so keep them inside
+ *   the mirrored region (see EEPROM_MIRROR_config.h) and away from the other
+ *   data of the application.
+ * - The brown-out cause needs the brown-out detector enabled by the BODEN fuse.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef RESET_LOG_CONFIG_H_
+#define RESET_LOG_CONFIG_H_
+
+#include "RESET_LOG_def.h"
+#include "../EEPROM_MIRROR/EEPROM_MIRROR_config.h"
+
+
+/*Set the first EEPROM address of the reset counters (RESET_LOG_EEPROM_SIZE bytes)*/
+#define RESET_LOG_EEPROM_ADDRESS			0x28
+
+
+
+#if ( RESET_LOG_EEPROM_ADDRESS < EEPROM_MIRROR_START ) || ( ( RESET_LOG_EEPROM_ADDRESS + RESET_LOG_EEPROM_SIZE ) > EEPROM_MIRROR_END )
+	#error "The reset counters must be inside the mirrored EEPROM region"
+#endif
+
+
+#endif /* RESET_LOG_CONFIG_H_ */
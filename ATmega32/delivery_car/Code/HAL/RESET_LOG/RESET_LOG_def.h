@@ -0,0 +1,80 @@
+/****************************************************************************
+ * @file    RESET_LOG_def.h
+ * @author  Boles Medhat
+ * @brief   Reset Log Definitions Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the macro definitions, constants and types used by the
+ * reset log (reset causes, breadcrumb area and EEPROM counters).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef RESET_LOG_DEF_H_
+#define RESET_LOG_DEF_H_
+
+#include "../../LIB/STD_TYPES.h"
+
+
+/*------------------------------------------   types    -----------------------------------------*/
+
+/*Breadcrumb area (kept in .noinit RAM through a reset)*/
+typedef struct
+{
+	uint16 guard;		/*Equals RESET_LOG_GUARD when the area is valid*/
+	uint8  task;		/*Id of the last main loop task that started*/
+	uint8  isr;			/*Id of the interrupt being executed (RESET_LOG_NO_ISR out of the interrupts)*/
+	uint16 tick;		/*Timestamp of the last crumb (ticks since the reset, wraps around)*/
+	uint8  restart;		/*Equals RESET_LOG_RESTART_MAGIC when the software asked for the reset*/
+}ResetCrumb;
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   modes    -----------------------------------------*/
+
+/*Reset causes (also the index of the EEPROM counter of the cause)*/
+#define RESET_LOG_POWER_ON				0	/*Power-on reset*/
+#define RESET_LOG_EXTERNAL				1	/*Reset pin*/
+#define RESET_LOG_BROWN_OUT				2	/*Brown-out detector*/
+#define RESET_LOG_WATCHDOG				3	/*Watchdog timeout that the software did not ask for (hang)*/
+#define RESET_LOG_SOFTWARE				4	/*Watchdog reset asked by RESET_LOG_Restart()*/
+#define RESET_LOG_UNKNOWN				5	/*No reset flag (jump to address 0 or an interrupt without a handler)*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Number of reset causes*/
+#define RESET_LOG_CAUSES				6
+
+/*Names of the reset causes (in the order of the causes) and the size of the longest one with its '\0'*/
+#define RESET_LOG_NAME_SIZE				10
+#define RESET_LOG_NAMES					{ "power_on" , "external" , "brown_out" , "watchdog" , "software" , "unknown" }
+
+/*Crumb ids*/
+#define RESET_LOG_NO_TASK				0		/*No main loop task started yet (initialization)*/
+#define RESET_LOG_NO_ISR				0		/*No interrupt is being executed*/
+
+/*Value of the guard word when the .noinit breadcrumb area is valid*/
+#define RESET_LOG_GUARD					0x5AA5
+
+/*Value of the restart byte when the software asked for the reset*/
+#define RESET_LOG_RESTART_MAGIC			0xC3
+
+/*EEPROM counters (16-bit little endian, an erased counter 0xFFFF reads as 0)*/
+#define RESET_LOG_COUNT_ERASED			0xFFFF		/*Value of a counter that was never written*/
+#define RESET_LOG_COUNT_MAX				0xFFFE		/*A full counter stops counting (it does not wrap)*/
+#define RESET_LOG_EEPROM_SIZE			( RESET_LOG_CAUSES * 2 )	/*Number of EEPROM bytes of the counters*/
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* RESET_LOG_DEF_H_ */
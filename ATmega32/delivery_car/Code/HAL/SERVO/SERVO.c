@@ -2,17 +2,21 @@
  * @file    SERVO.c
  * @author  Boles Medhat
  * @brief   Servo Motor Driver Source File
- * @version 1.0
+ * @version 2.0
  * @date    [2024-07-05]
  * @license MIT License Copyright (c) 2025 Boles Medhat
  *
  * @details
  * This file provides an abstraction for controlling servo motors.
+ * In SERVO_SW_MULTI_MODE the pulses of the servos are sent one after the other:
+ * the Compare Match B interrupt ends the pulse of the current servo, starts the
+ * pulse of the next one and moves OCR1B forward by its pulse width in ticks.
+ * After the last servo the remaining time of the frame is used to apply the new
+ * angles and step the motion profiles, then OCR1B waits for the next frame start.
  *
  * @note
- * - ⚠️ IMPORTANT: You must initialize the TIMER1 module in TIMER1_FAST_PWM_OCR1A_MODE mode
- * 				   **before** calling SERVO function. This driver does not initialize
- *	 	 	 	   TIMER1 module in TIMER1_FAST_PWM_OCR1A_MODE mode internally.
+ * - ⚠️ IMPORTANT: You must initialize the TIMER1 module **before** calling SERVO functions.
+ * 				   This driver does not initialize TIMER1 module internally.
  *
  *
  * @contact
@@ -24,26 +28,470 @@
 #include "SERVO.h"
 
 
+#if SERVO_MODE == SERVO_SW_MULTI_MODE
+
+/* Servo signal pins of the channels */
+static Servo g_SERVO_Pins[ SERVO_CHANNELS_NUM ];
+
+/* Bit mask of the attached channels */
+static volatile uint8 g_SERVO_Attached = 0;
+
+/* Pulse widths in ticks used by the ISR in the current frame */
+static volatile uint16 g_SERVO_Ticks[ SERVO_CHANNELS_NUM ];
+
+/* Pulse widths in ticks waiting to be applied at the next frame */
+static volatile uint16 g_SERVO_NextTicks[ SERVO_CHANNELS_NUM ];
+
+/* Batch lock depth (new values are not applied while it is not zero) */
+static volatile uint8 g_SERVO_BatchLock = 0;
+
+/* Flag set when g_SERVO_NextTicks has new values */
+static volatile uint8 g_SERVO_UpdatePending = 0;
+
+/* Channel that has its pulse running (SERVO_CHANNELS_NUM means frame gap) */
+static uint8 g_SERVO_Channel = SERVO_CHANNELS_NUM;
+
+/* Copy of OCR1B to avoid reading the 16-bit register in the ISR */
+static uint16 g_SERVO_CompareValue = 0;
+
+
+#if SERVO_PROFILE_STATUS == SERVO_PROFILE_ENABLE
+
+/* Target pulse widths of the motion profiles */
+static volatile uint16 g_SERVO_Target[ SERVO_CHANNELS_NUM ];
+
+/* Current velocity of the motion profiles in ticks per frame */
+static sint16 g_SERVO_Velocity[ SERVO_CHANNELS_NUM ];
+
+/* Maximum speed in ticks per frame (0 means no profile) */
+static volatile uint8 g_SERVO_MaxSpeed[ SERVO_CHANNELS_NUM ];
+
+/* Acceleration in ticks per frame per frame */
+static volatile uint8 g_SERVO_Accel[ SERVO_CHANNELS_NUM ];
+
+#endif
+
+
+static void SERVO_CompareHandler( void );
+
+#endif
+
+
+
+
+
+/*
+ * @brief Initializes the servo driver.
+ *
+ * In SERVO_SW_MULTI_MODE this function centers all channels and registers
+ * the Compare Match B callback that generates the servo pulses.
+ */
+void SERVO_Init( void )
+{
+#if SERVO_MODE == SERVO_SW_MULTI_MODE
+
+	/* Center all the Channels */
+	for ( uint8 i = 0 ; i < SERVO_CHANNELS_NUM ; i++ )
+	{
+		g_SERVO_Ticks[ i ]     = SERVO_CENTER_TICKS;
+		g_SERVO_NextTicks[ i ] = SERVO_CENTER_TICKS;
+
+	#if SERVO_PROFILE_STATUS == SERVO_PROFILE_ENABLE
+		g_SERVO_Target[ i ]   = SERVO_CENTER_TICKS;
+		g_SERVO_Velocity[ i ] = 0;
+		g_SERVO_MaxSpeed[ i ] = 0;
+		g_SERVO_Accel[ i ]    = 1;
+	#endif
+	}
+
+	/* Wait in the frame gap until the start of the next frame */
+	g_SERVO_Channel      = SERVO_CHANNELS_NUM;
+	g_SERVO_CompareValue = 0;
+	TIMER1_SetCompare_B_Value( 0 );
+
+	/* Register the Pulse Generator on Compare Match B Interrupt */
+	TIMER1_SetCallback( TIMER1_COMPB_ID , SERVO_CompareHandler );
+
+#endif
+}
+
+
+
+
+
+/*
+ * @brief Attaches a servo signal pin to a servo channel.
+ *
+ * This function sets the servo pin as output and enables its channel.
+ * In SERVO_HW_OC1B_MODE only servo_id 0 is valid and the pin must be OC1B.
+ *
+ * @param servo_id: The servo channel (from 0 to SERVO_CHANNELS_NUM - 1).
+ * @param servo:    The servo signal pin.
+ */
+void SERVO_Attach( uint8 servo_id , Servo servo )
+{
+#if SERVO_MODE == SERVO_HW_OC1B_MODE
+
+	/* Only one Servo on OC1B Pin */
+	if ( servo_id == 0 )
+	{
+		/* Set the Servo Pin as Output */
+		DIO_SetPinDirection( servo.port , servo.pin , OUTPUT );
+	}
+
+#elif SERVO_MODE == SERVO_SW_MULTI_MODE
+
+	/* Check that the Servo ID is Valid */
+	if ( servo_id < SERVO_CHANNELS_NUM )
+	{
+		/* Store the Servo Pin */
+		g_SERVO_Pins[ servo_id ] = servo;
+
+		/* Set the Servo Pin as Output and Low */
+		DIO_SetPinValue( servo.port , servo.pin , LOW );
+		DIO_SetPinDirection( servo.port , servo.pin , OUTPUT );
+
+		/* Enable the Channel (single byte write is atomic) */
+		SET_BIT( g_SERVO_Attached , servo_id );
+	}
+
+#endif
+}
+
+
+
+
+
 /*
  * @brief Sets the angle of a servo motor by its unique ID.
  *
  * This function sets the desired angle of the servo.
  * The angle must be within the valid range of -90 to 90 degrees.
+ * In SERVO_SW_MULTI_MODE the new value is applied at the start of the next frame,
+ * or moved to with the motion profile if it is set for this servo.
  *
+ * @param servo_id: The servo channel.
  * @param angle:    The desired angle for the servo (in degrees).
  */
-void SERVO_SetAngle( sint8 angle )
+void SERVO_SetAngle( uint8 servo_id , sint8 angle )
+{
+
+	/* Check if the Angle is within the Valid Range */
+	if ( ( angle < SERVO_MIN_ANGLE ) || ( angle > SERVO_MAX_ANGLE ) )
+	{
+		return;
+	}
+
+#if SERVO_MODE == SERVO_HW_OC1B_MODE
+
+	/* Check that the Servo ID is Valid */
+	if ( servo_id == 0 )
+	{
+		/* Convert the angle to Timer Ticks ( -90 -> 1000 US  , 90 -> 2000 US ) and Store it */
+		TIMER1_SetCompare_B_Value( SERVO_ANGLE_TO_TICKS( angle ) );
+	}
+
+#elif SERVO_MODE == SERVO_SW_MULTI_MODE
+
+	/* Check that the Servo ID is Valid */
+	if ( servo_id < SERVO_CHANNELS_NUM )
+	{
+		/* Lock the ISR from applying a half written value */
+		g_SERVO_BatchLock++;
+
+		/* Convert the angle to Timer Ticks ( -90 -> 1000 US  , 90 -> 2000 US ) and Store it */
+		g_SERVO_NextTicks[ servo_id ] = SERVO_ANGLE_TO_TICKS( angle );
+
+		/* Mark the new value to be applied */
+		g_SERVO_UpdatePending = 1;
+
+		/* Release the Lock */
+		g_SERVO_BatchLock--;
+	}
+
+#endif
+}
+
+
+
+#if SERVO_MODE == SERVO_SW_MULTI_MODE
+
+
+/*
+ * @brief Starts a batch update of servo angles.
+ *
+ * All the SERVO_SetAngle calls between SERVO_BatchBegin and SERVO_BatchCommit
+ * are applied together at the start of the same frame.
+ */
+void SERVO_BatchBegin( void )
+{
+	/* Lock the ISR from applying the new values */
+	g_SERVO_BatchLock++;
+}
+
+
+
+
+
+/*
+ * @brief Ends a batch update of servo angles.
+ *
+ * This function releases the new angles to be applied at the start of the next frame.
+ */
+void SERVO_BatchCommit( void )
+{
+	/* Release the Lock */
+	if ( g_SERVO_BatchLock > 0 )
+	{
+		g_SERVO_BatchLock--;
+	}
+}
+
+
+
+#if SERVO_PROFILE_STATUS == SERVO_PROFILE_ENABLE
+
+
+/*
+ * @brief Sets the trapezoidal motion profile of a servo.
+ *
+ * The servo accelerates to max_speed, cruises, then decelerates to stop at the
+ * target angle. The profile is stepped once per frame in the background.
+ *
+ * @param servo_id:     The servo channel.
+ * @param max_speed:    Maximum speed in Timer1 ticks per frame (0 disables the profile).
+ * @param acceleration: Acceleration in Timer1 ticks per frame per frame (minimum 1).
+ */
+void SERVO_SetProfile( uint8 servo_id , uint8 max_speed , uint8 acceleration )
+{
+
+	/* Check that the Servo ID is Valid */
+	if ( servo_id < SERVO_CHANNELS_NUM )
+	{
+		/* Lock the ISR while the profile is changed */
+		g_SERVO_BatchLock++;
+
+		/* Store the Profile */
+		g_SERVO_MaxSpeed[ servo_id ] = max_speed;
+		g_SERVO_Accel[ servo_id ]    = ( acceleration == 0 ) ? 1 : acceleration;
+
+		/* Release the Lock */
+		g_SERVO_BatchLock--;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Checks if a servo is still moving to its target angle.
+ *
+ * @param servo_id: The servo channel.
+ *
+ * @return (bool) true if the servo has not reached its target, false otherwise.
+ */
+bool SERVO_IsMoving( uint8 servo_id )
 {
+	bool moving = false;
 
-	/* Check if the Angle is within the Valid Range and the Servo ID is Valid */
-	if ( ( angle >= SERVO_MIN_ANGLE ) && ( angle <= SERVO_MAX_ANGLE ) )
+	/* Check that the Servo ID is Valid */
+	if ( servo_id < SERVO_CHANNELS_NUM )
 	{
-		/* Convert the angle to microseconds ( -90 -> 1000 US  , 90 -> 2000 US ) */
-		uint16 microseconds = SERVO_MIN_PULSE_US + (angle + 90) * ( 1000.0 / 180 );
+		/* Save global interrupt flag */
+		uint8 sreg = SREG;
+
+		/* Disable global interrupt to read the 16-bit values at once */
+		CLR_BIT( SREG , I );
 
-		/* Convert the microseconds to Timer Ticks for the PWM signal and Store it */
-		TIMER1_SetCompare_B_Value( SERVO_US_TO_TICKS( microseconds ) );
+		/* Moving if a new value is waiting or the position did not reach the target */
+		moving = g_SERVO_UpdatePending ||
+				( g_SERVO_Ticks[ servo_id ] != g_SERVO_Target[ servo_id ] );
+
+		/* Restore global interrupt flag */
+		SREG = sreg;
 	}
+
+	return moving;
 }
 
 
+
+
+
+/*
+ * @brief Steps the trapezoidal motion profile of one channel by one frame.
+ *
+ * The velocity is increased by the acceleration up to the maximum speed, and
+ * decreased when the stopping distance ( v^2 / 2a ) reaches the remaining distance.
+ * Only integer multiply is used (no division) to keep the ISR short.
+ *
+ * @param ch: The servo channel.
+ */
+static void SERVO_ProfileStep( uint8 ch )
+{
+	uint16 position  = g_SERVO_Ticks[ ch ];
+	uint16 target    = g_SERVO_Target[ ch ];
+	sint16 velocity  = g_SERVO_Velocity[ ch ];
+	uint8  max_speed = g_SERVO_MaxSpeed[ ch ];
+	uint8  accel     = g_SERVO_Accel[ ch ];
+
+
+	/* No Profile: Jump to the Target */
+	if ( max_speed == 0 )
+	{
+		g_SERVO_Ticks[ ch ]    = target;
+		g_SERVO_Velocity[ ch ] = 0;
+		return;
+	}
+
+	/* Already at the Target */
+	if ( ( position == target ) && ( velocity == 0 ) )
+	{
+		return;
+	}
+
+
+	/* Get the remaining distance and direction */
+	bool   forward  = ( target >= position );
+	uint16 distance = forward ? ( target - position ) : ( position - target );
+	uint16 speed    = ( velocity < 0 ) ? -velocity : velocity;
+
+	/* Check if the Servo is moving toward the Target */
+	bool toward = ( velocity == 0 ) || ( ( velocity > 0 ) == forward );
+
+
+	/* Brake if moving away or if the stopping distance reached the remaining distance */
+	if ( !toward || ( (uint32)speed * speed >= 2UL * accel * distance ) )
+	{
+		speed = ( speed > accel ) ? ( speed - accel ) : ( toward ? accel : 0 );
+	}
+	/* Accelerate up to the Maximum Speed */
+	else
+	{
+		speed = ( speed + accel > max_speed ) ? max_speed : ( speed + accel );
+	}
+
+
+	/* Move toward the Target */
+	if ( toward )
+	{
+		/* Stop on the Target if it is closer than one step */
+		if ( speed >= distance )
+		{
+			position = target;
+			velocity = 0;
+		}
+		else
+		{
+			position = forward ? ( position + speed ) : ( position - speed );
+			velocity = forward ? (sint16)speed : -(sint16)speed;
+		}
+	}
+	/* Keep moving away while braking */
+	else
+	{
+		position = ( velocity > 0 ) ? ( position + speed ) : ( position - speed );
+		velocity = ( velocity > 0 ) ? (sint16)speed : -(sint16)speed;
+	}
+
+
+	/* Keep the pulse inside the valid range */
+	if ( position < SERVO_MIN_PULSE_TICKS )
+	{
+		position = SERVO_MIN_PULSE_TICKS;
+		velocity = 0;
+	}
+	else if ( position > SERVO_MAX_PULSE_TICKS )
+	{
+		position = SERVO_MAX_PULSE_TICKS;
+		velocity = 0;
+	}
+
+	g_SERVO_Ticks[ ch ]    = position;
+	g_SERVO_Velocity[ ch ] = velocity;
+}
+
+#endif
+
+
+
+
+
+/*
+ * @brief Timer1 Compare Match B callback that generates the servo pulses.
+ *
+ * Each call ends the pulse of the current channel and starts the pulse of the
+ * next attached channel. OCR1B is moved from its last value (not from TCNT1)
+ * so the interrupt latency does not change the pulse widths.
+ * After the last channel the new values are applied, the profiles are stepped,
+ * and OCR1B is set to 0 to start the next frame.
+ */
+static void SERVO_CompareHandler( void )
+{
+
+	/* End the pulse of the current Channel */
+	if ( g_SERVO_Channel < SERVO_CHANNELS_NUM )
+	{
+		DIO_SetPinValue( g_SERVO_Pins[ g_SERVO_Channel ].port , g_SERVO_Pins[ g_SERVO_Channel ].pin , LOW );
+		g_SERVO_Channel++;
+	}
+	/* Start of a new Frame */
+	else
+	{
+		g_SERVO_Channel = 0;
+	}
+
+	/* Skip the Channels that are not attached */
+	while ( ( g_SERVO_Channel < SERVO_CHANNELS_NUM ) && IS_BIT_CLR( g_SERVO_Attached , g_SERVO_Channel ) )
+	{
+		g_SERVO_Channel++;
+	}
+
+
+	if ( g_SERVO_Channel < SERVO_CHANNELS_NUM )
+	{
+		/* Start the pulse of the next Channel */
+		DIO_SetPinValue( g_SERVO_Pins[ g_SERVO_Channel ].port , g_SERVO_Pins[ g_SERVO_Channel ].pin , HIGH );
+
+		/* End it after its pulse width */
+		g_SERVO_CompareValue += g_SERVO_Ticks[ g_SERVO_Channel ];
+		TIMER1_SetCompare_B_Value( g_SERVO_CompareValue );
+	}
+	else
+	{
+		/* Frame gap: wait for the start of the next Frame */
+		g_SERVO_CompareValue = 0;
+		TIMER1_SetCompare_B_Value( 0 );
+
+		/* Apply the new values together if no batch is in progress */
+		if ( g_SERVO_UpdatePending && ( g_SERVO_BatchLock == 0 ) )
+		{
+			for ( uint8 i = 0 ; i < SERVO_CHANNELS_NUM ; i++ )
+			{
+			#if SERVO_PROFILE_STATUS == SERVO_PROFILE_ENABLE
+				g_SERVO_Target[ i ] = g_SERVO_NextTicks[ i ];
+			#else
+				g_SERVO_Ticks[ i ]  = g_SERVO_NextTicks[ i ];
+			#endif
+			}
+
+			g_SERVO_UpdatePending = 0;
+		}
+
+	#if SERVO_PROFILE_STATUS == SERVO_PROFILE_ENABLE
+
+		/* Step the Motion Profiles of the attached Channels */
+		for ( uint8 i = 0 ; i < SERVO_CHANNELS_NUM ; i++ )
+		{
+			if ( IS_BIT_SET( g_SERVO_Attached , i ) )
+			{
+				SERVO_ProfileStep( i );
+			}
+		}
+
+	#endif
+	}
+}
+
+#endif
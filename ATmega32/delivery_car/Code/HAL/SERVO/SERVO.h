@@ -2,17 +2,21 @@
  * @file    SERVO.h
  * @author  Boles Medhat
  * @brief   Servo Motor Driver Header File
- * @version 1.0
+ * @version 2.0
  * @date    [2024-07-05]
  * @license MIT License Copyright (c) 2025 Boles Medhat
  *
  * @details
  * This file provides an abstraction for controlling servo motors.
+ * In SERVO_HW_OC1B_MODE one servo is driven by the OC1B hardware PWM.
+ * In SERVO_SW_MULTI_MODE up to 8 servos are driven one after the other inside
+ * the 20ms frame of Timer1, every pulse is started and ended by the Compare
+ * Match B interrupt, so adding servos needs no extra hardware timer.
  *
  * @note
- * - ⚠️ IMPORTANT: You must initialize the TIMER1 module in TIMER1_FAST_PWM_OCR1A_MODE mode
- * 				   **before** calling SERVO function. This driver does not initialize
- *	 	 	 	   TIMER1 module in TIMER1_FAST_PWM_OCR1A_MODE mode internally.
+ * - ⚠️ IMPORTANT: You must initialize the TIMER1 module **before** calling SERVO functions.
+ * 				   This driver does not initialize TIMER1 module internally.
+ * - See `SERVO_config.h` for the Timer1 mode needed by each Servo mode.
  *
  *
  * @contact
@@ -26,7 +30,30 @@
 
 #include "../../MCAL/TIMER1/TIMER1.h"
 #include "../../MCAL/DIO/DIO.h"
-#include "SERVO_def.h"
+#include "SERVO_config.h"
+
+
+/*
+ * @brief Initializes the servo driver.
+ *
+ * In SERVO_SW_MULTI_MODE this function centers all channels and registers
+ * the Compare Match B callback that generates the servo pulses.
+ */
+void SERVO_Init( void );
+
+
+
+/*
+ * @brief Attaches a servo signal pin to a servo channel.
+ *
+ * This function sets the servo pin as output and enables its channel.
+ * In SERVO_HW_OC1B_MODE only servo_id 0 is valid and the pin must be OC1B.
+ *
+ * @param servo_id: The servo channel (from 0 to SERVO_CHANNELS_NUM - 1).
+ * @param servo:    The servo signal pin.
+ */
+void SERVO_Attach( uint8 servo_id , Servo servo );
+
 
 
 /*
@@ -34,10 +61,65 @@
  *
  * This function sets the desired angle of the servo.
  * The angle must be within the valid range of -90 to 90 degrees.
+ * In SERVO_SW_MULTI_MODE the new value is applied at the start of the next frame,
+ * or moved to with the motion profile if it is set for this servo.
  *
+ * @param servo_id: The servo channel.
  * @param angle:    The desired angle for the servo (in degrees).
  */
-void SERVO_SetAngle( sint8 angle );
+void SERVO_SetAngle( uint8 servo_id , sint8 angle );
+
+
+
+#if SERVO_MODE == SERVO_SW_MULTI_MODE
+
+/*
+ * @brief Starts a batch update of servo angles.
+ *
+ * All the SERVO_SetAngle calls between SERVO_BatchBegin and SERVO_BatchCommit
+ * are applied together at the start of the same frame.
+ */
+void SERVO_BatchBegin( void );
+
+
+
+/*
+ * @brief Ends a batch update of servo angles.
+ *
+ * This function releases the new angles to be applied at the start of the next frame.
+ */
+void SERVO_BatchCommit( void );
+
+
+
+#if SERVO_PROFILE_STATUS == SERVO_PROFILE_ENABLE
+
+/*
+ * @brief Sets the trapezoidal motion profile of a servo.
+ *
+ * The servo accelerates to max_speed, cruises, then decelerates to stop at the
+ * target angle. The profile is stepped once per frame in the background.
+ *
+ * @param servo_id:     The servo channel.
+ * @param max_speed:    Maximum speed in Timer1 ticks per frame (0 disables the profile).
+ * @param acceleration: Acceleration in Timer1 ticks per frame per frame (minimum 1).
+ */
+void SERVO_SetProfile( uint8 servo_id , uint8 max_speed , uint8 acceleration );
+
+
+
+/*
+ * @brief Checks if a servo is still moving to its target angle.
+ *
+ * @param servo_id: The servo channel.
+ *
+ * @return (bool) true if the servo has not reached its target, false otherwise.
+ */
+bool SERVO_IsMoving( uint8 servo_id );
+
+#endif
+
+#endif
 
 
 #endif /* SERVO_H_ */
@@ -2,14 +2,16 @@
  * @file    SERVO_config.h
  * @author  Boles Medhat
  * @brief   Servo Motor Driver Configuration Header File
- * @version 1.0
+ * @version 2.0
  * @date    [2024-07-05]
  * @license MIT License Copyright (c) 2025 Boles Medhat
  *
  * @note
- * - ⚠️ IMPORTANT: You must initialize the TIMER1 module in TIMER1_FAST_PWM_OCR1A_MODE mode
- * 				   **before** calling SERVO function. This driver does not initialize
- *	 	 	 	   TIMER1 module in TIMER1_FAST_PWM_OCR1A_MODE mode internally.
+ * - ⚠️ IMPORTANT: You must initialize the TIMER1 module **before** calling SERVO functions.
+ * 				   This driver does not initialize TIMER1 module internally.
+ * - SERVO_HW_OC1B_MODE  needs TIMER1_FAST_PWM_OCR1A_MODE with OC1B non-inverting.
+ * - SERVO_SW_MULTI_MODE needs TIMER1_CTC_OCR1A_MODE with OC1B disconnected and
+ *   the Compare Match B interrupt enabled (OCR1A sets the 20ms frame).
  *
  *
  * @contact
@@ -25,6 +27,30 @@
 #include "../../MCAL/TIMER1/TIMER1.h"
 
 
+/*Set Servo Driver Mode
+ * choose between:
+ * 1. SERVO_HW_OC1B_MODE				<--one servo on OC1B pin
+ * 2. SERVO_SW_MULTI_MODE				<--up to 8 servos on any DIO pins
+ */
+#define SERVO_MODE							SERVO_HW_OC1B_MODE
+
+
+#if SERVO_MODE == SERVO_SW_MULTI_MODE
+
+	/*Number of servo channels (from 1 to SERVO_MAX_CHANNELS)*/
+	#define SERVO_CHANNELS_NUM				8
+
+
+	/*Set Servo Motion Profile Status
+	 * choose between:
+	 * 1. SERVO_PROFILE_DISABLE
+	 * 2. SERVO_PROFILE_ENABLE			//the profile is updated once per frame in the COMPB ISR
+	 */
+	#define SERVO_PROFILE_STATUS			SERVO_PROFILE_ENABLE
+
+#endif
+
+
 /* You must initialize Timer1 manually "TIMER1_Init()" before using this driver */
 #ifndef TIMER1_IN_HAL
 #define TIMER1_IN_HAL
@@ -32,9 +58,36 @@
 #endif
 
 
-/* Configure Timer1 to Normal mode */
-#if TIMER1_WAVEFORM_GENERATION_MODE != TIMER1_FAST_PWM_OCR1A_MODE
-	#warning "⚠️ Configure Timer1 in TIMER1_FAST_PWM_OCR1A_MODE mode."
+#if SERVO_MODE == SERVO_HW_OC1B_MODE
+
+	/* Configure Timer1 to Fast PWM mode with OCR1A top */
+	#if TIMER1_WAVEFORM_GENERATION_MODE != TIMER1_FAST_PWM_OCR1A_MODE
+		#warning "⚠️ Configure Timer1 in TIMER1_FAST_PWM_OCR1A_MODE mode."
+	#endif
+
+#elif SERVO_MODE == SERVO_SW_MULTI_MODE
+
+	/* Configure Timer1 to CTC mode (OCR1B is not double buffered in CTC mode) */
+	#if TIMER1_WAVEFORM_GENERATION_MODE != TIMER1_CTC_OCR1A_MODE
+		#warning "⚠️ Configure Timer1 in TIMER1_CTC_OCR1A_MODE mode."
+	#endif
+
+	/* The Servo pulses are generated from the Compare Match B Interrupt */
+	#if TIMER1_COMPB_INT_STATUS != TIMER1_COMPB_INT_ENABLE
+		#warning "⚠️ Enable Timer1 Compare Match B Interrupt."
+	#endif
+
+	#if ( SERVO_CHANNELS_NUM < 1 ) || ( SERVO_CHANNELS_NUM > SERVO_MAX_CHANNELS )
+		#error "Wrong \"SERVO_CHANNELS_NUM\" configuration option"
+	#endif
+
+	/* All the pulses must fit in one frame with time left for the frame gap */
+	#if ( SERVO_CHANNELS_NUM * SERVO_MAX_PULSE_TICKS ) >= TIMER1_OCR1A_PRELOAD
+		#error "Servo pulses do not fit in one Timer1 frame, decrease SERVO_CHANNELS_NUM"
+	#endif
+
+#else
+	#error "Wrong \"SERVO_MODE\" configuration option"
 #endif
 
 
@@ -2,20 +2,19 @@
  * @file    SERVO_def.h
  * @author  Boles Medhat
  * @brief   Servo Motor Driver Definitions Header File
- * @version 1.0
+ * @version 2.0
  * @date    [2024-07-05]
  * @license MIT License Copyright (c) 2025 Boles Medhat
  *
  * @details
  * This file contains the macro definitions, types, and constants used by the
- * Servo Motor Driver to control servo motors via PWM signals. It supports up
- * to 9 servos and utilizes Timer1 in normal mode for generating timing intervals.
- * The driver uses software PWM to handle multiple servos efficiently.
+ * Servo Motor Driver to control servo motors via PWM signals. It supports a
+ * single servo on the OC1B pin (hardware PWM) or up to 8 servos on any DIO pins
+ * time-multiplexed on the Timer1 Compare Match B interrupt (software PWM).
  *
  * @note
- * - ⚠️ IMPORTANT: You must initialize the TIMER1 module in TIMER1_FAST_PWM_OCR1A_MODE mode
- * 				   **before** calling SERVO function. This driver does not initialize
- *	 	 	 	   TIMER1 module in TIMER1_FAST_PWM_OCR1A_MODE mode internally.
+ * - ⚠️ IMPORTANT: You must initialize the TIMER1 module **before** calling SERVO functions.
+ * 				   This driver does not initialize TIMER1 module internally.
  *
  *
  * @contact
@@ -30,10 +29,38 @@
 #include "../../LIB/STD_TYPES.h"
 
 
+/*------------------------------------------   types    -----------------------------------------*/
+
+/*Servo type for use in function parameter*/
+typedef struct
+{
+	uint8 port : 2;		/*Select port of the servo signal pin from [ DIO_PORTA , DIO_PORTB , DIO_PORTC , DIO_PORTD ]*/
+	uint8 pin  : 3;		/*Select pin  of the servo signal pin from [ DIO_PIN0 to DIO_PIN7 ]*/
+}Servo;
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   modes    -----------------------------------------*/
+
+/*Servo Driver Mode*/
+#define SERVO_HW_OC1B_MODE					0	/*One servo on OC1B pin, Timer1 in TIMER1_FAST_PWM_OCR1A_MODE*/
+#define SERVO_SW_MULTI_MODE					1	/*Up to 8 servos on DIO pins, Timer1 in TIMER1_CTC_OCR1A_MODE with COMPB interrupt*/
+
+/*Servo Motion Profile Status*/
+#define SERVO_PROFILE_DISABLE				0	/*SERVO_SetAngle moves the servo immediately*/
+#define SERVO_PROFILE_ENABLE				1	/*SERVO_SetAngle moves the servo with a trapezoidal velocity profile*/
+/*_______________________________________________________________________________________________*/
+
+
+
 /*------------------------------------------   macros    ----------------------------------------*/
 
 /*Convert Microseconds to Timer Ticks*/
 #define SERVO_US_TO_TICKS( US )				( ( ( US ) * ( F_CPU / 1000000UL ) ) / ( TIMER1_PRESCALER ) )
+
+/*Convert Angle (-90 -> 90) to Timer Ticks using only integer multiply and shift*/
+#define SERVO_ANGLE_TO_TICKS( ANGLE )		( SERVO_MIN_PULSE_TICKS + (uint16)( ( (uint32)( (ANGLE) - SERVO_MIN_ANGLE ) * SERVO_TICKS_PER_DEG_Q8 ) >> 8 ) )
 /*_______________________________________________________________________________________________*/
 
 
@@ -44,8 +71,20 @@
 #define SERVO_MIN_ANGLE						-90											/*Minimum servo angle (0   degrees)*/
 #define SERVO_MAX_ANGLE						90											/*Maximum servo angle (180 degrees)*/
 
-/*Servo Min pulse width*/
+/*Servo pulse width*/
 #define SERVO_MIN_PULSE_US					1000										/*Number of microseconds in minimum pulse width (1ms)*/
+#define SERVO_MAX_PULSE_US					2000										/*Number of microseconds in maximum pulse width (2ms)*/
+
+/*Servo pulse width in Timer Ticks (calculated once at compile time)*/
+#define SERVO_MIN_PULSE_TICKS				SERVO_US_TO_TICKS( SERVO_MIN_PULSE_US )		/*Minimum pulse width in Timer1 ticks*/
+#define SERVO_MAX_PULSE_TICKS				SERVO_US_TO_TICKS( SERVO_MAX_PULSE_US )		/*Maximum pulse width in Timer1 ticks*/
+#define SERVO_CENTER_TICKS					( ( SERVO_MIN_PULSE_TICKS + SERVO_MAX_PULSE_TICKS ) / 2 )	/*Pulse width of angle 0*/
+
+/*Timer1 ticks per one degree in Q8 fixed point (rounded)*/
+#define SERVO_TICKS_PER_DEG_Q8				( ( ( ( SERVO_MAX_PULSE_TICKS - SERVO_MIN_PULSE_TICKS ) * 256UL ) + 90 ) / 180 )
+
+/*Maximum number of servos in SERVO_SW_MULTI_MODE*/
+#define SERVO_MAX_CHANNELS					8
 /*_______________________________________________________________________________________________*/
 
 
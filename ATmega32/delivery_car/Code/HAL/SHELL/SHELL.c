@@ -0,0 +1,676 @@
+/****************************************************************************
+ * @file    SHELL.c
+ * @author  Boles Medhat
+ * @brief   UART Command Shell Source File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file implements the UART command shell.
+ * The RX ISR fills one line buffer while the other one is parsed. At the end
+ * of a line the callback marks the buffer as ready and gives the other one
+ * to the ISR. If the previous line is not parsed yet, the new line is dropped
+ * (the same buffer is received again) so a parsed line never changes.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include "SHELL.h"
+
+
+/* No line is waiting for SHELL_Task */
+#define SHELL_NO_LINE				0xFF
+
+/* SHELL_Task runs an empty line (sends the first prompt) */
+#define SHELL_EMPTY_LINE			2
+
+/* Start of the free RAM (after .data, .bss and .noinit), defined by the linker */
+extern uint8 __heap_start;
+
+/* Line buffers (the ISR may store the end char after the last character, +1 for the '\0') */
+static uint8 g_SHELL_Lines[ 2 ][ SHELL_LINE_SIZE + 2 ];
+
+/* Buffer filled by the RX ISR */
+static volatile uint8 g_SHELL_Receiving = 0;
+
+/* Buffer waiting for SHELL_Task, or SHELL_NO_LINE */
+static volatile uint8 g_SHELL_Ready = SHELL_NO_LINE;
+
+/* Registered variables and commands */
+static ShellVariable g_SHELL_Variables[ SHELL_MAX_VARIABLES ];
+static uint8 g_SHELL_VariablesCount = 0;
+static ShellCommand g_SHELL_Commands[ SHELL_MAX_COMMANDS ];
+static uint8 g_SHELL_CommandsCount = 0;
+
+/* Called by the "exit" command */
+static void (* g_SHELL_ExitCallback)(void) = NULL;
+
+
+
+
+
+/*
+ * @brief RX callback at the end of a line (ISR context).
+ */
+static void SHELL_LineReceived( void )
+{
+
+	/* Drop the line if the previous one is not parsed yet (receive it again in the same buffer) */
+	if ( g_SHELL_Ready == SHELL_NO_LINE )
+	{
+		g_SHELL_Ready = g_SHELL_Receiving;
+		g_SHELL_Receiving ^= 1;
+
+		UART_Set_RX_Callback( SHELL_LineReceived , g_SHELL_Lines[ g_SHELL_Receiving ] , SHELL_LINE_SIZE , SHELL_END_CHAR );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Sends an unsigned decimal number.
+ *
+ * @param number: The number to send.
+ */
+static void SHELL_PrintUnsigned( uint32 number )
+{
+	char digits[ 11 ];
+	uint8 count = 0;
+
+	/* Store the digits from the lowest one */
+	do
+	{
+		digits[ count++ ] = '0' + ( number % 10 );
+		number /= 10;
+	}
+	while ( number != 0 );
+
+	/* Send them from the highest one */
+	while ( count > 0 )
+	{
+		UART_WriteByte( digits[ --count ] );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Skips the spaces at the start of a string.
+ *
+ * @param text: The string.
+ *
+ * @return (const char *) First character that is not a space.
+ */
+static const char * SHELL_SkipSpaces( const char * text )
+{
+	while ( *text == ' ' )
+	{
+		text++;
+	}
+
+	return text;
+}
+
+
+
+
+
+/*
+ * @brief Checks if a string starts with a word (followed by a space or the end).
+ *
+ * @param text: The string.
+ * @param word: The word (in the flash).
+ *
+ * @return (const char *) The rest of the string after the word and its spaces, or NULL if it does not match.
+ */
+static const char * SHELL_MatchWord( const char * text , const char * word )
+{
+	char character;
+
+	while ( ( character = pgm_read_byte( word ) ) != '\0' )
+	{
+		if ( *text != character )
+		{
+			return NULL;
+		}
+
+		text++;
+		word++;
+	}
+
+	/* The word must end here */
+	if ( ( *text != ' ' ) && ( *text != '\0' ) )
+	{
+		return NULL;
+	}
+
+	return SHELL_SkipSpaces( text );
+}
+
+
+
+
+
+/*
+ * @brief Parses a signed decimal number.
+ *
+ * @param text:   The string.
+ * @param number: Pointer to store the number.
+ *
+ * @return (bool) true if the string is a number, false otherwise.
+ */
+static bool SHELL_ParseNumber( const char * text , sint32 * number )
+{
+	bool negative = false;
+	uint32 value = 0;
+
+	if ( *text == '-' )
+	{
+		negative = true;
+		text++;
+	}
+
+	/* At least one digit */
+	if ( ( *text < '0' ) || ( *text > '9' ) )
+	{
+		return false;
+	}
+
+	while ( ( *text >= '0' ) && ( *text <= '9' ) )
+	{
+		value = value * 10 + ( *text - '0' );
+		text++;
+	}
+
+	/* Nothing but spaces after the number */
+	if ( *SHELL_SkipSpaces( text ) != '\0' )
+	{
+		return false;
+	}
+
+	*number = negative ? -(sint32)value : (sint32)value;
+
+	return true;
+}
+
+
+
+
+
+/*
+ * @brief Finds a registered variable by the first word of a string.
+ *
+ * @param text: The string.
+ * @param rest: Pointer to store the rest of the string after the name.
+ *
+ * @return (ShellVariable *) The variable, or NULL if not found.
+ */
+static ShellVariable * SHELL_FindVariable( const char * text , const char ** rest )
+{
+	for ( uint8 index = 0 ; index < g_SHELL_VariablesCount ; index++ )
+	{
+		*rest = SHELL_MatchWord( text , g_SHELL_Variables[ index ].name );
+
+		if ( *rest != NULL )
+		{
+			return &g_SHELL_Variables[ index ];
+		}
+	}
+
+	return NULL;
+}
+
+
+
+
+
+/*
+ * @brief Reads a registered variable (atomic, it may be changed by an ISR).
+ *
+ * @param variable: The variable.
+ *
+ * @return (sint32) The value (UINT32 values above 0x7FFFFFFF are negative).
+ */
+static sint32 SHELL_ReadVariable( const ShellVariable * variable )
+{
+	sint32 value = 0;
+
+	/* Save global interrupt flag and disable it */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	switch ( variable->type )
+	{
+		case SHELL_UINT8:	value = *(uint8  *)variable->address;	break;
+		case SHELL_SINT8:	value = *(sint8  *)variable->address;	break;
+		case SHELL_UINT16:	value = *(uint16 *)variable->address;	break;
+		case SHELL_SINT16:	value = *(sint16 *)variable->address;	break;
+		case SHELL_UINT32:	value = *(uint32 *)variable->address;	break;
+		case SHELL_SINT32:	value = *(sint32 *)variable->address;	break;
+	}
+
+	/* Restore global interrupt flag */
+	SREG = sreg;
+
+	return value;
+}
+
+
+
+
+
+/*
+ * @brief Writes a registered variable (atomic, it may be read by an ISR).
+ *
+ * @param variable: The variable.
+ * @param value:    The new value (cut to the size of the variable).
+ */
+static void SHELL_WriteVariable( const ShellVariable * variable , sint32 value )
+{
+	/* Save global interrupt flag and disable it */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	switch ( variable->type )
+	{
+		case SHELL_UINT8:	*(uint8  *)variable->address = value;	break;
+		case SHELL_SINT8:	*(sint8  *)variable->address = value;	break;
+		case SHELL_UINT16:	*(uint16 *)variable->address = value;	break;
+		case SHELL_SINT16:	*(sint16 *)variable->address = value;	break;
+		case SHELL_UINT32:	*(uint32 *)variable->address = value;	break;
+		case SHELL_SINT32:	*(sint32 *)variable->address = value;	break;
+	}
+
+	/* Restore global interrupt flag */
+	SREG = sreg;
+}
+
+
+
+
+
+/*
+ * @brief Sends "name = value" of a variable.
+ *
+ * @param variable: The variable.
+ */
+static void SHELL_PrintVariable( const ShellVariable * variable )
+{
+	sint32 value = SHELL_ReadVariable( variable );
+
+	SHELL_Print_P( variable->name );
+	SHELL_Print_P( PSTR( " = " ) );
+
+	if ( variable->type == SHELL_UINT32 )
+	{
+		SHELL_PrintUnsigned( (uint32)value );
+	}
+	else
+	{
+		SHELL_PrintNumber( value );
+	}
+
+	SHELL_Print_P( PSTR( "\r\n" ) );
+}
+
+
+
+
+
+/*
+ * @brief Runs a command line.
+ *
+ * @param line: The command line (ends with '\0', no leading spaces).
+ */
+static void SHELL_Execute( const char * line )
+{
+	const char * args;
+	ShellVariable * variable;
+
+	if ( *line == '\0' )
+	{
+		/* Empty line, only a new prompt */
+	}
+	else if ( SHELL_MatchWord( line , PSTR( "help" ) ) != NULL )
+	{
+		SHELL_Print_P( PSTR( "help vars get set stack exit" ) );
+
+		for ( uint8 index = 0 ; index < g_SHELL_CommandsCount ; index++ )
+		{
+			SHELL_Print_P( PSTR( " " ) );
+			SHELL_Print_P( g_SHELL_Commands[ index ].name );
+		}
+
+		SHELL_Print_P( PSTR( "\r\n" ) );
+	}
+	else if ( SHELL_MatchWord( line , PSTR( "vars" ) ) != NULL )
+	{
+		for ( uint8 index = 0 ; index < g_SHELL_VariablesCount ; index++ )
+		{
+			SHELL_PrintVariable( &g_SHELL_Variables[ index ] );
+		}
+	}
+	else if ( ( args = SHELL_MatchWord( line , PSTR( "get" ) ) ) != NULL )
+	{
+		variable = SHELL_FindVariable( args , &args );
+
+		if ( variable != NULL )
+		{
+			SHELL_PrintVariable( variable );
+		}
+		else
+		{
+			SHELL_Print_P( PSTR( "unknown variable\r\n" ) );
+		}
+	}
+	else if ( ( args = SHELL_MatchWord( line , PSTR( "set" ) ) ) != NULL )
+	{
+		sint32 value;
+
+		variable = SHELL_FindVariable( args , &args );
+
+		if ( variable == NULL )
+		{
+			SHELL_Print_P( PSTR( "unknown variable\r\n" ) );
+		}
+		else if ( !SHELL_ParseNumber( args , &value ) )
+		{
+			SHELL_Print_P( PSTR( "bad value\r\n" ) );
+		}
+		else
+		{
+			SHELL_WriteVariable( variable , value );
+			SHELL_PrintVariable( variable );
+		}
+	}
+	else if ( SHELL_MatchWord( line , PSTR( "stack" ) ) != NULL )
+	{
+		/* The variables (.data, .bss and .noinit) are from the start of the RAM to __heap_start */
+		SHELL_Print_P( PSTR( "ram = " ) );
+		SHELL_PrintUnsigned( (uint16)&__heap_start - SHELL_RAM_START );
+		SHELL_Print_P( PSTR( " free stack = " ) );
+		SHELL_PrintUnsigned( SHELL_GetFreeStack() );
+		SHELL_Print_P( PSTR( " of " ) );
+		SHELL_PrintUnsigned( SHELL_RAM_SIZE );
+		SHELL_Print_P( PSTR( "\r\n" ) );
+	}
+	else if ( SHELL_MatchWord( line , PSTR( "exit" ) ) != NULL )
+	{
+		g_SHELL_Ready = SHELL_NO_LINE;
+
+		/* Give the UART back to the application (no prompt) */
+		if ( g_SHELL_ExitCallback != NULL )
+		{
+			g_SHELL_ExitCallback();
+		}
+
+		return;
+	}
+	else
+	{
+		args = NULL;
+
+		/* Application commands */
+		for ( uint8 index = 0 ; index < g_SHELL_CommandsCount ; index++ )
+		{
+			args = SHELL_MatchWord( line , g_SHELL_Commands[ index ].name );
+
+			if ( args != NULL )
+			{
+				g_SHELL_Commands[ index ].handler( args );
+				break;
+			}
+		}
+
+		if ( args == NULL )
+		{
+			SHELL_Print_P( PSTR( "unknown command\r\n" ) );
+		}
+	}
+
+	SHELL_Print_P( PSTR( SHELL_PROMPT ) );
+}
+
+
+
+
+
+/*
+ * @brief Initializes the shell and paints the free RAM for the stack check.
+ *
+ * Call it at the start of main (the free RAM is painted up to the current stack).
+ */
+void SHELL_Init( void )
+{
+	uint8 marker;
+
+	/* Paint from the end of the variables to a little under the current stack */
+	for ( uint8 * address = &__heap_start ; address < &marker - SHELL_STACK_MARGIN ; address++ )
+	{
+		*address = SHELL_STACK_PAINT;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Starts the shell: takes the UART RX interrupt, the prompt is sent by SHELL_Task.
+ *
+ * It can be called from a UART RX callback (it does not send anything).
+ *
+ * @param exit_callback: Function called by the "exit" command to give the UART back
+ * 						 to the application (may be NULL).
+ */
+void SHELL_Start( void (*exit_callback)(void) )
+{
+	g_SHELL_ExitCallback = exit_callback;
+
+	/* Receive the lines in the shell buffers */
+	UART_Set_RX_Callback( SHELL_LineReceived , g_SHELL_Lines[ g_SHELL_Receiving ] , SHELL_LINE_SIZE , SHELL_END_CHAR );
+
+	/* The prompt is sent by SHELL_Task (this function may be called from the RX ISR) */
+	g_SHELL_Ready = SHELL_EMPTY_LINE;
+}
+
+
+
+
+
+/*
+ * @brief Runs a received command line (call it from the main loop).
+ */
+void SHELL_Task( void )
+{
+
+	/* Nothing to do while no line is received */
+	if ( g_SHELL_Ready == SHELL_NO_LINE )
+	{
+		return;
+	}
+
+	/* First prompt after SHELL_Start */
+	if ( g_SHELL_Ready == SHELL_EMPTY_LINE )
+	{
+		g_SHELL_Ready = SHELL_NO_LINE;
+		SHELL_Execute( "" );
+		return;
+	}
+
+	char * line = (char *)g_SHELL_Lines[ g_SHELL_Ready ];
+
+	/* End the line at the end char (or at the end of the buffer) */
+	line[ SHELL_LINE_SIZE + 1 ] = '\0';
+
+	for ( uint8 index = 0 ; index <= SHELL_LINE_SIZE ; index++ )
+	{
+		if ( line[ index ] == SHELL_END_CHAR )
+		{
+			line[ index ] = '\0';
+			break;
+		}
+	}
+
+	/* The '\n' of a "\r\n" line end is received at the start of the next line */
+	while ( ( *line == '\n' ) || ( *line == ' ' ) )
+	{
+		line++;
+	}
+
+	SHELL_Execute( line );
+
+	/* The buffer can be received again */
+	g_SHELL_Ready = SHELL_NO_LINE;
+}
+
+
+
+
+
+/*
+ * @brief Registers a variable for the get, set and vars commands.
+ *
+ * @param name:    Name of the variable (a flash string, PSTR( "name" ), without spaces).
+ * @param address: Address of the variable.
+ * @param type:    Type [ SHELL_UINT8 , SHELL_SINT8 , SHELL_UINT16 , SHELL_SINT16 , SHELL_UINT32 , SHELL_SINT32 ].
+ *
+ * @return (bool) true if registered, false if the table is full or the parameters are invalid.
+ */
+bool SHELL_RegisterVariable( const char * name , void * address , uint8 type )
+{
+	if ( ( name == NULL ) || ( address == NULL ) || ( type > SHELL_SINT32 ) || ( g_SHELL_VariablesCount >= SHELL_MAX_VARIABLES ) )
+	{
+		return false;
+	}
+
+	g_SHELL_Variables[ g_SHELL_VariablesCount ].name    = name;
+	g_SHELL_Variables[ g_SHELL_VariablesCount ].address = address;
+	g_SHELL_Variables[ g_SHELL_VariablesCount ].type    = type;
+	g_SHELL_VariablesCount++;
+
+	return true;
+}
+
+
+
+
+
+/*
+ * @brief Registers a command.
+ *
+ * @param name:    First word of the command line (a flash string, PSTR( "name" )).
+ * @param handler: Function called with the rest of the line.
+ *
+ * @return (bool) true if registered, false if the table is full or the parameters are invalid.
+ */
+bool SHELL_RegisterCommand( const char * name , void (*handler)( const char * args ) )
+{
+	if ( ( name == NULL ) || ( handler == NULL ) || ( g_SHELL_CommandsCount >= SHELL_MAX_COMMANDS ) )
+	{
+		return false;
+	}
+
+	g_SHELL_Commands[ g_SHELL_CommandsCount ].name    = name;
+	g_SHELL_Commands[ g_SHELL_CommandsCount ].handler = handler;
+	g_SHELL_CommandsCount++;
+
+	return true;
+}
+
+
+
+
+
+/*
+ * @brief Sends a string (without the '\0').
+ *
+ * @param string: The string to send.
+ */
+void SHELL_Print( const char * string )
+{
+	while ( *string != '\0' )
+	{
+		UART_WriteByte( *string );
+		string++;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Sends a string from the flash (without the '\0').
+ *
+ * @param string: The string to send (in the flash, for example PSTR( "text" )).
+ */
+void SHELL_Print_P( const char * string )
+{
+	char character;
+
+	while ( ( character = pgm_read_byte( string++ ) ) != '\0' )
+	{
+		UART_WriteByte( character );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Sends a signed decimal number.
+ *
+ * @param number: The number to send.
+ */
+void SHELL_PrintNumber( sint32 number )
+{
+	if ( number < 0 )
+	{
+		UART_WriteByte( '-' );
+		SHELL_PrintUnsigned( -(uint32)number );
+	}
+	else
+	{
+		SHELL_PrintUnsigned( number );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Gets the number of RAM bytes that the stack has never used.
+ *
+ * @return (uint16) Bytes between the end of the variables and the deepest stack use.
+ */
+uint16 SHELL_GetFreeStack( void )
+{
+	uint16 count = 0;
+	const uint8 * address = &__heap_start;
+
+	/* Count the painted bytes that are still not changed */
+	while ( *address == SHELL_STACK_PAINT )
+	{
+		count++;
+		address++;
+	}
+
+	return count;
+}
+
+
+
+
+
@@ -0,0 +1,136 @@
+/****************************************************************************
+ * @file    SHELL.h
+ * @author  Boles Medhat
+ * @brief   UART Command Shell Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file provides a line command shell on the UART to look at the state
+ * of the application in the field without reflashing it.
+ * The lines are received by the UART RX interrupt into two buffers, the ISR
+ * only swaps the buffers at the end of a line, and SHELL_Task() runs the
+ * command from the main loop. When no line is received SHELL_Task() only
+ * checks one flag, so the shell costs nothing while it is idle.
+ *
+ * Built-in commands:
+ * - help              : list the commands
+ * - vars              : list the registered variables and their values
+ * - get <var>         : read a registered variable
+ * - set <var> <value> : write a registered variable (atomic for 16 and 32 bits)
+ * - stack             : RAM of the variables and bytes never used by the stack since SHELL_Init
+ * - exit              : leave the shell (the exit callback takes the UART back)
+ *
+ * The application adds its own commands with SHELL_RegisterCommand.
+ *
+ * @note
+ * - ⚠️ IMPORTANT: You must initialize the UART module **before** calling SHELL_Start.
+ * - The answers are sent with polling from the main loop (not from an ISR).
+ * - The strings of the shell and the names of the variables and commands
+ *   are in the flash (PSTR), so they take no RAM.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef SHELL_H_
+#define SHELL_H_
+
+#include "../../MCAL/UART/UART.h"
+#include "SHELL_config.h"
+#include <avr/pgmspace.h>
+
+
+/*
+ * @brief Initializes the shell and paints the free RAM for the stack check.
+ *
+ * Call it at the start of main (the free RAM is painted up to the current stack).
+ */
+void SHELL_Init( void );
+
+
+
+/*
+ * @brief Starts the shell: takes the UART RX interrupt, the prompt is sent by SHELL_Task.
+ *
+ * It can be called from a UART RX callback (it does not send anything).
+ *
+ * @param exit_callback: Function called by the "exit" command to give the UART back
+ * 						 to the application (may be NULL).
+ */
+void SHELL_Start( void (*exit_callback)(void) );
+
+
+
+/*
+ * @brief Runs a received command line (call it from the main loop).
+ */
+void SHELL_Task( void );
+
+
+
+/*
+ * @brief Registers a variable for the get, set and vars commands.
+ *
+ * @param name:    Name of the variable (a flash string, PSTR( "name" ), without spaces).
+ * @param address: Address of the variable.
+ * @param type:    Type [ SHELL_UINT8 , SHELL_SINT8 , SHELL_UINT16 , SHELL_SINT16 , SHELL_UINT32 , SHELL_SINT32 ].
+ *
+ * @return (bool) true if registered, false if the table is full or the parameters are invalid.
+ */
+bool SHELL_RegisterVariable( const char * name , void * address , uint8 type );
+
+
+
+/*
+ * @brief Registers a command.
+ *
+ * @param name:    First word of the command line (a flash string, PSTR( "name" )).
+ * @param handler: Function called with the rest of the line.
+ *
+ * @return (bool) true if registered, false if the table is full or the parameters are invalid.
+ */
+bool SHELL_RegisterCommand( const char * name , void (*handler)( const char * args ) );
+
+
+
+/*
+ * @brief Sends a string (without the '\0').
+ *
+ * @param string: The string to send.
+ */
+void SHELL_Print( const char * string );
+
+
+
+/*
+ * @brief Sends a string from the flash (without the '\0').
+ *
+ * @param string: The string to send (in the flash, for example PSTR( "text" )).
+ */
+void SHELL_Print_P( const char * string );
+
+
+
+/*
+ * @brief Sends a signed decimal number.
+ *
+ * @param number: The number to send.
+ */
+void SHELL_PrintNumber( sint32 number );
+
+
+
+/*
+ * @brief Gets the number of RAM bytes that the stack has never used.
+ *
+ * @return (uint16) Bytes between the end of the variables and the deepest stack use.
+ */
+uint16 SHELL_GetFreeStack( void );
+
+
+#endif /* SHELL_H_ */
@@ -0,0 +1,54 @@
+/****************************************************************************
+ * @file    SHELL_config.h
+ * @author  Boles Medhat
+ * @brief   UART Command Shell Configuration Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @note
+ * - ⚠️ IMPORTANT: The UART receiver, transmitter and RX interrupt must be enabled
+ * 				   in `UART_config.h`. This driver does not initialize UART module internally.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef SHELL_CONFIG_H_
+#define SHELL_CONFIG_H_
+
+#include "SHELL_def.h"
+#include "../../MCAL/UART/UART.h"
+
+
+/*Set the maximum length of a command line (characters)*/
+#define SHELL_LINE_SIZE						32
+
+
+/*Set the maximum number of registered variables and commands*/
+#define SHELL_MAX_VARIABLES					8
+#define SHELL_MAX_COMMANDS					5
+
+
+/*Set the prompt sent before every command line*/
+#define SHELL_PROMPT						"> "
+
+
+
+#if UART_RECEIVER_ENABLE != UART_ENABLE || UART_TRANSMITTER_ENABLE != UART_ENABLE
+	#warning "⚠️ Enable the UART receiver and transmitter for the shell."
+#endif
+
+#if UART_RX_INTERRUPT != UART_INT_ENABLE
+	#warning "⚠️ Enable the UART RX interrupt for the shell."
+#endif
+
+#if ( SHELL_LINE_SIZE < 8 ) || ( SHELL_LINE_SIZE > 255 )
+	#error "SHELL_LINE_SIZE must be from 8 to 255"
+#endif
+
+
+#endif /* SHELL_CONFIG_H_ */
@@ -0,0 +1,71 @@
+/****************************************************************************
+ * @file    SHELL_def.h
+ * @author  Boles Medhat
+ * @brief   UART Command Shell Definitions Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the types, macro definitions and constants used by the
+ * UART Command Shell (line commands to read and write registered variables).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef SHELL_DEF_H_
+#define SHELL_DEF_H_
+
+#include "../../LIB/STD_TYPES.h"
+
+
+/*------------------------------------------   types    -----------------------------------------*/
+
+/*Registered variable*/
+typedef struct
+{
+	const char * name;			/*Name used in the get and set commands (in the flash)*/
+	void *       address;		/*Address of the variable*/
+	uint8        type;			/*Type of the variable [ SHELL_UINT8 , SHELL_SINT8 , SHELL_UINT16 , SHELL_SINT16 , SHELL_UINT32 , SHELL_SINT32 ]*/
+}ShellVariable;
+
+/*Registered command*/
+typedef struct
+{
+	const char * name;						/*First word of the command line (in the flash)*/
+	void (* handler)( const char * args );	/*Called with the rest of the line (after the spaces)*/
+}ShellCommand;
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Variable types*/
+#define SHELL_UINT8							0
+#define SHELL_SINT8							1
+#define SHELL_UINT16						2
+#define SHELL_SINT16						3
+#define SHELL_UINT32						4
+#define SHELL_SINT32						5
+
+/*Line end (the received line ends with it, the sent lines end with "\r\n")*/
+#define SHELL_END_CHAR						'\r'
+
+/*RAM of the ATmega32 (the variables start at SHELL_RAM_START, the stack starts at the end)*/
+#define SHELL_RAM_START						0x0060
+#define SHELL_RAM_SIZE						2048
+
+/*Value written to the free RAM at start to find the deepest stack use*/
+#define SHELL_STACK_PAINT					0xC5
+
+/*Bytes under the current stack pointer that are not painted (stack of SHELL_Init itself)*/
+#define SHELL_STACK_MARGIN					16
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* SHELL_DEF_H_ */
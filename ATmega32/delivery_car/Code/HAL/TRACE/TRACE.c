@@ -0,0 +1,414 @@
+/****************************************************************************
+ * @file    TRACE.c
+ * @author  Boles Medhat
+ * @brief   Timing Trace Source File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file implements the timing trace.
+ * A time is the Timer1 period count (counted by the Timer1 overflow
+ * interrupt) and the Timer1 counter. A duration inside one period is a 16-bit
+ * subtraction, so the interrupts pay only a few cycles for their timing.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include "TRACE.h"
+#include "../../LIB/DataConvert/DataConvert.h"
+#include <avr/pgmspace.h>
+
+#if TRACE_STATUS == TRACE_ENABLE
+
+
+/* Timer1 periods since TRACE_Init (wraps around) */
+static volatile uint16 g_TRACE_Frame = 0;
+
+/* Start of the running task */
+static uint8  g_TRACE_Task = TRACE_NONE;
+static uint16 g_TRACE_TaskFrame;
+static uint16 g_TRACE_TaskCount;
+
+/* Start of the running interrupt */
+static uint8  g_TRACE_Isr = TRACE_NONE;
+static uint16 g_TRACE_IsrFrame;
+static uint16 g_TRACE_IsrCount;
+
+/* Longest time of every id (Timer1 ticks) */
+static volatile uint16 g_TRACE_TaskMax[ TRACE_TASKS ];
+static volatile uint16 g_TRACE_IsrMax[ TRACE_ISRS ];
+
+/* Ring of the last events (g_TRACE_Head is the next event to write) */
+static volatile TraceEvent g_TRACE_Ring[ TRACE_RING_SIZE ];
+static volatile uint8 g_TRACE_Head = 0;
+static volatile uint8 g_TRACE_Count = 0;
+
+/* True while TRACE_Report sends the ring (no event is added) */
+static volatile bool g_TRACE_Paused = false;
+
+
+
+
+
+/*
+ * @brief Timer1 overflow callback (counts the Timer1 periods).
+ */
+static void TRACE_Overflow( void )
+{
+	g_TRACE_Frame++;
+}
+
+
+
+
+
+/*
+ * @brief Reads the current time.
+ *
+ * @param frame: Pointer to store the Timer1 period.
+ * @param count: Pointer to store the Timer1 counter.
+ */
+static void TRACE_Now( uint16 * frame , uint16 * count )
+{
+	/* Save global interrupt flag and disable it */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	*count = TIMER1_GetTimerValue();
+	*frame = g_TRACE_Frame;
+
+	/* The counter restarted before it was read, but the overflow interrupt did not run yet */
+	if ( GET_BIT( TIFR , TOV1 ) && ( *count < ( TRACE_PERIOD_TICKS / 2 ) ) )
+	{
+		( *frame )++;
+	}
+
+	/* Restore global interrupt flag */
+	SREG = sreg;
+}
+
+
+
+
+
+/*
+ * @brief Calculates the time from a start to now.
+ *
+ * @param start_frame: Timer1 period of the start.
+ * @param start_count: Timer1 counter of the start.
+ * @param frame:       Pointer to store the Timer1 period of now.
+ *
+ * @return (uint16) Duration in Timer1 ticks (TRACE_MAX_TICKS for a longer one).
+ */
+static uint16 TRACE_Elapsed( uint16 start_frame , uint16 start_count , uint16 * frame )
+{
+	uint16 count;
+	uint32 ticks;
+
+	TRACE_Now( frame , &count );
+
+	uint16 frames = *frame - start_frame;
+
+	/* Inside one period only a 16-bit subtraction */
+	if ( frames == 0 )
+	{
+		return count - start_count;
+	}
+
+	if ( frames > ( TRACE_MAX_TICKS / TRACE_PERIOD_TICKS ) + 1 )
+	{
+		return TRACE_MAX_TICKS;
+	}
+
+	ticks = ( (uint32)frames * TRACE_PERIOD_TICKS ) + count - start_count;
+
+	return ( ticks > TRACE_MAX_TICKS ) ? TRACE_MAX_TICKS : (uint16)ticks;
+}
+
+
+
+
+
+/*
+ * @brief Adds an event to the ring (the oldest one is overwritten when the ring is full).
+ *
+ * @param id:    Task id, or interrupt id | TRACE_ISR_FLAG.
+ * @param frame: Timer1 period of the end of the event.
+ * @param ticks: Duration in Timer1 ticks.
+ */
+static void TRACE_Add( uint8 id , uint16 frame , uint16 ticks )
+{
+	/* Save global interrupt flag and disable it (the tasks and the interrupts add events) */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	if ( !g_TRACE_Paused )
+	{
+		g_TRACE_Ring[ g_TRACE_Head ].id    = id;
+		g_TRACE_Ring[ g_TRACE_Head ].frame = frame;
+		g_TRACE_Ring[ g_TRACE_Head ].ticks = ticks;
+
+		g_TRACE_Head = ( g_TRACE_Head + 1 ) & ( TRACE_RING_SIZE - 1 );
+
+		if ( g_TRACE_Count < TRACE_RING_SIZE )
+		{
+			g_TRACE_Count++;
+		}
+	}
+
+	/* Restore global interrupt flag */
+	SREG = sreg;
+}
+
+
+
+
+
+/*
+ * @brief Sends a string from the flash.
+ *
+ * @param write_byte: Function that sends one byte.
+ * @param string:     String to send (in the flash).
+ */
+static void TRACE_WriteString( void (*write_byte)(uint8) , const char * string )
+{
+	char character;
+
+	while ( ( character = pgm_read_byte( string++ ) ) != '\0' )
+	{
+		write_byte( character );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Sends a number as decimal text.
+ *
+ * @param write_byte: Function that sends one byte.
+ * @param number:     Number to send.
+ */
+static void TRACE_WriteNumber( void (*write_byte)(uint8) , sint32 number )
+{
+	char string[ 12 ];
+
+	DC_itoa( number , string , 10 );
+
+	for ( uint8 index = 0 ; string[ index ] != '\0' ; index++ )
+	{
+		write_byte( string[ index ] );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Sends the longest times of a kind of ids (the ids that never ran are skipped).
+ *
+ * @param write_byte: Function that sends one byte.
+ * @param name:       Kind of the ids (in the flash).
+ * @param max:        Longest times of the ids.
+ * @param ids:        Number of ids.
+ */
+static void TRACE_WriteMax( void (*write_byte)(uint8) , const char * name , volatile uint16 * max , uint8 ids )
+{
+	TRACE_WriteString( write_byte , PSTR( "max " ) );
+	TRACE_WriteString( write_byte , name );
+
+	for ( uint8 id = 0 ; id < ids ; id++ )
+	{
+		/* Save global interrupt flag and disable it (the interrupts write their times) */
+		uint8 sreg = SREG;
+		CLR_BIT( SREG , I );
+		uint16 ticks = max[ id ];
+		SREG = sreg;
+
+		if ( ticks != 0 )
+		{
+			write_byte( ' ' );
+			TRACE_WriteNumber( write_byte , id );
+			write_byte( ' ' );
+			TRACE_WriteNumber( write_byte , TRACE_TICKS_TO_US( ticks ) );
+		}
+	}
+
+	TRACE_WriteString( write_byte , PSTR( "\r\n" ) );
+}
+
+
+
+
+
+/*
+ * @brief Starts counting the Timer1 periods (sets the Timer1 overflow callback).
+ */
+void TRACE_Init( void )
+{
+	TIMER1_SetCallback( TIMER1_OVF_ID , TRACE_Overflow );
+	TIMER1_InterruptEnable( TIMER1_OVF_ID );
+}
+
+
+
+
+
+/*
+ * @brief Ends the running task (its time is kept) and starts a task.
+ *
+ * @param id: Id of the task (from 0 to TRACE_TASKS - 1).
+ */
+void TRACE_TaskBegin( uint8 id )
+{
+	uint16 frame;
+
+	if ( g_TRACE_Task != TRACE_NONE )
+	{
+		uint16 ticks = TRACE_Elapsed( g_TRACE_TaskFrame , g_TRACE_TaskCount , &frame );
+
+		if ( ticks > g_TRACE_TaskMax[ g_TRACE_Task ] )
+		{
+			g_TRACE_TaskMax[ g_TRACE_Task ] = ticks;
+		}
+
+		if ( ticks >= TRACE_TASK_MIN_TICKS )
+		{
+			TRACE_Add( g_TRACE_Task , frame , ticks );
+		}
+	}
+
+	g_TRACE_Task = ( id < TRACE_TASKS ) ? id : TRACE_NONE;
+
+	/* The next task starts after the time is kept */
+	TRACE_Now( &g_TRACE_TaskFrame , &g_TRACE_TaskCount );
+}
+
+
+
+
+
+/*
+ * @brief Starts the time of an interrupt (call it from the interrupt).
+ *
+ * @param id: Id of the interrupt (from 0 to TRACE_ISRS - 1).
+ */
+void TRACE_IsrBegin( uint8 id )
+{
+	g_TRACE_Isr = ( id < TRACE_ISRS ) ? id : TRACE_NONE;
+
+	TRACE_Now( &g_TRACE_IsrFrame , &g_TRACE_IsrCount );
+}
+
+
+
+
+
+/*
+ * @brief Ends the time of the interrupt started by TRACE_IsrBegin (call it before the interrupt returns).
+ */
+void TRACE_IsrEnd( void )
+{
+	uint16 frame;
+
+	if ( g_TRACE_Isr == TRACE_NONE )
+	{
+		return;
+	}
+
+	uint16 ticks = TRACE_Elapsed( g_TRACE_IsrFrame , g_TRACE_IsrCount , &frame );
+
+	if ( ticks > g_TRACE_IsrMax[ g_TRACE_Isr ] )
+	{
+		g_TRACE_IsrMax[ g_TRACE_Isr ] = ticks;
+	}
+
+	TRACE_Add( g_TRACE_Isr | TRACE_ISR_FLAG , frame , ticks );
+
+	g_TRACE_Isr = TRACE_NONE;
+}
+
+
+
+
+
+/*
+ * @brief Sets the longest times to 0 and empties the ring.
+ */
+void TRACE_Clear( void )
+{
+	/* Save global interrupt flag and disable it */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	for ( uint8 id = 0 ; id < TRACE_TASKS ; id++ )
+	{
+		g_TRACE_TaskMax[ id ] = 0;
+	}
+
+	for ( uint8 id = 0 ; id < TRACE_ISRS ; id++ )
+	{
+		g_TRACE_IsrMax[ id ] = 0;
+	}
+
+	g_TRACE_Count = 0;
+
+	/* Restore global interrupt flag */
+	SREG = sreg;
+}
+
+
+
+
+
+/*
+ * @brief Sends the longest times and the ring as text.
+ *
+ * Sends "max task <id> <us> ...\r\n" and "max isr <id> <us> ...\r\n" for the
+ * ids that ran, then one line per event of the ring, from the oldest:
+ * "<task|isr> <id> <us>us at <ms>ms\r\n" (the time wraps around after about
+ * 22 minutes). The ring is not changed while it is sent.
+ *
+ * @param write_byte: Function that sends one byte (for example UART_WriteByte).
+ */
+void TRACE_Report( void (*write_byte)(uint8) )
+{
+	if ( write_byte == NULL )
+	{
+		return;
+	}
+
+	TRACE_WriteMax( write_byte , PSTR( "task" ) , g_TRACE_TaskMax , TRACE_TASKS );
+	TRACE_WriteMax( write_byte , PSTR( "isr" ) , g_TRACE_IsrMax , TRACE_ISRS );
+
+	/* Keep the ring as it is while it is sent (the longest times are still kept) */
+	g_TRACE_Paused = true;
+
+	uint8 index = ( g_TRACE_Head - g_TRACE_Count ) & ( TRACE_RING_SIZE - 1 );
+
+	for ( uint8 event = 0 ; event < g_TRACE_Count ; event++ )
+	{
+		uint8 id = g_TRACE_Ring[ index ].id;
+
+		TRACE_WriteString( write_byte , ( id & TRACE_ISR_FLAG ) ? PSTR( "isr " ) : PSTR( "task " ) );
+		TRACE_WriteNumber( write_byte , id & ~TRACE_ISR_FLAG );
+		write_byte( ' ' );
+		TRACE_WriteNumber( write_byte , TRACE_TICKS_TO_US( g_TRACE_Ring[ index ].ticks ) );
+		TRACE_WriteString( write_byte , PSTR( "us at " ) );
+		TRACE_WriteNumber( write_byte , ( (uint32)g_TRACE_Ring[ index ].frame * TRACE_TICKS_TO_US( TRACE_PERIOD_TICKS ) ) / 1000 );
+		TRACE_WriteString( write_byte , PSTR( "ms\r\n" ) );
+
+		index = ( index + 1 ) & ( TRACE_RING_SIZE - 1 );
+	}
+
+	g_TRACE_Paused = false;
+}
+
+#endif
@@ -0,0 +1,113 @@
+/****************************************************************************
+ * @file    TRACE.h
+ * @author  Boles Medhat
+ * @brief   Timing Trace Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file provides the time of the main loop tasks and of the interrupts,
+ * measured with the Timer1 counter:
+ * - TRACE_TASK( id ) ends the running task and starts the next one, so one
+ *   call before every task of the main loop times all of them.
+ * - TRACE_ISR( id ) / TRACE_ISR_END() time an interrupt callback.
+ * - The longest time of every id is kept, and the interrupts and the slow
+ *   tasks (TRACE_TASK_MIN_TICKS or more) are added to a ring of the last
+ *   TRACE_RING_SIZE events.
+ * - TRACE_Report() sends them as text, the output function is a parameter
+ *   (for example UART_WriteByte).
+ *
+ * @note
+ * - ⚠️ IMPORTANT: You must initialize the TIMER1 module **before** calling TRACE_Init.
+ * - The time of a task includes the interrupts that run during it.
+ * - With TRACE_STATUS = TRACE_DISABLE the macros do nothing and the
+ *   functions are not compiled.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef TRACE_H_
+#define TRACE_H_
+
+#include "TRACE_config.h"
+
+
+#if TRACE_STATUS == TRACE_ENABLE
+
+/* Ends the running main loop task and starts the task id */
+#define TRACE_TASK( id )					TRACE_TaskBegin( id )
+
+/* Starts the time of the interrupt id */
+#define TRACE_ISR( id )						TRACE_IsrBegin( id )
+
+/* Ends the time of the interrupt */
+#define TRACE_ISR_END()						TRACE_IsrEnd()
+
+#else
+
+#define TRACE_TASK( id )					((void)0)
+#define TRACE_ISR( id )						((void)0)
+#define TRACE_ISR_END()						((void)0)
+
+#endif
+
+
+
+/*
+ * @brief Starts counting the Timer1 periods (sets the Timer1 overflow callback).
+ */
+void TRACE_Init( void );
+
+
+
+/*
+ * @brief Ends the running task (its time is kept) and starts a task.
+ *
+ * @param id: Id of the task (from 0 to TRACE_TASKS - 1).
+ */
+void TRACE_TaskBegin( uint8 id );
+
+
+
+/*
+ * @brief Starts the time of an interrupt (call it from the interrupt).
+ *
+ * @param id: Id of the interrupt (from 0 to TRACE_ISRS - 1).
+ */
+void TRACE_IsrBegin( uint8 id );
+
+
+
+/*
+ * @brief Ends the time of the interrupt started by TRACE_IsrBegin (call it before the interrupt returns).
+ */
+void TRACE_IsrEnd( void );
+
+
+
+/*
+ * @brief Sets the longest times to 0 and empties the ring.
+ */
+void TRACE_Clear( void );
+
+
+
+/*
+ * @brief Sends the longest times and the ring as text.
+ *
+ * Sends "max task <id> <us> ...\r\n" and "max isr <id> <us> ...\r\n" for the
+ * ids that ran, then one line per event of the ring, from the oldest:
+ * "<task|isr> <id> <us>us at <ms>ms\r\n" (the time wraps around after about
+ * 22 minutes). The ring is not changed while it is sent.
+ *
+ * @param write_byte: Function that sends one byte (for example UART_WriteByte).
+ */
+void TRACE_Report( void (*write_byte)(uint8) );
+
+
+#endif /* TRACE_H_ */
@@ -0,0 +1,81 @@
+/****************************************************************************
+ * @file    TRACE_config.h
+ * @author  Boles Medhat
+ * @brief   Timing Trace Configuration Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @note
+ * - The time is read from the Timer1 counter (the servo timer), so Timer1
+ *   must run in TIMER1_FAST_PWM_OCR1A_MODE or TIMER1_NORMAL_MODE, and its
+ *   period is counted by the Timer1 overflow interrupt (TRACE_Init enables it).
+ * - With the servo settings (prescaler 8 at 8MHz) a tick is 1us, so the
+ *   longest stored duration is 65.5ms.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef TRACE_CONFIG_H_
+#define TRACE_CONFIG_H_
+
+#include "TRACE_def.h"
+#include "../../MCAL/TIMER1/TIMER1.h"
+
+
+/*Set the Trace Status
+ * choose between:
+ * 1. TRACE_DISABLE
+ * 2. TRACE_ENABLE
+ */
+#define TRACE_STATUS						TRACE_ENABLE
+
+
+/*Set the number of task ids and interrupt ids (the ids are from 0 to the number - 1)*/
+#define TRACE_TASKS							6
+#define TRACE_ISRS							5
+
+
+/*Set the number of events of the ring (a power of 2, every event is 5 bytes of RAM)*/
+#define TRACE_RING_SIZE						8
+
+
+/*Set the shortest task that is added to the ring (in Timer1 ticks)
+ * the main loop runs its tasks all the time, so only the slow ones are kept
+ * (the interrupts are always added)
+ */
+#define TRACE_TASK_MIN_TICKS				2000
+
+
+/*Set Automatically*/
+/*TRACE_PERIOD_TICKS = Timer1 ticks between two overflow interrupts*/
+#if   TIMER1_WAVEFORM_GENERATION_MODE == TIMER1_FAST_PWM_OCR1A_MODE
+	#define TRACE_PERIOD_TICKS				( TIMER1_OCR1A_PRELOAD + 1UL )
+#elif TIMER1_WAVEFORM_GENERATION_MODE == TIMER1_NORMAL_MODE
+	#define TRACE_PERIOD_TICKS				65536UL
+#else
+	#error "The trace needs Timer1 in TIMER1_FAST_PWM_OCR1A_MODE or TIMER1_NORMAL_MODE"
+#endif
+
+/*TRACE_TICKS_TO_US = Timer1 ticks to microseconds*/
+#define TRACE_TICKS_TO_US( ticks )			( ( (uint32)(ticks) * TIMER1_PRESCALER ) / ( F_CPU / 1000000UL ) )
+
+
+#if ( TRACE_STATUS != TRACE_DISABLE ) && ( TRACE_STATUS != TRACE_ENABLE )
+	#error "Wrong \"TRACE_STATUS\" configuration option"
+#endif
+
+#if ( TRACE_RING_SIZE < 2 ) || ( TRACE_RING_SIZE > 128 ) || ( TRACE_RING_SIZE & ( TRACE_RING_SIZE - 1 ) )
+	#error "TRACE_RING_SIZE must be a power of 2 from 2 to 128"
+#endif
+
+#if ( TRACE_TASKS < 1 ) || ( TRACE_TASKS >= TRACE_ISR_FLAG ) || ( TRACE_ISRS < 1 ) || ( TRACE_ISRS >= TRACE_ISR_FLAG )
+	#error "TRACE_TASKS and TRACE_ISRS must be from 1 to 127"
+#endif
+
+
+#endif /* TRACE_CONFIG_H_ */
@@ -0,0 +1,62 @@
+/****************************************************************************
+ * @file    TRACE_def.h
+ * @author  Boles Medhat
+ * @brief   Timing Trace Definitions Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the macro definitions, constants and types used by the
+ * timing trace (longest time of every task and interrupt, and a ring of the
+ * last timed events).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef TRACE_DEF_H_
+#define TRACE_DEF_H_
+
+#include "../../LIB/STD_TYPES.h"
+
+
+/*------------------------------------------   types    -----------------------------------------*/
+
+/*Timed event of the ring*/
+typedef struct
+{
+	uint8  id;			/*Task id, or interrupt id | TRACE_ISR_FLAG*/
+	uint16 frame;		/*Timer1 period at the end of the event (wraps around)*/
+	uint16 ticks;		/*Duration in Timer1 ticks (TRACE_MAX_TICKS or more is TRACE_MAX_TICKS)*/
+}TraceEvent;
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   modes    -----------------------------------------*/
+
+/*Trace Status*/
+#define TRACE_DISABLE						0			/*The TRACE_ macros do nothing (no RAM and no cycles)*/
+#define TRACE_ENABLE						1			/*The TRACE_ macros time the tasks and interrupts*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Set in the id of the interrupt events of the ring*/
+#define TRACE_ISR_FLAG						0x80
+
+/*Id of no task or interrupt (before the first one, or out of the interrupts)*/
+#define TRACE_NONE							0
+
+/*Longest duration that can be stored (a longer one is stored as this value)*/
+#define TRACE_MAX_TICKS						0xFFFF
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* TRACE_DEF_H_ */
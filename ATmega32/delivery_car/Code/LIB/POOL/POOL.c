@@ -0,0 +1,178 @@
+/****************************************************************************
+ * @file    POOL.c
+ * @author  Boles Medhat
+ * @brief   Fixed-Size Block Memory Pool Source File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file implements the block pool with a free list: every block has a
+ * link byte with the number of the next free block, so allocating takes the
+ * first free block and freeing puts the block first, without any search.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include "POOL.h"
+
+
+/* Blocks */
+static uint8 g_POOL_Blocks[ POOL_BLOCKS ][ POOL_BLOCK_SIZE ];
+
+/* Link of every block (next free block, or POOL_IN_USE) */
+static uint8 g_POOL_Links[ POOL_BLOCKS ];
+
+/* First free block */
+static volatile uint8 g_POOL_FreeHead = POOL_NO_BLOCK;
+
+/* Number of free blocks, and its smallest value */
+static volatile uint8 g_POOL_FreeCount = 0;
+static volatile uint8 g_POOL_MinFreeCount = 0;
+
+
+
+
+
+/*
+ * @brief Makes all the blocks free.
+ *
+ * Call it before the first POOL_Alloc (no block may be in use).
+ */
+void POOL_Init( void )
+{
+	/* Link every block to the next one */
+	for ( uint8 i = 0 ; i < POOL_BLOCKS - 1 ; i++ )
+	{
+		g_POOL_Links[ i ] = i + 1;
+	}
+
+	g_POOL_Links[ POOL_BLOCKS - 1 ] = POOL_NO_BLOCK;
+
+	g_POOL_FreeHead = 0;
+	g_POOL_FreeCount = POOL_BLOCKS;
+	g_POOL_MinFreeCount = POOL_BLOCKS;
+}
+
+
+
+
+
+/*
+ * @brief Takes a free block.
+ *
+ * @return (uint8 *) Pointer to the block (POOL_BLOCK_SIZE bytes), or NULL if all the blocks are used.
+ */
+uint8 * POOL_Alloc( void )
+{
+	uint8 * block = NULL;
+
+	/* Save global interrupt flag and disable it */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	uint8 number = g_POOL_FreeHead;
+
+	if ( number != POOL_NO_BLOCK )
+	{
+		/* Remove the first block from the free list */
+		g_POOL_FreeHead = g_POOL_Links[ number ];
+		g_POOL_Links[ number ] = POOL_IN_USE;
+
+		g_POOL_FreeCount--;
+
+		if ( g_POOL_FreeCount < g_POOL_MinFreeCount )
+		{
+			g_POOL_MinFreeCount = g_POOL_FreeCount;
+		}
+
+		block = g_POOL_Blocks[ number ];
+	}
+
+	/* Restore global interrupt flag */
+	SREG = sreg;
+
+	return block;
+}
+
+
+
+
+
+/*
+ * @brief Returns a block to the pool.
+ *
+ * @param block: Pointer returned by POOL_Alloc.
+ *
+ * @return (bool) true if the block is freed, false if the pointer is not an allocated block.
+ */
+bool POOL_Free( uint8 * block )
+{
+	/* Check that the pointer is the start of a block */
+	if ( ( block < g_POOL_Blocks[0] ) || ( block > g_POOL_Blocks[ POOL_BLOCKS - 1 ] ) )
+	{
+		return false;
+	}
+
+	uint16 offset = (uint16)( block - g_POOL_Blocks[0] );
+
+	if ( ( offset % POOL_BLOCK_SIZE ) != 0 )
+	{
+		return false;
+	}
+
+	uint8 number = (uint8)( offset / POOL_BLOCK_SIZE );
+	bool freed = false;
+
+	/* Save global interrupt flag and disable it */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	/* A free block is not freed again */
+	if ( g_POOL_Links[ number ] == POOL_IN_USE )
+	{
+		/* Put the block first in the free list */
+		g_POOL_Links[ number ] = g_POOL_FreeHead;
+		g_POOL_FreeHead = number;
+
+		g_POOL_FreeCount++;
+		freed = true;
+	}
+
+	/* Restore global interrupt flag */
+	SREG = sreg;
+
+	return freed;
+}
+
+
+
+
+
+/*
+ * @brief Gets the number of free blocks.
+ *
+ * @return (uint8) The number of free blocks.
+ */
+uint8 POOL_GetFreeCount( void )
+{
+	return g_POOL_FreeCount;
+}
+
+
+
+
+
+/*
+ * @brief Gets the smallest number of free blocks since POOL_Init.
+ *
+ * @return (uint8) The smallest number of free blocks (0 means POOL_BLOCKS may be too small).
+ */
+uint8 POOL_GetMinFreeCount( void )
+{
+	return g_POOL_MinFreeCount;
+}
@@ -0,0 +1,82 @@
+/****************************************************************************
+ * @file    POOL.h
+ * @author  Boles Medhat
+ * @brief   Fixed-Size Block Memory Pool Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file provides a pool of POOL_BLOCKS blocks of POOL_BLOCK_SIZE bytes
+ * for messages and frames. A producer (for example the UART RX ISR) fills a
+ * block and passes its pointer to a consumer (for example through a queue),
+ * the consumer frees the block when it is done, so the data is never copied
+ * and two messages never share one buffer.
+ *
+ * - POOL_Alloc and POOL_Free take a constant time (a free list of block numbers).
+ * - Both can be called from an ISR and from the main loop
+ *   (the free list is changed with the interrupts disabled).
+ * - POOL_Free checks the pointer and rejects a double free.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef POOL_H_
+#define POOL_H_
+
+#include "../BIT_MATH.h"
+#include "POOL_config.h"
+
+
+
+/*
+ * @brief Makes all the blocks free.
+ *
+ * Call it before the first POOL_Alloc (no block may be in use).
+ */
+void POOL_Init( void );
+
+
+
+/*
+ * @brief Takes a free block.
+ *
+ * @return (uint8 *) Pointer to the block (POOL_BLOCK_SIZE bytes), or NULL if all the blocks are used.
+ */
+uint8 * POOL_Alloc( void );
+
+
+
+/*
+ * @brief Returns a block to the pool.
+ *
+ * @param block: Pointer returned by POOL_Alloc.
+ *
+ * @return (bool) true if the block is freed, false if the pointer is not an allocated block.
+ */
+bool POOL_Free( uint8 * block );
+
+
+
+/*
+ * @brief Gets the number of free blocks.
+ *
+ * @return (uint8) The number of free blocks.
+ */
+uint8 POOL_GetFreeCount( void );
+
+
+
+/*
+ * @brief Gets the smallest number of free blocks since POOL_Init.
+ *
+ * @return (uint8) The smallest number of free blocks (0 means POOL_BLOCKS may be too small).
+ */
+uint8 POOL_GetMinFreeCount( void );
+
+
+#endif /* POOL_H_ */
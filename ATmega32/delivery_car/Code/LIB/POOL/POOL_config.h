@@ -0,0 +1,47 @@
+/****************************************************************************
+ * @file    POOL_config.h
+ * @author  Boles Medhat
+ * @brief   Memory Pool Configuration Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @note
+ * - The pool uses POOL_BLOCKS * ( POOL_BLOCK_SIZE + 1 ) bytes of RAM.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef POOL_CONFIG_H_
+#define POOL_CONFIG_H_
+
+#include "POOL_def.h"
+
+
+/*Set the size of a block (in bytes)
+ * the largest message or frame with its end character
+ */
+#define POOL_BLOCK_SIZE						34
+
+
+/*Set the number of blocks
+ * one block is filled by the producer while the others wait for the consumer
+ */
+#define POOL_BLOCKS							4
+
+
+
+#if ( POOL_BLOCK_SIZE == 0 ) || ( POOL_BLOCK_SIZE > 255 )
+	#error "POOL_BLOCK_SIZE must be from 1 to 255"
+#endif
+
+#if ( POOL_BLOCKS == 0 ) || ( POOL_BLOCKS >= POOL_IN_USE )
+	#error "POOL_BLOCKS must be from 1 to 253"
+#endif
+
+
+#endif /* POOL_CONFIG_H_ */
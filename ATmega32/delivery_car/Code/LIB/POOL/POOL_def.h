@@ -0,0 +1,44 @@
+/****************************************************************************
+ * @file    POOL_def.h
+ * @author  Boles Medhat
+ * @brief   Memory Pool Definitions Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the register and constant definitions used by the
+ * fixed-size block memory pool.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef POOL_DEF_H_
+#define POOL_DEF_H_
+
+#include "../STD_TYPES.h"
+
+
+/*------------------------------------------   registers    -------------------------------------*/
+
+#define SREG								*((volatile uint8 *)0x5F)	/*status register*/
+
+/*SREG Register*/
+#define	I									7	/*Global Interrupt Enable*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Free list links (the link of a block is the number of the next free block)*/
+#define POOL_NO_BLOCK						0xFF	/*End of the free list*/
+#define POOL_IN_USE							0xFE	/*Link of an allocated block (detects a double free)*/
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* POOL_DEF_H_ */
@@ -0,0 +1,252 @@
+/****************************************************************************
+ * @file    QUEUE.h
+ * @author  Boles Medhat
+ * @brief   Single-Producer Single-Consumer Queue Library Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file generates a ring buffer queue of any item type with one macro,
+ * so every module that needs a buffer (UART RX/TX, keypad events, commands,
+ * EEPROM writes, ...) uses the same tested code:
+ *
+ *     QUEUE_DEFINE( RX , uint8 , 32 )		// in a .c file (or a header of one module)
+ *     static RX_Queue rx_queue;			// zero initialized = empty, or RX_Init( &rx_queue )
+ *
+ *     ISR:       RX_Push( &rx_queue , UDR );
+ *     main loop: uint8 byte; while ( RX_Pop( &rx_queue , &byte ) ) { ... }
+ *
+ * Generated functions (NAME is the first macro parameter):
+ * - NAME_Init, NAME_Push, NAME_Pop, NAME_Peek
+ * - NAME_PushArray, NAME_PopArray (bulk copy with one index update)
+ * - NAME_Count, NAME_Free, NAME_IsEmpty, NAME_IsFull
+ * - NAME_HighWater, NAME_Dropped, NAME_ResetStats
+ *
+ * How it is lock-free:
+ * - The head index is written only by the producer and the tail index only
+ *   by the consumer, both are 8-bit, so every index write is one instruction
+ *   and is never seen half done by an interrupt.
+ * - The indexes are free running (0 to 255), the item position is
+ *   index & ( size - 1 ), and the number of items is head - tail (8-bit).
+ * - The producer writes the item before it moves the head, and the consumer
+ *   reads the item before it moves the tail (QUEUE_BARRIER).
+ *
+ * @note
+ * - The size must be a power of 2 from 2 to QUEUE_MAX_SIZE (checked when compiled).
+ * - One producer and one consumer only: for example the producer is an ISR
+ *   and the consumer is the main loop (or the other way around).
+ *   Two producers (two ISRs, or an ISR and the main loop) need the interrupts
+ *   disabled around the push.
+ * - The statistics are written by the producer: call NAME_ResetStats from the
+ *   producer side or with the interrupts disabled.
+ * - The functions are static inline, they cost no call when the queue is used
+ *   in one place.
+ * - Every store to the queue and every load of an item or of the index of the
+ *   other side goes through QUEUE_STORE and QUEUE_LOAD, so `Sim/QUEUE_TEST.c`
+ *   can check every order of the producer and consumer accesses on the host.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef QUEUE_H_
+#define QUEUE_H_
+
+#include "QUEUE_def.h"
+
+
+/*
+ * @brief Generates a queue type and its functions.
+ *
+ * @param NAME: Prefix of the type (NAME_Queue) and of the functions.
+ * @param TYPE: Type of the items (any type that can be copied with =).
+ * @param SIZE: Number of items, a power of 2 from 2 to QUEUE_MAX_SIZE.
+ */
+#define QUEUE_DEFINE( NAME , TYPE , SIZE )																\
+																										\
+typedef char NAME##_QueueSizeCheck[ QUEUE_SIZE_IS_VALID( SIZE ) ? 1 : -1 ];								\
+																										\
+typedef struct																							\
+{																										\
+	volatile uint8 head;			/* Next write position (written by the producer only) */			\
+	volatile uint8 tail;			/* Next read position (written by the consumer only) */			\
+	uint8 high_water;				/* Largest number of items seen (written by the producer) */		\
+	uint8 dropped;					/* Items not pushed because the queue was full (stops at 255) */	\
+	TYPE items[ SIZE ];																				\
+}NAME##_Queue;																							\
+																										\
+/* @brief Empties the queue and resets its statistics (no producer or consumer may run). */			\
+static inline void NAME##_Init( NAME##_Queue * queue )													\
+{																										\
+	queue->head = 0;																					\
+	queue->tail = 0;																					\
+	queue->high_water = 0;																				\
+	queue->dropped = 0;																					\
+}																										\
+																										\
+/* @brief Returns the number of items in the queue. */													\
+static inline uint8 NAME##_Count( const NAME##_Queue * queue )											\
+{																										\
+	return (uint8)( queue->head - queue->tail );														\
+}																										\
+																										\
+/* @brief Returns the number of free places in the queue. */											\
+static inline uint8 NAME##_Free( const NAME##_Queue * queue )											\
+{																										\
+	return (uint8)( (SIZE) - NAME##_Count( queue ) );													\
+}																										\
+																										\
+/* @brief Returns true if the queue has no items. */													\
+static inline bool NAME##_IsEmpty( const NAME##_Queue * queue )										\
+{																										\
+	return ( queue->head == queue->tail );																\
+}																										\
+																										\
+/* @brief Returns true if the queue has no free places. */												\
+static inline bool NAME##_IsFull( const NAME##_Queue * queue )											\
+{																										\
+	return ( NAME##_Count( queue ) == (SIZE) );														\
+}																										\
+																										\
+/* @brief Updates the high water mark after a push (producer side). */								\
+static inline void NAME##_UpdateHighWater( NAME##_Queue * queue , uint8 head )						\
+{																										\
+	uint8 count = (uint8)( head - QUEUE_LOAD( queue->tail ) );											\
+																										\
+	if ( count > queue->high_water )																	\
+	{																									\
+		QUEUE_STORE( queue->high_water , count );														\
+	}																									\
+}																										\
+																										\
+/* @brief Adds an item (producer side). @return (bool) false if the queue is full (item dropped). */	\
+static inline bool NAME##_Push( NAME##_Queue * queue , TYPE item )										\
+{																										\
+	uint8 head = queue->head;																			\
+																										\
+	if ( (uint8)( head - QUEUE_LOAD( queue->tail ) ) == (SIZE) )										\
+	{																									\
+		if ( queue->dropped != 0xFF )																	\
+		{																								\
+			QUEUE_STORE( queue->dropped , queue->dropped + 1 );											\
+		}																								\
+		return false;																					\
+	}																									\
+																										\
+	QUEUE_STORE( queue->items[ head & ( (SIZE) - 1 ) ] , item );										\
+																										\
+	/* Publish the item */																				\
+	QUEUE_BARRIER();																					\
+	QUEUE_STORE( queue->head , ++head );																\
+																										\
+	NAME##_UpdateHighWater( queue , head );															\
+	return true;																						\
+}																										\
+																										\
+/* @brief Removes the oldest item (consumer side). @return (bool) false if the queue is empty. */		\
+static inline bool NAME##_Pop( NAME##_Queue * queue , TYPE * item )									\
+{																										\
+	uint8 tail = queue->tail;																			\
+																										\
+	if ( tail == QUEUE_LOAD( queue->head ) )															\
+	{																									\
+		return false;																					\
+	}																									\
+																										\
+	*item = QUEUE_LOAD( queue->items[ tail & ( (SIZE) - 1 ) ] );										\
+																										\
+	/* Free the place after the item is read */															\
+	QUEUE_BARRIER();																					\
+	QUEUE_STORE( queue->tail , tail + 1 );																\
+	return true;																						\
+}																										\
+																										\
+/* @brief Reads the oldest item without removing it (consumer side). @return (bool) false if empty. */	\
+static inline bool NAME##_Peek( const NAME##_Queue * queue , TYPE * item )								\
+{																										\
+	uint8 tail = queue->tail;																			\
+																										\
+	if ( tail == QUEUE_LOAD( queue->head ) )															\
+	{																									\
+		return false;																					\
+	}																									\
+																										\
+	*item = QUEUE_LOAD( queue->items[ tail & ( (SIZE) - 1 ) ] );										\
+	return true;																						\
+}																										\
+																										\
+/* @brief Adds up to count items (producer side). @return (uint8) The number of items added. */		\
+static inline uint8 NAME##_PushArray( NAME##_Queue * queue , TYPE const * items , uint8 count )		\
+{																										\
+	uint8 head = queue->head;																			\
+	uint8 space = (uint8)( (SIZE) - (uint8)( head - QUEUE_LOAD( queue->tail ) ) );						\
+																										\
+	if ( count > space )																					\
+	{																									\
+		uint8 lost = (uint8)( count - space );															\
+		uint8 room = (uint8)( 0xFF - queue->dropped );													\
+		QUEUE_STORE( queue->dropped , ( lost > room ) ? 0xFF : (uint8)( queue->dropped + lost ) );		\
+		count = space;																					\
+	}																									\
+																										\
+	for ( uint8 i = 0 ; i < count ; i++ )																\
+	{																									\
+		QUEUE_STORE( queue->items[ (uint8)( head + i ) & ( (SIZE) - 1 ) ] , items[ i ] );			\
+	}																									\
+																										\
+	/* Publish all the items with one index write */													\
+	QUEUE_BARRIER();																					\
+	head += count;																						\
+	QUEUE_STORE( queue->head , head );																	\
+																										\
+	NAME##_UpdateHighWater( queue , head );															\
+	return count;																						\
+}																										\
+																										\
+/* @brief Removes up to count items (consumer side). @return (uint8) The number of items removed. */	\
+static inline uint8 NAME##_PopArray( NAME##_Queue * queue , TYPE * items , uint8 count )				\
+{																										\
+	uint8 tail = queue->tail;																			\
+	uint8 available = (uint8)( QUEUE_LOAD( queue->head ) - tail );										\
+																										\
+	if ( count > available )																			\
+	{																									\
+		count = available;																				\
+	}																									\
+																										\
+	for ( uint8 i = 0 ; i < count ; i++ )																\
+	{																									\
+		items[ i ] = QUEUE_LOAD( queue->items[ (uint8)( tail + i ) & ( (SIZE) - 1 ) ] );			\
+	}																									\
+																										\
+	/* Free all the places with one index write */														\
+	QUEUE_BARRIER();																					\
+	QUEUE_STORE( queue->tail , tail + count );															\
+	return count;																						\
+}																										\
+																										\
+/* @brief Returns the largest number of items the queue had (size it with this value). */				\
+static inline uint8 NAME##_HighWater( const NAME##_Queue * queue )										\
+{																										\
+	return queue->high_water;																			\
+}																										\
+																										\
+/* @brief Returns the number of items dropped because the queue was full (stops at 255). */			\
+static inline uint8 NAME##_Dropped( const NAME##_Queue * queue )										\
+{																										\
+	return queue->dropped;																				\
+}																										\
+																										\
+/* @brief Resets the statistics (producer side or with the interrupts disabled). */					\
+static inline void NAME##_ResetStats( NAME##_Queue * queue )											\
+{																										\
+	queue->high_water = NAME##_Count( queue );															\
+	queue->dropped = 0;																					\
+}
+
+
+#endif /* QUEUE_H_ */
@@ -0,0 +1,58 @@
+/****************************************************************************
+ * @file    QUEUE_def.h
+ * @author  Boles Medhat
+ * @brief   Queue Definitions Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the limits and the compiler barrier used by the
+ * single-producer single-consumer queue macros.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef QUEUE_DEF_H_
+#define QUEUE_DEF_H_
+
+#include "../STD_TYPES.h"
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Largest queue size (the indexes are free running 8-bit counters, so a full queue must fit in 8 bits)*/
+#define QUEUE_MAX_SIZE					128
+
+/*Checks that a size is a power of 2 from 2 to QUEUE_MAX_SIZE*/
+#define QUEUE_SIZE_IS_VALID( size )		( ( (size) >= 2 ) && ( (size) <= QUEUE_MAX_SIZE ) && ( ( (size) & ( (size) - 1 ) ) == 0 ) )
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   macros    ----------------------------------------*/
+
+/*Compiler barrier: the items are written (or read) before the index that publishes them,
+ * the AVR executes the instructions in order, so only the compiler must not move them
+ */
+#define QUEUE_BARRIER()					__asm__ __volatile__ ( "" ::: "memory" )
+
+/*Store to the queue (an index, an item or a statistic) and load of an item or of the index
+ * of the other side, a host test can define them before QUEUE.h to stop one side before
+ * every access and run the other side (Sim/QUEUE_TEST.c)
+ */
+#ifndef QUEUE_STORE
+#define QUEUE_STORE( place , value )	( (place) = (value) )
+#endif
+
+#ifndef QUEUE_LOAD
+#define QUEUE_LOAD( place )				( place )
+#endif
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* QUEUE_DEF_H_ */
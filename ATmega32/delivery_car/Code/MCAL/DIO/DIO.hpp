@@ -0,0 +1,140 @@
+/****************************************************************************
+ * @file    DIO.hpp
+ * @author  Boles Medhat
+ * @brief   DIO Compile-Time Pin Templates Header File (C++) - AVR ATmega32
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This optional C++ header gives the DIO pins as types:
+ *
+ *     typedef io::Pin< io::PortB , DIO_PIN1 > Led;
+ *     Led::SetOutput();
+ *     Led::High();
+ *
+ * The port and the pin are template parameters, so every call is inlined to
+ * one register bit instruction (SBI/CBI/SBIC) instead of a DIO_SetPinValue
+ * call that selects the port and shifts the mask at run time.
+ *
+ * The templates use the same ids as the C driver (DIO_PORTx, DIO_PINx), so a
+ * pin can be built from the existing `_config.h` files and passed to the C
+ * drivers:
+ *
+ *     typedef io::Pin< io::Port< RIGHT_MOTOR_PORT > , RIGHT_MOTOR_F_PIN > RightF;
+ *     DIO_SetPinValue( RightF::port , RightF::pin , HIGH );
+ *
+ * @note
+ * - Needs a C++ compiler (avr-g++ with -std=gnu++11 or newer) and an
+ *   optimization level (-Os or -O2), the C project does not use this file.
+ * - The C headers are included inside `extern "C"`, so a C++ file can call
+ *   the C drivers directly.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ******************************************************************************/
+
+#ifndef DIO_HPP_
+#define DIO_HPP_
+
+extern "C"
+{
+	#include "DIO.h"
+}
+
+
+namespace io
+{
+
+/*
+ * @brief DIO port, selected by the DIO port id (DIO_PORTA to DIO_PORTD).
+ *
+ * Direction() / Output() / Input() return the DDRx / PORTx / PINx register.
+ */
+template< uint8 ID > struct Port;
+
+template<> struct Port< DIO_PORTA >
+{
+	static const uint8 id = DIO_PORTA;
+	static volatile uint8 & Direction( void )	{ return DDRA;  }
+	static volatile uint8 & Output( void )		{ return PORTA; }
+	static volatile uint8 & Input( void )		{ return PINA;  }
+};
+
+template<> struct Port< DIO_PORTB >
+{
+	static const uint8 id = DIO_PORTB;
+	static volatile uint8 & Direction( void )	{ return DDRB;  }
+	static volatile uint8 & Output( void )		{ return PORTB; }
+	static volatile uint8 & Input( void )		{ return PINB;  }
+};
+
+template<> struct Port< DIO_PORTC >
+{
+	static const uint8 id = DIO_PORTC;
+	static volatile uint8 & Direction( void )	{ return DDRC;  }
+	static volatile uint8 & Output( void )		{ return PORTC; }
+	static volatile uint8 & Input( void )		{ return PINC;  }
+};
+
+template<> struct Port< DIO_PORTD >
+{
+	static const uint8 id = DIO_PORTD;
+	static volatile uint8 & Direction( void )	{ return DDRD;  }
+	static volatile uint8 & Output( void )		{ return PORTD; }
+	static volatile uint8 & Input( void )		{ return PIND;  }
+};
+
+typedef Port< DIO_PORTA > PortA;
+typedef Port< DIO_PORTB > PortB;
+typedef Port< DIO_PORTC > PortC;
+typedef Port< DIO_PORTD > PortD;
+
+
+
+
+/*
+ * @brief DIO pin, selected by its port type and pin number (DIO_PIN0 to DIO_PIN7).
+ *
+ * All the functions are static and inline, a pin type has no object and no RAM.
+ */
+template< class PORT , uint8 PIN >
+struct Pin
+{
+	static_assert( PIN < 8 , "The pin number must be from DIO_PIN0 to DIO_PIN7" );
+
+	static const uint8 port = PORT::id;		/*DIO port id, for the C DIO functions*/
+	static const uint8 pin  = PIN;			/*DIO pin id,  for the C DIO functions*/
+
+	/* Sets the pin direction as output */
+	static void SetOutput( void )			{ SET_BIT( PORT::Direction() , PIN ); }
+
+	/* Sets the pin direction as input (without pull-up) */
+	static void SetInput( void )			{ CLR_BIT( PORT::Direction() , PIN ); CLR_BIT( PORT::Output() , PIN ); }
+
+	/* Sets the pin direction as input with the internal pull-up */
+	static void SetInputPullup( void )		{ CLR_BIT( PORT::Direction() , PIN ); SET_BIT( PORT::Output() , PIN ); }
+
+	/* Sets the pin output High */
+	static void High( void )				{ SET_BIT( PORT::Output() , PIN ); }
+
+	/* Sets the pin output Low */
+	static void Low( void )					{ CLR_BIT( PORT::Output() , PIN ); }
+
+	/* Toggles the pin output (read-modify-write, the ATmega32 can not toggle by writing PINx) */
+	static void Toggle( void )				{ TOG_BIT( PORT::Output() , PIN ); }
+
+	/* Sets the pin output to a value (LOW or any other value for HIGH) */
+	static void Set( uint8 value )			{ if ( value ) { High(); } else { Low(); } }
+
+	/* Returns the pin input value (LOW or HIGH) */
+	static uint8 Get( void )				{ return GET_BIT( PORT::Input() , PIN ); }
+};
+
+}
+
+
+#endif /* DIO_HPP_ */
@@ -127,19 +127,19 @@ uint8 EEPROM_ReadByte( uint16 address )
  *
  * @param address:    Start EEPROM address to write to.
  * @param data_array: Pointer to the array of bytes to write.
- * @param array_size:  Number of bytes to write.
+ * @param array_size:  Number of bytes to write (up to EEPROM_SIZE).
  */
-void EEPROM_WriteArray( uint16 address , const uint8 * data_array , uint8 array_size )
+void EEPROM_WriteArray( uint16 address , const uint8 * data_array , uint16 array_size )
 {
 	/* Check that the address of the array and the EEPROM address valid */
-	if ( ( data_array == NULL ) || ( address + array_size > EEPROM_SIZE ) )
+	if ( ( data_array == NULL ) || ( address > EEPROM_SIZE ) || ( array_size > EEPROM_SIZE - address ) )
 	{
 		/* Stop if not valid */
 		return;
 	}
 
 	/* Loops through each byte in the data array and writes it to EEPROM. */
-	for (uint8 byte = 0 ; byte < array_size ; byte++ )
+	for (uint16 byte = 0 ; byte < array_size ; byte++ )
 	{
 		EEPROM_WriteByte( (address + byte) , data_array[byte] );
 	}
@@ -154,24 +154,35 @@ void EEPROM_WriteArray( uint16 address , const uint8 * data_array , uint8 array_
  *
  * This function reads `array_size` number of bytes from EEPROM starting at
  * the specified address and stores them in the provided array.
+ * It waits for the previous write operation only once, then reads all bytes.
  *
  * @param address:    Start EEPROM address to read from.
  * @param data_array: Pointer to the array to store read data.
- * @param array_size:  Number of bytes to read.
+ * @param array_size:  Number of bytes to read (up to EEPROM_SIZE).
  */
-void EEPROM_ReadArray( uint16 address , uint8 * data_array , uint8 array_size )
+void EEPROM_ReadArray( uint16 address , uint8 * data_array , uint16 array_size )
 {
 	/* Check that the address of the array and the EEPROM address valid */
-	if ( ( data_array == NULL ) || ( address + array_size > EEPROM_SIZE ) )
+	if ( ( data_array == NULL ) || ( address > EEPROM_SIZE ) || ( array_size > EEPROM_SIZE - address ) )
 	{
 		/* Stop if not valid */
 		return;
 	}
 
+	/* Wait for completion of previous write (once for the whole array) */
+	while (IS_BIT_SET( EECR , EEWE ));
+
 	/* Loops through each byte in the data array and read it from EEPROM. */
-	for (uint8 byte = 0 ; byte < array_size ; byte++ )
+	for (uint16 byte = 0 ; byte < array_size ; byte++ )
 	{
-		data_array[byte] = EEPROM_ReadByte( (address + byte) );
+		/* Set up address register */
+		EEAR = address + byte;
+
+		/* Start EEPROM read from EERE */
+		EECR |= (1<<EERE);
+
+		/* Read data from data register */
+		data_array[byte] = EEDR;
 	}
 }
 
@@ -318,6 +329,25 @@ float32 EEPROM_ReadFloat32( uint16 address )
 
 
 
+/*
+ * @brief Checks if the EEPROM is ready for a new write.
+ *
+ * Used to write to the EEPROM in the background without waiting
+ * for the previous write operation (about 8.5ms per byte).
+ *
+ * @return (bool) true if no write operation is in progress, false otherwise.
+ */
+bool EEPROM_IsReady( void )
+{
+
+	/* EEWE is cleared by hardware when the write operation is completed */
+	return ( IS_BIT_SET( EECR , EEWE ) == 0 );
+}
+
+
+
+
+
 /*
  * @brief Enable the EEPROM interrupt.
  *
@@ -18,6 +18,7 @@
  * - Write/Read an array of bytes.
  * - Write/Read 16-bit and 32-bit integers.
  * - Write/Read 32-bit floating-point values.
+ * - Check if the EEPROM is ready for a new write (non-blocking writes).
  * - EEPROM interrupt enable/disable.
  * - User-defined interrupt callback handler.
  *
@@ -69,9 +70,9 @@ uint8 EEPROM_ReadByte( uint16 address );
  *
  * @param address:    Start EEPROM address to write to.
  * @param data_array: Pointer to the array of bytes to write.
- * @param array_size:  Number of bytes to write.
+ * @param array_size:  Number of bytes to write (up to EEPROM_SIZE).
  */
-void EEPROM_WriteArray( uint16 address , const uint8 * data_array , uint8 array_size );
+void EEPROM_WriteArray( uint16 address , const uint8 * data_array , uint16 array_size );
 
 
 /*
@@ -79,12 +80,13 @@ void EEPROM_WriteArray( uint16 address , const uint8 * data_array , uint8 array_
  *
  * This function reads `array_size` number of bytes from EEPROM starting at
  * the specified address and stores them in the provided array.
+ * It waits for the previous write operation only once, then reads all bytes.
  *
  * @param address:    Start EEPROM address to read from.
  * @param data_array: Pointer to the array to store read data.
- * @param array_size:  Number of bytes to read.
+ * @param array_size:  Number of bytes to read (up to EEPROM_SIZE).
  */
-void EEPROM_ReadArray( uint16 address , uint8 * data_array , uint8 array_size );
+void EEPROM_ReadArray( uint16 address , uint8 * data_array , uint16 array_size );
 
 
 /*
@@ -169,6 +171,17 @@ void EEPROM_WriteFloat32( uint16 address , float32 data );
 float32 EEPROM_ReadFloat32( uint16 address );
 
 
+/*
+ * @brief Checks if the EEPROM is ready for a new write.
+ *
+ * Used to write to the EEPROM in the background without waiting
+ * for the previous write operation (about 8.5ms per byte).
+ *
+ * @return (bool) true if no write operation is in progress, false otherwise.
+ */
+bool EEPROM_IsReady( void );
+
+
 /*
  * @brief Enable the EEPROM interrupt.
  *
@@ -424,15 +424,30 @@ void TIMER1_SetTimerValue( uint16 TimerValue )
 
 
 /*
- * @brief Get the current TIMER0 counter value.
+ * @brief Get the current TIMER1 counter value.
  *
- * This function get TCNT0 value that determines the current count of TIMER0.
+ * This function get TCNT1 value that determines the current count of TIMER1.
+ * The read is done with interrupts disabled, because an ISR that accesses any
+ * 16-bit TIMER1 register between the low and high byte reads overwrites the
+ * shared TEMP register and corrupts the result.
  *
- * @return (uint16) Current value of TCNT0 register.
+ * @return (uint16) Current value of TCNT1 register.
  */
 uint16 TIMER1_GetTimerValue( void )
 {
-	return TCNT1;
+	/* Save global interrupt flag */
+	uint8 sreg = SREG;
+
+	/* Disable global interrupt */
+	CLR_BIT( SREG , I );
+
+	/* Read the 16-bit Counter */
+	uint16 value = TCNT1;
+
+	/* Restore global interrupt flag */
+	SREG = sreg;
+
+	return value;
 }
 
 
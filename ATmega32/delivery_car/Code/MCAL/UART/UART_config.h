@@ -96,7 +96,7 @@
  * 1. UART_DISABLE
  * 2. UART_ENABLE							<--the most used
  */
-#define UART_TRANSMITTER_ENABLE				UART_DISABLE
+#define UART_TRANSMITTER_ENABLE				UART_ENABLE
 
 
 /*Set Double the UART Transmission Speed effect with ASYNCHRONOUS mode only
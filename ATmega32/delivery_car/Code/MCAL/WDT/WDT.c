@@ -104,3 +104,36 @@ void WDT_RESET_MCU()
 
 
 
+/*
+ * @brief Gets the reset flags of the last reset.
+ *
+ * The flags are kept by the hardware until they are cleared, so more than one
+ * flag may be set (for example a brown-out reset after a power-on reset).
+ *
+ * @return (uint8) Reset flags, test them with GET_BIT and [ PORF , EXTRF , BORF , WDRF ].
+ */
+uint8 WDT_GetResetFlags( void )
+{
+
+	/* Return the reset flags bits only */
+	return ( MCUCSR & WDT_RESET_FLAGS_msk );
+}
+
+
+
+
+
+/*
+ * @brief Clears the reset flags, so the next reset can be told from the old ones.
+ */
+void WDT_ClearResetFlags( void )
+{
+
+	/* The flags are cleared by writing zero to them */
+	MCUCSR &= ~WDT_RESET_FLAGS_msk;
+}
+
+
+
+
+
@@ -68,4 +68,21 @@ void WDT_Disable();
 void WDT_RESET_MCU();
 
 
+/*
+ * @brief Gets the reset flags of the last reset.
+ *
+ * The flags are kept by the hardware until they are cleared, so more than one
+ * flag may be set (for example a brown-out reset after a power-on reset).
+ *
+ * @return (uint8) Reset flags, test them with GET_BIT and [ PORF , EXTRF , BORF , WDRF ].
+ */
+uint8 WDT_GetResetFlags( void );
+
+
+/*
+ * @brief Clears the reset flags, so the next reset can be told from the old ones.
+ */
+void WDT_ClearResetFlags( void );
+
+
 #endif /* WDT_H_ */
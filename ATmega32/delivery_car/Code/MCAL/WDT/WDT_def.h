@@ -31,6 +31,9 @@
 
 /*Watchdog Control Register*/
 #define WDTCR								*((volatile uint8 *)0x41)	/*Watchdog Timer Control Register*/
+
+/*MCU Control and Status Register (reset flags)*/
+#define MCUCSR								*((volatile uint8 *)0x54)	/*MCU Control and Status Register*/
 /*_______________________________________________________________________________________________*/
 
 
@@ -44,6 +47,12 @@
 #define WDE									3	/*Watchdog Enable*/
 #define WDTOE								4	/*Watchdog Turn-off Enable*/
 
+/*MCUCSR Register*/
+#define PORF								0	/*Power-on Reset Flag*/
+#define EXTRF								1	/*External Reset Flag*/
+#define BORF								2	/*Brown-out Reset Flag*/
+#define WDRF								3	/*Watchdog Reset Flag*/
+
 /*_______________________________________________________________________________________________*/
 
 
@@ -67,6 +76,7 @@
 
 #define WDT_TIME_OUT_clr_msk				0xF8	/*WDT PRESCALER Clear mask*/
 #define WDT_Disable_msk						0x18	/*WDT Disable bits mask*/
+#define WDT_RESET_FLAGS_msk					0x0F	/*Reset flags (PORF, EXTRF, BORF, WDRF) mask of MCUCSR*/
 /*_______________________________________________________________________________________________*/
 
 
@@ -0,0 +1,173 @@
+/****************************************************************************
+ * @file    PLANT.c
+ * @author  Boles Medhat
+ * @brief   Delivery Car Simulated Vehicle Source File (host)
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file implements the simulated vehicle (motors, kinematics and
+ * ultrasonic sensors) of the host simulation.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include <math.h>
+#include <stddef.h>
+
+#include "PLANT.h"
+
+
+
+
+
+/*
+ * @brief Get the target speed of one wheel.
+ *
+ * @param wheel: Motor direction.
+ * @param duty:  OC2 compare value (fast PWM, duty = duty / 255).
+ *
+ * @return (double) Target speed (cm/s).
+ */
+static double PLANT_Target( PlantWheel wheel , unsigned char duty )
+{
+	double speed = PLANT_MAX_SPEED * duty / 255.0;
+
+	switch ( wheel )
+	{
+		case PLANT_WHEEL_FORWARD:	return speed;
+		case PLANT_WHEEL_BACKWARD:	return -speed;
+		default:					return 0.0;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Initialize the car at the origin, stopped, facing +x.
+ *
+ * @param plant:      Pointer to the car.
+ * @param walls:      Wall segments of the world (can be NULL).
+ * @param wall_count: Number of wall segments.
+ */
+void PLANT_Init( Plant * plant , const PlantWall * walls , int wall_count )
+{
+	plant->x = 0.0;
+	plant->y = 0.0;
+	plant->heading = 0.0;
+	plant->right_speed = 0.0;
+	plant->left_speed = 0.0;
+	plant->right = PLANT_WHEEL_STOP;
+	plant->left = PLANT_WHEEL_STOP;
+	plant->duty = 0;
+	plant->odometer = 0.0;
+	plant->walls = walls;
+	plant->wall_count = ( walls != NULL ) ? wall_count : 0;
+}
+
+
+
+
+
+/*
+ * @brief Move the car by one time step.
+ *
+ * @param plant: Pointer to the car.
+ * @param dt:    Time step (s).
+ */
+void PLANT_Step( Plant * plant , double dt )
+{
+	/* First order lag of every wheel toward its target speed */
+	double k = dt / ( PLANT_TIME_CONSTANT + dt );
+
+	plant->right_speed += k * ( PLANT_Target( plant->right , plant->duty ) - plant->right_speed );
+	plant->left_speed  += k * ( PLANT_Target( plant->left  , plant->duty ) - plant->left_speed );
+
+	/* Differential drive (a right turn spins the car clockwise) */
+	double speed = ( plant->right_speed + plant->left_speed ) / 2.0;
+	double turn  = ( plant->right_speed - plant->left_speed ) / PLANT_TRACK_WIDTH;
+
+	plant->heading += turn * dt;
+	plant->x += speed * cos( plant->heading ) * dt;
+	plant->y += speed * sin( plant->heading ) * dt;
+	plant->odometer += fabs( speed ) * dt;
+}
+
+
+
+
+
+/*
+ * @brief Get the distance seen by one sensor (what USONIC_Read returns).
+ *
+ * @param plant:  Pointer to the car.
+ * @param sensor: PLANT_FRONT or PLANT_BACK.
+ *
+ * @return (double) Distance to the nearest wall along the car axis (cm), PLANT_SONAR_RANGE if none.
+ */
+double PLANT_Distance( const Plant * plant , int sensor )
+{
+	double dx = cos( plant->heading );
+	double dy = sin( plant->heading );
+
+	if ( sensor == PLANT_BACK )
+	{
+		dx = -dx;
+		dy = -dy;
+	}
+
+	/* Sensor position */
+	double sx = plant->x + dx * PLANT_SENSOR_OFFSET;
+	double sy = plant->y + dy * PLANT_SENSOR_OFFSET;
+
+	double nearest = PLANT_SONAR_RANGE;
+
+	/* Intersect the ray with every wall segment */
+	for ( int i = 0 ; i < plant->wall_count ; i++ )
+	{
+		const PlantWall * wall = &plant->walls[ i ];
+		double ex = wall->x2 - wall->x1;
+		double ey = wall->y2 - wall->y1;
+		double denominator = dx * ey - dy * ex;
+
+		if ( fabs( denominator ) < 1e-9 )
+		{
+			continue;
+		}
+
+		double wx = wall->x1 - sx;
+		double wy = wall->y1 - sy;
+		double t = ( wx * ey - wy * ex ) / denominator;		/* Distance along the ray */
+		double u = ( wx * dy - wy * dx ) / denominator;		/* Position along the wall (0 to 1) */
+
+		if ( ( t >= 0.0 ) && ( u >= 0.0 ) && ( u <= 1.0 ) && ( t < nearest ) )
+		{
+			nearest = t;
+		}
+	}
+
+	return nearest;
+}
+
+
+
+
+
+/*
+ * @brief Get the time that one sensor reading takes (trigger and echo).
+ *
+ * @param distance: Measured distance (cm).
+ *
+ * @return (double) Reading time (s).
+ */
+double PLANT_SonarTime( double distance )
+{
+	return ( PLANT_SONAR_TRIGGER_US + distance * PLANT_SONAR_US_PER_CM ) * 1e-6;
+}
@@ -0,0 +1,128 @@
+/****************************************************************************
+ * @file    PLANT.h
+ * @author  Boles Medhat
+ * @brief   Delivery Car Simulated Vehicle Header File (host)
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file declares the simulated vehicle used by the host simulation:
+ * - Two DC motors driven by the H-bridge direction pins and the OC2 duty,
+ *   every wheel follows its target speed with a first order lag.
+ * - Differential drive kinematics in a 2D world (x, y in cm, heading in rad).
+ * - Two HC-SR04 sensors (front and back) that measure the distance to the
+ *   nearest wall segment along the car axis, and the echo time of a reading.
+ *
+ * @note
+ * - Host code only (compiled with the Linux gcc, not with avr-gcc).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef PLANT_H_
+#define PLANT_H_
+
+
+/*------------------------------------------   types    -----------------------------------------*/
+
+/*Direction of one motor (state of its two H-bridge pins)*/
+typedef enum
+{
+	PLANT_WHEEL_STOP,
+	PLANT_WHEEL_FORWARD,
+	PLANT_WHEEL_BACKWARD
+}PlantWheel;
+
+/*Wall segment of the world (cm)*/
+typedef struct
+{
+	double x1 , y1;
+	double x2 , y2;
+}PlantWall;
+
+/*Simulated vehicle*/
+typedef struct
+{
+	double x , y;						/*Position of the car center (cm)*/
+	double heading;						/*Heading (rad, 0 is the +x axis)*/
+	double right_speed;					/*Speed of the right wheels (cm/s)*/
+	double left_speed;					/*Speed of the left wheels (cm/s)*/
+	PlantWheel right , left;			/*Motor directions*/
+	unsigned char duty;					/*OC2 compare value (speed of both motors)*/
+	double odometer;					/*Distance driven by the car center (cm)*/
+	const PlantWall * walls;			/*World*/
+	int wall_count;
+}Plant;
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Vehicle model*/
+#define PLANT_MAX_SPEED				60.0	/*Wheel speed at 100% duty (cm/s)*/
+#define PLANT_TIME_CONSTANT			0.12	/*Motor and car inertia time constant (s)*/
+#define PLANT_TRACK_WIDTH			14.0	/*Distance between the right and the left wheels (cm)*/
+#define PLANT_SENSOR_OFFSET			10.0	/*Distance from the car center to each sensor (cm)*/
+
+/*HC-SR04 model*/
+#define PLANT_SONAR_RANGE			400.0	/*Largest measured distance (cm), also returned when nothing is found*/
+#define PLANT_SONAR_US_PER_CM		58.0	/*Echo time per cm of distance (us)*/
+#define PLANT_SONAR_TRIGGER_US		500.0	/*Trigger pulse and burst time before the echo (us)*/
+
+/*Sensor ids*/
+#define PLANT_FRONT					0
+#define PLANT_BACK					1
+/*_______________________________________________________________________________________________*/
+
+
+
+/*---------------------------- Function Prototypes --------------------------*/
+
+
+/*
+ * @brief Initialize the car at the origin, stopped, facing +x.
+ *
+ * @param plant:      Pointer to the car.
+ * @param walls:      Wall segments of the world (can be NULL).
+ * @param wall_count: Number of wall segments.
+ */
+void PLANT_Init( Plant * plant , const PlantWall * walls , int wall_count );
+
+
+/*
+ * @brief Move the car by one time step.
+ *
+ * @param plant: Pointer to the car.
+ * @param dt:    Time step (s).
+ */
+void PLANT_Step( Plant * plant , double dt );
+
+
+/*
+ * @brief Get the distance seen by one sensor (what USONIC_Read returns).
+ *
+ * @param plant:  Pointer to the car.
+ * @param sensor: PLANT_FRONT or PLANT_BACK.
+ *
+ * @return (double) Distance to the nearest wall along the car axis (cm), PLANT_SONAR_RANGE if none.
+ */
+double PLANT_Distance( const Plant * plant , int sensor );
+
+
+/*
+ * @brief Get the time that one sensor reading takes (trigger and echo).
+ *
+ * @param distance: Measured distance (cm).
+ *
+ * @return (double) Reading time (s).
+ */
+double PLANT_SonarTime( double distance );
+
+
+#endif /* PLANT_H_ */
@@ -0,0 +1,510 @@
+/****************************************************************************
+ * @file    QUEUE_TEST.c
+ * @author  Boles Medhat
+ * @brief   Queue Library Host Test Source File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file checks the single-producer single-consumer queue of
+ * `Code/LIB/QUEUE/QUEUE.h` on Linux for every order of the producer and the
+ * consumer accesses:
+ * - QUEUE_STORE and QUEUE_LOAD are defined to stop the running side before
+ *   every index, item and statistic store and every load of an item or of
+ *   the index of the other side, so Push, Pop, Peek, PushArray and PopArray
+ *   are split at every access the other side can see or change.
+ * - The producer and the consumer run a script of queue calls as two
+ *   coroutines, and every interleaving of their accesses is run (a depth
+ *   first search over the choice of the side that runs at every stop).
+ * - After every interleaving the consumer items and the rest of the queue
+ *   must be the pushed items in order (FIFO, no lost, repeated or wrong
+ *   items), the count must never be more than the size, the dropped count
+ *   must be the number of rejected items, and the high water mark must be
+ *   between the count when the producer ends and the largest real count.
+ *
+ * @note
+ * - Build and run (from the delivery_car folder):
+ *       gcc -std=gnu99 -O2 -Wall -o queue_test Sim/QUEUE_TEST.c
+ *       ./queue_test
+ *   The exit code is 1 if an interleaving fails (its choices are printed).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+
+#include "../Code/LIB/STD_TYPES.h"
+
+static void Test_Stop( const volatile void * place );
+
+/* Stop the running side before every shared access to the queue */
+#define QUEUE_STORE( place , value )	( Test_Stop( &(place) ) , (place) = (value) )
+#define QUEUE_LOAD( place )				( Test_Stop( &(place) ) , (place) )
+
+#include "../Code/LIB/QUEUE/QUEUE.h"
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+#define TEST_SIZE					4			/*Queue size*/
+#define TEST_MAX_ITEMS				16			/*Items of one script*/
+#define TEST_MAX_CHOICES			256			/*Stops of one interleaving*/
+#define TEST_STACK_SIZE				65536		/*Stack of one side*/
+#define TEST_POISON					0xEE		/*Item places before the first push (not a pushed value)*/
+
+#define TEST_PRODUCER				0
+#define TEST_CONSUMER				1
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   types    -----------------------------------------*/
+
+QUEUE_DEFINE( TEST , uint8 , TEST_SIZE )
+
+/*Queue call of a script*/
+typedef enum
+{
+	TEST_END,
+	TEST_PUSH,						/*Producer: Push one item*/
+	TEST_PUSH_ARRAY,				/*Producer: PushArray of count items*/
+	TEST_POP,						/*Consumer: Pop one item*/
+	TEST_POP_ARRAY,					/*Consumer: PopArray of up to count items*/
+	TEST_PEEK						/*Consumer: Peek (the next Pop must give the same item)*/
+}TestCall;
+
+typedef struct
+{
+	TestCall call;
+	uint8 count;
+}TestStep;
+
+/*Scenario*/
+typedef struct
+{
+	const char * name;
+	uint8 start_index;							/*Head and tail at the start (to cross the 8-bit wrap)*/
+	TestStep producer[ TEST_MAX_ITEMS ];
+	TestStep consumer[ TEST_MAX_ITEMS ];
+}TestScenario;
+/*_______________________________________________________________________________________________*/
+
+
+
+/*-------------------------------------------   state   -----------------------------------------*/
+
+static const TestScenario * scenario;
+static TEST_Queue queue;
+
+/* Coroutines */
+static ucontext_t scheduler_context;
+static ucontext_t side_context[ 2 ];
+static char side_stack[ 2 ][ TEST_STACK_SIZE ];
+static bool side_done[ 2 ];
+static int running_side;			/* Side that runs, -1 in the scheduler */
+
+/* Choices of the current interleaving (0: the side that ran last goes on, 1: the other side) */
+static uint8 choices[ TEST_MAX_CHOICES ];
+static int choice_count;			/* Choices of the current interleaving */
+static int choice_fixed;			/* Choices taken from the last interleaving */
+
+/* Producer results */
+static uint8 pushed[ TEST_MAX_ITEMS ];
+static int pushed_count;
+static int rejected_count;
+static uint8 count_at_producer_end;
+
+/* Consumer results */
+static uint8 popped[ TEST_MAX_ITEMS ];
+static int popped_count;
+static bool peek_failed;
+
+/* Largest real count */
+static uint8 real_max;
+static bool over_size;
+/*_______________________________________________________________________________________________*/
+
+
+
+
+
+/*
+ * @brief Check the real count of the queue (called at every stop).
+ */
+static void Test_Sample( void )
+{
+	uint8 count = (uint8)( queue.head - queue.tail );
+
+	if ( count > TEST_SIZE )
+	{
+		over_size = true;
+	}
+
+	if ( count > real_max )
+	{
+		real_max = count;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Stop the running side before an access and go back to the scheduler.
+ *
+ * The statistics are written and read by the producer only, the other side
+ * cannot see their order, so the producer does not stop before them.
+ *
+ * @param place: Address of the accessed place.
+ */
+static void Test_Stop( const volatile void * place )
+{
+	Test_Sample();
+
+	if ( ( running_side >= 0 ) && ( place != &queue.high_water ) && ( place != &queue.dropped ) )
+	{
+		int side = running_side;
+
+		running_side = -1;
+		swapcontext( &side_context[ side ] , &scheduler_context );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Run the producer script.
+ */
+static void Test_Producer( void )
+{
+	uint8 next = 1;
+
+	for ( const TestStep * step = scenario->producer ; step->call != TEST_END ; step++ )
+	{
+		if ( step->call == TEST_PUSH )
+		{
+			if ( TEST_Push( &queue , next ) )
+			{
+				pushed[ pushed_count++ ] = next;
+			}
+			else
+			{
+				rejected_count++;
+			}
+			next++;
+		}
+		else
+		{
+			uint8 items[ TEST_MAX_ITEMS ];
+
+			for ( uint8 i = 0 ; i < step->count ; i++ )
+			{
+				items[ i ] = next + i;
+			}
+
+			uint8 added = TEST_PushArray( &queue , items , step->count );
+
+			memcpy( &pushed[ pushed_count ] , items , added );
+			pushed_count += added;
+			rejected_count += step->count - added;
+			next += step->count;
+		}
+	}
+
+	Test_Sample();
+	count_at_producer_end = TEST_Count( &queue );
+	side_done[ TEST_PRODUCER ] = true;
+}
+
+
+
+
+
+/*
+ * @brief Run the consumer script.
+ */
+static void Test_Consumer( void )
+{
+	for ( const TestStep * step = scenario->consumer ; step->call != TEST_END ; step++ )
+	{
+		uint8 item;
+
+		switch ( step->call )
+		{
+			case TEST_POP:
+
+				if ( TEST_Pop( &queue , &item ) )
+				{
+					popped[ popped_count++ ] = item;
+				}
+				break;
+
+			case TEST_POP_ARRAY:
+
+				popped_count += TEST_PopArray( &queue , &popped[ popped_count ] , step->count );
+				break;
+
+			default:
+
+				/* The item read by Peek is the one Pop removes */
+				if ( TEST_Peek( &queue , &item ) )
+				{
+					uint8 removed;
+
+					if ( !TEST_Pop( &queue , &removed ) || ( removed != item ) )
+					{
+						peek_failed = true;
+					}
+					popped[ popped_count++ ] = item;
+				}
+				break;
+		}
+	}
+
+	Test_Sample();
+	side_done[ TEST_CONSUMER ] = true;
+}
+
+
+
+
+
+/*
+ * @brief Choose the side that runs next.
+ *
+ * @param last: Side that ran last.
+ *
+ * @return (int) The side.
+ */
+static int Test_Choose( int last )
+{
+	int other = !last;
+
+	if ( side_done[ last ] )
+	{
+		return other;
+	}
+
+	if ( side_done[ other ] )
+	{
+		return last;
+	}
+
+	if ( choice_count >= TEST_MAX_CHOICES )
+	{
+		fprintf( stderr , "queue_test: more than %d stops in one interleaving\n" , TEST_MAX_CHOICES );
+		exit( 2 );
+	}
+
+	if ( choice_count >= choice_fixed )
+	{
+		choices[ choice_count ] = 0;
+	}
+
+	return choices[ choice_count++ ] ? other : last;
+}
+
+
+
+
+
+/*
+ * @brief Run one interleaving (the choices from choice_fixed on are 0).
+ *
+ * @return (bool) true if all the checks pass.
+ */
+static bool Test_Run( void )
+{
+	/* Items that were never pushed are found by the FIFO check */
+	memset( &queue , TEST_POISON , sizeof( queue ) );
+	TEST_Init( &queue );
+	queue.head = scenario->start_index;
+	queue.tail = scenario->start_index;
+
+	pushed_count = 0;
+	rejected_count = 0;
+	popped_count = 0;
+	peek_failed = false;
+	real_max = 0;
+	over_size = false;
+	choice_count = 0;
+
+	void (*side_function[ 2 ])( void ) = { Test_Producer , Test_Consumer };
+
+	for ( int side = 0 ; side < 2 ; side++ )
+	{
+		getcontext( &side_context[ side ] );
+		side_context[ side ].uc_stack.ss_sp = side_stack[ side ];
+		side_context[ side ].uc_stack.ss_size = TEST_STACK_SIZE;
+		side_context[ side ].uc_link = &scheduler_context;
+		makecontext( &side_context[ side ] , side_function[ side ] , 0 );
+		side_done[ side ] = false;
+	}
+
+	/* The producer starts, the first choice can give the start to the consumer */
+	int side = TEST_PRODUCER;
+
+	while ( !side_done[ TEST_PRODUCER ] || !side_done[ TEST_CONSUMER ] )
+	{
+		side = Test_Choose( side );
+		running_side = side;
+		swapcontext( &scheduler_context , &side_context[ side ] );
+		running_side = -1;
+	}
+
+	/* The rest of the queue */
+	uint8 rest = TEST_PopArray( &queue , &popped[ popped_count ] , TEST_MAX_ITEMS );
+	int total = popped_count + rest;
+
+	bool fifo = ( total == pushed_count ) && ( memcmp( popped , pushed , pushed_count ) == 0 );
+	bool dropped = ( TEST_Dropped( &queue ) == rejected_count );
+	bool high_water = ( TEST_HighWater( &queue ) >= count_at_producer_end ) && ( TEST_HighWater( &queue ) <= real_max );
+
+	if ( fifo && dropped && high_water && !over_size && !peek_failed )
+	{
+		return true;
+	}
+
+	printf( "%s: FAILED%s%s%s%s%s\n  choices:" , scenario->name ,
+			fifo ? "" : " fifo" , dropped ? "" : " dropped" , high_water ? "" : " high_water" ,
+			over_size ? " count>size" : "" , peek_failed ? " peek" : "" );
+
+	for ( int i = 0 ; i < choice_count ; i++ )
+	{
+		printf( " %u" , choices[ i ] );
+	}
+
+	printf( "\n  pushed:" );
+
+	for ( int i = 0 ; i < pushed_count ; i++ )
+	{
+		printf( " %u" , pushed[ i ] );
+	}
+
+	printf( "\n  popped:" );
+
+	for ( int i = 0 ; i < total ; i++ )
+	{
+		printf( " %u" , popped[ i ] );
+	}
+
+	printf( "\n  dropped %u (rejected %d), high water %u (end %u, real %u)\n" , TEST_Dropped( &queue ) , rejected_count ,
+			TEST_HighWater( &queue ) , count_at_producer_end , real_max );
+
+	return false;
+}
+
+
+
+
+
+/*
+ * @brief Run every interleaving of a scenario.
+ *
+ * @return (bool) true if all the interleavings pass.
+ */
+static bool Test_Scenario( const TestScenario * test )
+{
+	unsigned long runs = 0;
+	int stops_max = 0;
+
+	scenario = test;
+	choice_fixed = 0;
+
+	while ( 1 )
+	{
+		runs++;
+
+		if ( !Test_Run() )
+		{
+			return false;
+		}
+
+		if ( choice_count > stops_max )
+		{
+			stops_max = choice_count;
+		}
+
+		/* Next interleaving: change the last 0 choice to 1 and drop the choices after it */
+		choice_fixed = choice_count;
+
+		while ( ( choice_fixed > 0 ) && ( choices[ choice_fixed - 1 ] == 1 ) )
+		{
+			choice_fixed--;
+		}
+
+		if ( choice_fixed == 0 )
+		{
+			break;
+		}
+
+		choices[ choice_fixed - 1 ] = 1;
+	}
+
+	printf( "%-20s %9lu interleavings, up to %d choices: ok\n" , test->name , runs , stops_max );
+
+	return true;
+}
+
+
+
+
+
+/*-------------------------------------------   scenarios   -------------------------------------*/
+
+#define PUSH					{ TEST_PUSH , 1 }
+#define PUSH_ARRAY( count )		{ TEST_PUSH_ARRAY , count }
+#define POP						{ TEST_POP , 1 }
+#define POP_ARRAY( count )		{ TEST_POP_ARRAY , count }
+#define PEEK					{ TEST_PEEK , 1 }
+
+static const TestScenario scenarios[] =
+{
+	/* Single items */
+	{ "push_pop" , 0 ,
+	  { PUSH , PUSH , PUSH } ,
+	  { POP , PEEK } },
+
+	/* Arrays over the end of the buffer */
+	{ "arrays" , 2 ,
+	  { PUSH_ARRAY( 3 ) , PUSH } ,
+	  { POP_ARRAY( 2 ) , POP } },
+
+	/* Mixed calls across the 8-bit index wrap */
+	{ "index_wrap" , 254 ,
+	  { PUSH , PUSH_ARRAY( 2 ) } ,
+	  { POP_ARRAY( 3 ) , POP } },
+
+	/* A full queue drops single items and a part of an array */
+	{ "full_drop" , 126 ,
+	  { PUSH_ARRAY( 4 ) , PUSH , PUSH_ARRAY( 2 ) } ,
+	  { POP , POP } },
+};
+/*_______________________________________________________________________________________________*/
+
+
+
+
+
+int main( void )
+{
+	bool passed = true;
+
+	for ( unsigned int i = 0 ; i < sizeof( scenarios ) / sizeof( scenarios[0] ) ; i++ )
+	{
+		passed = Test_Scenario( &scenarios[ i ] ) && passed;
+	}
+
+	return passed ? 0 : 1;
+}
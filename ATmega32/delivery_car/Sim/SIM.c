@@ -0,0 +1,220 @@
+/****************************************************************************
+ * @file    SIM.c
+ * @author  Boles Medhat
+ * @brief   Delivery Car Host Simulation Source File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file runs the delivery car logic (`Code/APP/CAR.c`, the same file
+ * that is built for the car) on the simulated hardware of `SIM_PORT.c` on
+ * Linux and reports, for every scenario:
+ * - Command latency: from the start of the UART byte to 90% of the wheel
+ *   speed change (average and worst).
+ * - Obstacle stops: detection delay (from the real distance falling below
+ *   OBSTACLE_DISTANCE to the stop), stopping distance and final gap.
+ * - Path replay error: distance and heading between the start pose and the
+ *   pose where the reverse playback ends.
+ * - Keypad and LCD: the time the box is opened, the password saved in the
+ *   EEPROM and the final LCD text.
+ *
+ * @note
+ * - The keypad driver does not wait for the key release, so the key that
+ *   starts a password entry is also its first character: the scenarios press
+ *   only the password keys.
+ * - Build and run (from the delivery_car folder):
+ *       gcc -std=gnu99 -O2 -Wall -o drive_sim Sim/SIM.c Sim/SIM_PORT.c Sim/PLANT.c Code/APP/CAR.c Code/APP/DRIVE.c -lm
+ *       ./drive_sim
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include <stdio.h>
+
+#include "../Code/APP/APP_def.h"
+#include "SIM_PORT.h"
+
+
+/*-------------------------------------------   scenarios   -------------------------------------*/
+
+#define SIM_NO_WALL					{ { 0 , 0 , 0 , 0 } } , 0
+#define SIM_WALL( x1 , y1 , x2 , y2 )	{ { x1 , y1 , x2 , y2 } } , 1
+
+static const SimScenario scenarios[] =
+{
+	/* Drive straight, then replay without a stop */
+	{ "straight_replay" ,
+	  { { 0 , "6" } , { 100 , "6" } , { 200 , "1" } , { 2200 , ";" } } , { { 0 } } ,
+	  0 , 0 , 0 , "1234" , SIM_NO_WALL },
+
+	/* The same path with a STOP before the REVERSE command */
+	{ "stop_then_replay" ,
+	  { { 0 , "6" } , { 100 , "6" } , { 200 , "1" } , { 2200 , "3" } , { 3000 , ";" } } , { { 0 } } ,
+	  0 , 0 , 0 , "1234" , SIM_NO_WALL },
+
+	/* Turns and gear changes, then replay */
+	{ "turns_replay" ,
+	  { { 0 , "6" } , { 100 , "1" } , { 1500 , "4" } , { 1900 , "1" } , { 2600 , "6" } ,
+		{ 3600 , "5" } , { 4300 , "2" } , { 5000 , "7" } , { 5600 , "1" } , { 6400 , ";" } } , { { 0 } } ,
+	  0 , 0 , 0 , "1234" , SIM_NO_WALL },
+
+	/* Full speed toward a wall 150 cm ahead */
+	{ "obstacle_stop" ,
+	  { { 0 , "6" } , { 100 , "6" } , { 200 , "6" } , { 300 , "6" } , { 400 , "1" } } , { { 0 } } ,
+	  0 , 0 , 6000 , "1234" , SIM_WALL( 150 , -100 , 150 , 100 ) },
+
+	/* The same with the app heartbeat (NOTHING every second) */
+	{ "obstacle_heartbeat" ,
+	  { { 0 , "6" } , { 100 , "6" } , { 200 , "6" } , { 300 , "6" } , { 400 , "1" } } , { { 0 } } ,
+	  1000 , 6000 , 6000 , "1234" , SIM_WALL( 150 , -100 , 150 , 100 ) },
+
+	/* Backing toward a wall 80 cm behind at gear 3 */
+	{ "obstacle_backward" ,
+	  { { 0 , "6" } , { 100 , "6" } , { 200 , "2" } } , { { 0 } } ,
+	  0 , 0 , 6000 , "1234" , SIM_WALL( -80 , -100 , -80 , 100 ) },
+
+	/* The phone link is lost while driving, the car replays the path home */
+	{ "connection_loss" ,
+	  { { 0 , "6" } , { 100 , "1" } , { 2000 , "5" } , { 2500 , "1" } } , { { 0 } } ,
+	  1000 , 4000 , 0 , "1234" , SIM_NO_WALL },
+
+	/* An LCD message, then a clear and a second message */
+	{ "lcd_message" ,
+	  { { 0 , "9Hello car:" } , { 1000 , "8" } , { 1100 , "9On the way:" } } , { { 0 } } ,
+	  1000 , 3000 , 3000 , "1234" , SIM_NO_WALL },
+
+	/* The right password opens the box */
+	{ "box_open" ,
+	  { { 0 } } , { { 500 , "1234" } } ,
+	  1000 , 6000 , 6000 , "1234" , SIM_NO_WALL },
+
+	/* A wrong password does not open it */
+	{ "box_wrong_pass" ,
+	  { { 0 } } , { { 500 , "1111" } } ,
+	  1000 , 6000 , 6000 , "1234" , SIM_NO_WALL },
+
+	/* No password in the EEPROM: it is set at start, then it opens the box */
+	{ "first_boot_pass" ,
+	  { { 0 } } , { { 0 , "4321" } , { 6000 , "4321" } } ,
+	  1000 , 11000 , 11000 , NULL , SIM_NO_WALL },
+
+	/* The password is changed with '*' */
+	{ "change_pass" ,
+	  { { 0 } } , { { 500 , "*" } , { 1700 , "1234" } , { 6000 , "9876" } } ,
+	  1000 , 11000 , 11000 , "1234" , SIM_NO_WALL },
+
+	/* The password is entered while the car drives toward a wall 150 cm ahead */
+	{ "pass_while_driving" ,
+	  { { 0 , "6" } , { 100 , "6" } , { 200 , "6" } , { 300 , "6" } , { 400 , "1" } } , { { 1000 , "1234" } } ,
+	  1000 , 6000 , 6000 , "1234" , SIM_WALL( 150 , -100 , 150 , 100 ) },
+
+	/* The UART shell is started while driving and left with "exit", then the car drives again
+	   (from a terminal: the app heartbeat would be read as a part of the shell line) */
+	{ "shell_exit" ,
+	  { { 0 , "6" } , { 100 , "1" } , { 1000 , "$" } , { 1500 , "exit\r" } , { 2000 , "2" } , { 3000 , "3" } } , { { 0 } } ,
+	  0 , 0 , 4000 , "1234" , SIM_NO_WALL },
+};
+/*_______________________________________________________________________________________________*/
+
+
+
+
+
+/*
+ * @brief Print the motion results of one scenario.
+ */
+static void Sim_PrintMotion( const SimScenario * scenario , const SimResult * result )
+{
+	printf( "%-22s" , scenario->name );
+
+	if ( result->latency_count > 0 )
+	{
+		printf( " %7.1f %7.1f" , 1000.0 * result->latency_avg , 1000.0 * result->latency_max );
+	}
+	else
+	{
+		printf( " %7s %7s" , "-" , "-" );
+	}
+
+	if ( result->stop_count > 0 )
+	{
+		printf( " %5d %8.1f %7.1f %7.1f" , result->stop_count , 1000.0 * result->detect_avg , result->stop_distance_avg , result->gap_min );
+	}
+	else
+	{
+		printf( " %5d %8s %7s %7s" , 0 , "-" , "-" , "-" );
+	}
+
+	if ( result->crashed )
+	{
+		printf( " %10s %10s   (hit the wall at %.1f s)\n" , "-" , "-" , result->crash_time );
+	}
+	else if ( result->restarted )
+	{
+		printf( " %10.1f %10.1f\n" , result->replay_error , result->replay_heading );
+	}
+	else
+	{
+		printf( " %10s %10s   (x %.1f cm, y %.1f cm, driven %.1f cm)\n" , "-" , "-" , result->car.x , result->car.y , result->car.odometer );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Print the keypad and LCD results of one scenario.
+ */
+static void Sim_PrintPanel( const SimScenario * scenario , const SimResult * result )
+{
+	printf( "%-22s" , scenario->name );
+
+	if ( result->box_time >= 0.0 )
+	{
+		printf( " %7.2f" , result->box_time );
+	}
+	else
+	{
+		printf( " %7s" , "-" );
+	}
+
+	printf( "  %-6s |%s|%s|\n" , result->password , result->lcd[0] , result->lcd[1] );
+}
+
+
+
+
+
+int main( void )
+{
+	static SimResult results[ sizeof( scenarios ) / sizeof( scenarios[0] ) ];
+	unsigned int count = sizeof( scenarios ) / sizeof( scenarios[0] );
+
+	for ( unsigned int i = 0 ; i < count ; i++ )
+	{
+		SIM_Run( &scenarios[ i ] , &results[ i ] );
+	}
+
+	printf( "%-22s %7s %7s %5s %8s %7s %7s %10s %10s\n" ,
+			"scenario" , "lat_ms" , "lat_max" , "stops" , "detect_ms" , "stop_cm" , "gap_cm" , "replay_cm" , "replay_deg" );
+
+	for ( unsigned int i = 0 ; i < count ; i++ )
+	{
+		Sim_PrintMotion( &scenarios[ i ] , &results[ i ] );
+	}
+
+	printf( "\n%-22s %7s  %-6s %s\n" , "scenario" , "box_s" , "pass" , "lcd" );
+
+	for ( unsigned int i = 0 ; i < count ; i++ )
+	{
+		Sim_PrintPanel( &scenarios[ i ] , &results[ i ] );
+	}
+
+	return 0;
+}
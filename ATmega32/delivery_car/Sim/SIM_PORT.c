@@ -0,0 +1,835 @@
+/****************************************************************************
+ * @file    SIM_PORT.c
+ * @author  Boles Medhat
+ * @brief   Delivery Car Host Simulation Port Source File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file implements the CAR_PORT_ functions of `Code/APP/CAR.h` on the
+ * simulated hardware, runs the CAR.c main loop for one scenario and measures
+ * the results. The memory pool is also implemented here, because `POOL.c`
+ * uses the SREG register.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include <math.h>
+#include <setjmp.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "../Code/APP/CAR.h"
+#include "../Code/LIB/POOL/POOL.h"
+#include "SIM_PORT.h"
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Timing of the firmware (F_CPU = 8MHz, Timer0 prescaler 256, UART 9600 baud)*/
+#define SIM_TICK_S					( 256.0 / 8000000.0 )	/*Time of one Timer0 tick (s)*/
+#define SIM_UART_BYTE_S				( 10.0 / 9600.0 )		/*Time of one UART frame (s)*/
+#define SIM_CONNECTION_OVFS			611						/*TIMER0_Calc_ISR_Timing_ms( 5000 ) overflows*/
+#define SIM_CONNECTION_TCNT			166						/*TIMER0_Calc_ISR_Timing_ms( 5000 ) preload*/
+
+/*Time taken by the other work of the car (s)*/
+#define SIM_MAIN_LOOP_S				0.0002		/*EEPROM_MIRROR_Task and SHELL_Task*/
+#define SIM_KEYPAD_SCAN_S			0.00002		/*KEYPAD_GetPressedKey*/
+#define SIM_LCD_CLEAR_S				0.002		/*LCD_ClearScreen*/
+#define SIM_LCD_WRITE_S				0.00005		/*LCD_PrintCharacter and LCD_SetCursor*/
+#define SIM_EEPROM_WRITE_S			0.0085		/*One EEPROM byte*/
+
+/*Keypad peer*/
+#define SIM_KEY_PERIOD_MS			700			/*Time between two key presses*/
+#define SIM_KEY_HOLD_MS				150			/*Time a key is held*/
+
+/*Scenario limits*/
+#define SIM_MAX_TIME_S				60.0		/*A scenario ends after this time if the car does not restart*/
+#define SIM_SETTLE_S				1.0			/*Time the car is left to stop after the restart before the replay error is measured*/
+
+#define SIM_EEPROM_SIZE				1024
+#define SIM_SHELL_LINE_SIZE			16
+/*_______________________________________________________________________________________________*/
+
+
+
+/*---------------------------------------   simulation   ----------------------------------------*/
+
+static const SimScenario * scenario;
+static SimResult * result;
+
+/* Leaves the main loop at the end of the scenario or at the restart */
+static jmp_buf sim_exit;
+
+static unsigned long sim_ticks;			/* Timer0 ticks since the start */
+static double sim_pending;				/* Time taken by the car that is less than one tick */
+static double sim_end;					/* End of the scenario (s) */
+static bool sim_in_isr;					/* A CAR.c callback is called as an interrupt */
+
+static Plant car;
+/*_______________________________________________________________________________________________*/
+
+
+
+/*--------------------------------------   peripherals   ----------------------------------------*/
+
+/* Timer0 */
+static uint8 sim_tcnt0;
+static uint16 sim_overflows;
+static bool sim_timer_enabled;
+static void (*sim_timer_callback)(void);
+
+/* UART receiver (UART_Set_RX_Callback) */
+static void (*sim_rx_callback)(void);
+static uint8 * sim_rx_buffer;
+static uint8 sim_rx_size;
+static uint8 sim_rx_index;
+static bool sim_rx_enabled;
+
+/* UART peer (the phone app) */
+static int sim_send;
+static int sim_send_byte;
+static double sim_next_heartbeat;
+
+/* UART shell (it exits on "exit") */
+static bool sim_shell_active;
+static bool sim_shell_exit;
+static char sim_shell_line[ SIM_SHELL_LINE_SIZE ];
+static uint8 sim_shell_length;
+
+/* LCD */
+static char sim_lcd[ 2 ][ 16 ];
+static uint8 sim_lcd_row;
+static uint8 sim_lcd_col;
+
+/* EEPROM */
+static uint8 sim_eeprom[ SIM_EEPROM_SIZE ];
+
+/* Memory pool */
+static uint8 sim_pool[ POOL_BLOCKS ][ POOL_BLOCK_SIZE ];
+static bool sim_pool_used[ POOL_BLOCKS ];
+/*_______________________________________________________________________________________________*/
+
+
+
+/*--------------------------------------   measurements   ---------------------------------------*/
+
+/* Command latency */
+static bool   latency_pending;
+static double latency_start;
+static double latency_from_r , latency_from_l;
+static double latency_sum;
+
+/* Obstacle stops */
+static double crossing_time;			/* Time the real distance fell below OBSTACLE_DISTANCE (< 0: not below) */
+static bool   stop_pending;				/* A stop is measured until the car stands still */
+static int    stop_side;
+static double stop_time , stop_odometer;
+static double detect_sum , stop_distance_sum;
+/*_______________________________________________________________________________________________*/
+
+
+
+
+
+/*
+ * @brief Get the simulation time.
+ *
+ * @return (double) Time since the start of the scenario (s).
+ */
+static double Sim_Time( void )
+{
+	return sim_ticks * SIM_TICK_S;
+}
+
+
+
+
+
+/*
+ * @brief Get the target speed of one wheel.
+ */
+static double Sim_Target( PlantWheel wheel )
+{
+	double speed = PLANT_MAX_SPEED * car.duty / 255.0;
+
+	return ( wheel == PLANT_WHEEL_STOP ) ? 0.0 : ( ( wheel == PLANT_WHEEL_FORWARD ) ? speed : -speed );
+}
+
+
+
+
+
+/*
+ * @brief Check if a wheel finished 90% of its speed change.
+ */
+static bool Sim_Settled( double from , double now , double target )
+{
+	return fabs( target - now ) <= 0.1 * fabs( target - from );
+}
+
+
+
+
+
+/*
+ * @brief Update the latency, stop and crash measurements after a time step.
+ *
+ * @param time: Simulation time (s).
+ */
+static void Sim_Measure( double time )
+{
+	/* Command latency */
+	if ( latency_pending )
+	{
+		double target_r = Sim_Target( car.right );
+		double target_l = Sim_Target( car.left );
+
+		if ( ( fabs( target_r - latency_from_r ) < 0.5 ) && ( fabs( target_l - latency_from_l ) < 0.5 ) )
+		{
+			/* The command does not change the speed (a gear change while stopped) */
+			latency_pending = false;
+		}
+		else if ( Sim_Settled( latency_from_r , car.right_speed , target_r ) && Sim_Settled( latency_from_l , car.left_speed , target_l ) )
+		{
+			double latency = time - latency_start;
+
+			latency_pending = false;
+			latency_sum += latency;
+			result->latency_count++;
+
+			if ( latency > result->latency_max )
+			{
+				result->latency_max = latency;
+			}
+		}
+	}
+
+	/* Real distance on the side the car moves to */
+	double speed = ( car.right_speed + car.left_speed ) / 2.0;
+	int side = ( speed >= 0.0 ) ? PLANT_FRONT : PLANT_BACK;
+	double distance = PLANT_Distance( &car , side );
+
+	if ( ( distance < OBSTACLE_DISTANCE ) && ( fabs( speed ) > 0.5 ) && ( crossing_time < 0.0 ) )
+	{
+		crossing_time = time;
+	}
+	else if ( distance >= OBSTACLE_DISTANCE )
+	{
+		crossing_time = -1.0;
+	}
+
+	if ( ( distance < 0.5 ) && ( fabs( speed ) > 0.5 ) && !result->crashed )
+	{
+		result->crashed = true;
+		result->crash_time = time;
+	}
+
+	/* The stop ends when the car stands still */
+	if ( stop_pending && ( fabs( car.right_speed ) < 0.5 ) && ( fabs( car.left_speed ) < 0.5 ) )
+	{
+		double gap = PLANT_Distance( &car , stop_side );
+
+		stop_pending = false;
+		result->stop_count++;
+		detect_sum += ( crossing_time >= 0.0 ) ? ( stop_time - crossing_time ) : 0.0;
+		stop_distance_sum += car.odometer - stop_odometer;
+
+		if ( gap < result->gap_min )
+		{
+			result->gap_min = gap;
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Call a CAR.c callback as an interrupt.
+ *
+ * @param callback: The callback (nothing is done if it is NULL).
+ */
+static void Sim_Interrupt( void (*callback)(void) )
+{
+	if ( callback != NULL )
+	{
+		sim_in_isr = true;
+		callback();
+		sim_in_isr = false;
+	}
+}
+
+
+
+
+
+/*
+ * @brief Receive one UART byte (the UART RX interrupt of the UART driver).
+ *
+ * @param byte:  The byte.
+ * @param start: Time the byte started to be sent (s).
+ */
+static void Sim_Receive( uint8 byte , double start )
+{
+	if ( !sim_rx_enabled )
+	{
+		return;
+	}
+
+	/* The shell takes the bytes until "exit" */
+	if ( sim_shell_active )
+	{
+		if ( byte == '\r' )
+		{
+			sim_shell_line[ sim_shell_length ] = '\0';
+			sim_shell_exit = ( strcmp( sim_shell_line , "exit" ) == 0 );
+			sim_shell_length = 0;
+		}
+		else if ( sim_shell_length < SIM_SHELL_LINE_SIZE - 1 )
+		{
+			sim_shell_line[ sim_shell_length++ ] = byte;
+		}
+		return;
+	}
+
+	if ( sim_rx_buffer == NULL )
+	{
+		return;
+	}
+
+	/* Measure the latency of the motion commands */
+	if ( ( sim_rx_callback == UART_Get_Cmd ) &&
+		 ( ( ( byte >= FORWARD ) && ( byte <= GEARDOWN ) ) ) )
+	{
+		latency_pending = true;
+		latency_start   = start;
+		latency_from_r  = car.right_speed;
+		latency_from_l  = car.left_speed;
+	}
+
+	sim_rx_buffer[ sim_rx_index ] = byte;
+	sim_rx_index++;
+
+	if ( ( sim_rx_index >= sim_rx_size ) || ( byte == UART_STOPCHAR ) )
+	{
+		if ( byte == UART_STOPCHAR )
+		{
+			sim_rx_buffer[ sim_rx_index ] = UART_STOPCHAR;
+		}
+
+		sim_rx_index = 0;
+		Sim_Interrupt( sim_rx_callback );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Send the scripted bytes and the heartbeat of the UART peer.
+ *
+ * @param time: Simulation time (s).
+ */
+static void Sim_Peer( double time )
+{
+	const SimSend * send = &scenario->sends[ sim_send ];
+
+	if ( ( sim_send < SIM_MAX_SENDS ) && ( send->bytes != NULL ) )
+	{
+		double start = send->time_ms / 1000.0 + sim_send_byte * SIM_UART_BYTE_S;
+
+		/* The byte is received at the end of its frame */
+		if ( time >= start + SIM_UART_BYTE_S )
+		{
+			Sim_Receive( send->bytes[ sim_send_byte ] , start );
+
+			sim_send_byte++;
+
+			if ( send->bytes[ sim_send_byte ] == '\0' )
+			{
+				sim_send++;
+				sim_send_byte = 0;
+			}
+			return;
+		}
+	}
+
+	if ( ( sim_next_heartbeat > 0.0 ) && ( time >= sim_next_heartbeat + SIM_UART_BYTE_S ) )
+	{
+		Sim_Receive( NOTHING , sim_next_heartbeat );
+
+		sim_next_heartbeat += scenario->heartbeat_ms / 1000.0;
+
+		if ( sim_next_heartbeat * 1000.0 >= scenario->heartbeat_end_ms )
+		{
+			sim_next_heartbeat = -1.0;
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Advance the simulation by one Timer0 tick.
+ */
+static void Sim_Tick( void )
+{
+	double time = Sim_Time();
+
+	if ( time >= sim_end )
+	{
+		longjmp( sim_exit , 1 );
+	}
+
+	Sim_Peer( time );
+
+	/* Timer0 (the overflow callback runs before the overflow count, as in the ISR) */
+	if ( sim_timer_enabled )
+	{
+		sim_tcnt0++;
+
+		if ( sim_tcnt0 == 0 )
+		{
+			Sim_Interrupt( sim_timer_callback );
+			sim_overflows++;
+		}
+	}
+
+	PLANT_Step( &car , SIM_TICK_S );
+	Sim_Measure( time );
+
+	sim_ticks++;
+
+	if ( result->crashed )
+	{
+		longjmp( sim_exit , 1 );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Let time pass while the car is busy in the main loop.
+ *
+ * @param seconds: Time taken by the car.
+ */
+static void Sim_Advance( double seconds )
+{
+	if ( sim_in_isr )
+	{
+		fprintf( stderr , "sim: a port function that waits is called from an interrupt\n" );
+		abort();
+	}
+
+	sim_pending += seconds;
+
+	while ( sim_pending >= SIM_TICK_S )
+	{
+		sim_pending -= SIM_TICK_S;
+		Sim_Tick();
+	}
+}
+
+
+
+
+
+/*------------------------------------------   pool    ------------------------------------------*/
+
+void POOL_Init( void )
+{
+	memset( sim_pool_used , 0 , sizeof( sim_pool_used ) );
+}
+
+uint8 * POOL_Alloc( void )
+{
+	for ( int block = 0 ; block < POOL_BLOCKS ; block++ )
+	{
+		if ( !sim_pool_used[ block ] )
+		{
+			sim_pool_used[ block ] = true;
+			return sim_pool[ block ];
+		}
+	}
+
+	return NULL;
+}
+
+bool POOL_Free( uint8 * block )
+{
+	for ( int number = 0 ; number < POOL_BLOCKS ; number++ )
+	{
+		if ( ( block == sim_pool[ number ] ) && sim_pool_used[ number ] )
+		{
+			sim_pool_used[ number ] = false;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+
+
+
+
+/*----------------------------------------   CAR_PORT    ----------------------------------------*/
+
+void CAR_PORT_SetMotors( uint8 move )
+{
+	switch ( move )
+	{
+		case FORWARD:		car.right = PLANT_WHEEL_FORWARD;	car.left = PLANT_WHEEL_FORWARD;		break;
+		case BACKWARD:		car.right = PLANT_WHEEL_BACKWARD;	car.left = PLANT_WHEEL_BACKWARD;	break;
+		case STEER_RIGHT:	car.right = PLANT_WHEEL_BACKWARD;	car.left = PLANT_WHEEL_FORWARD;		break;
+		case STEER_LEFT:	car.right = PLANT_WHEEL_FORWARD;	car.left = PLANT_WHEEL_BACKWARD;	break;
+		default:			car.right = PLANT_WHEEL_STOP;		car.left = PLANT_WHEEL_STOP;		break;
+	}
+
+	/* Only Obstacle_Detection stops the car from the main loop */
+	if ( ( move == STOP ) && !sim_in_isr && !stop_pending )
+	{
+		double speed = ( car.right_speed + car.left_speed ) / 2.0;
+
+		stop_pending  = true;
+		stop_side     = ( speed >= 0.0 ) ? PLANT_FRONT : PLANT_BACK;
+		stop_time     = Sim_Time();
+		stop_odometer = car.odometer;
+	}
+}
+
+void CAR_PORT_SetSpeed( uint8 duty )
+{
+	car.duty = duty;
+}
+
+void CAR_PORT_SetBuzzer( bool on )
+{
+	(void)on;
+}
+
+void CAR_PORT_OpenBox( void )
+{
+	if ( result->box_time < 0.0 )
+	{
+		result->box_time = Sim_Time();
+	}
+}
+
+uint16 CAR_PORT_ReadDistance( uint8 sensor )
+{
+	double distance = PLANT_Distance( &car , ( sensor == CAR_FRONT_SENSOR ) ? PLANT_FRONT : PLANT_BACK );
+
+	Sim_Advance( PLANT_SonarTime( distance ) );
+
+	return (uint16)distance;
+}
+
+uint16 CAR_PORT_GetTimerOverflows( void )
+{
+	return sim_overflows;
+}
+
+uint8 CAR_PORT_GetTimerValue( void )
+{
+	return sim_tcnt0;
+}
+
+void CAR_PORT_SetTimerValue( uint8 value )
+{
+	sim_tcnt0 = value;
+}
+
+void CAR_PORT_ResetTimer( void )
+{
+	sim_tcnt0 = 0;
+	sim_overflows = 0;
+}
+
+void CAR_PORT_EnableTimer( bool enable )
+{
+	sim_timer_enabled = enable;
+}
+
+void CAR_PORT_SetTimerCallback( void (*callback)(void) )
+{
+	sim_timer_callback = callback;
+}
+
+void CAR_PORT_SetReceiver( void (*callback)(void) , uint8 * buffer , uint8 size )
+{
+	sim_rx_callback = callback;
+	sim_rx_buffer = buffer;
+	sim_rx_size = size;
+	sim_rx_index = 0;
+}
+
+void CAR_PORT_DisableReceiver( void )
+{
+	sim_rx_enabled = false;
+}
+
+void CAR_PORT_StartShell( void )
+{
+	sim_shell_active = true;
+	sim_shell_length = 0;
+}
+
+uint8 CAR_PORT_GetKey( void )
+{
+	Sim_Advance( SIM_KEYPAD_SCAN_S );
+
+	double time_ms = Sim_Time() * 1000.0;
+
+	for ( int keys = 0 ; ( keys < SIM_MAX_KEYS ) && ( scenario->keys[ keys ].keys != NULL ) ; keys++ )
+	{
+		const SimKeys * press = &scenario->keys[ keys ];
+
+		for ( int key = 0 ; press->keys[ key ] != '\0' ; key++ )
+		{
+			double start = press->time_ms + key * SIM_KEY_PERIOD_MS;
+
+			if ( ( time_ms >= start ) && ( time_ms < start + SIM_KEY_HOLD_MS ) )
+			{
+				return press->keys[ key ];
+			}
+		}
+	}
+
+	return CAR_NO_KEY;
+}
+
+void CAR_PORT_ClearScreen( void )
+{
+	memset( sim_lcd , ' ' , sizeof( sim_lcd ) );
+	sim_lcd_row = 0;
+	sim_lcd_col = 0;
+
+	Sim_Advance( SIM_LCD_CLEAR_S );
+}
+
+void CAR_PORT_SetCursor( uint8 row , uint8 col )
+{
+	sim_lcd_row = row;
+	sim_lcd_col = col;
+
+	Sim_Advance( SIM_LCD_WRITE_S );
+}
+
+void CAR_PORT_PrintChar( uint8 character )
+{
+	if ( ( sim_lcd_row < 2 ) && ( sim_lcd_col < 16 ) )
+	{
+		sim_lcd[ sim_lcd_row ][ sim_lcd_col ] = character;
+	}
+	sim_lcd_col++;
+
+	Sim_Advance( SIM_LCD_WRITE_S );
+}
+
+void CAR_PORT_PrintString( const char * string )
+{
+	while ( *string != '\0' )
+	{
+		CAR_PORT_PrintChar( *string++ );
+	}
+}
+
+void CAR_PORT_DelayMs( uint16 ms )
+{
+	Sim_Advance( ms / 1000.0 );
+}
+
+void CAR_PORT_ReadStorage( uint16 address , uint8 * data , uint8 size )
+{
+	memcpy( data , &sim_eeprom[ address ] , size );
+}
+
+void CAR_PORT_WriteStorage( uint16 address , const uint8 * data , uint8 size )
+{
+	for ( uint8 byte = 0 ; byte < size ; byte++ )
+	{
+		if ( sim_eeprom[ address + byte ] != data[ byte ] )
+		{
+			sim_eeprom[ address + byte ] = data[ byte ];
+			Sim_Advance( SIM_EEPROM_WRITE_S );
+		}
+	}
+}
+
+void CAR_PORT_IsrBegin( uint8 id )
+{
+	(void)id;
+}
+
+void CAR_PORT_IsrEnd( void )
+{
+}
+
+void CAR_PORT_Tick( void )
+{
+}
+
+void CAR_PORT_Restart( void )
+{
+	/* The watchdog resets the car, the scenario ends */
+	result->restarted = true;
+	sim_in_isr = false;
+	longjmp( sim_exit , 1 );
+}
+
+
+
+
+
+/*
+ * @brief Initialize the simulated hardware and the measurements.
+ */
+static void Sim_Init( void )
+{
+	sim_ticks = 0;
+	sim_pending = 0.0;
+	sim_end = ( scenario->end_ms != 0 ) ? scenario->end_ms / 1000.0 : SIM_MAX_TIME_S;
+	sim_in_isr = false;
+
+	PLANT_Init( &car , scenario->walls , scenario->wall_count );
+
+	sim_tcnt0 = 0;
+	sim_overflows = 0;
+	sim_timer_enabled = true;
+	sim_timer_callback = NULL;
+
+	sim_rx_callback = NULL;
+	sim_rx_buffer = NULL;
+	sim_rx_index = 0;
+	sim_rx_enabled = true;
+
+	sim_send = 0;
+	sim_send_byte = 0;
+	sim_next_heartbeat = ( scenario->heartbeat_ms != 0 ) ? scenario->heartbeat_ms / 1000.0 : -1.0;
+
+	sim_shell_active = false;
+	sim_shell_exit = false;
+	sim_shell_length = 0;
+
+	memset( sim_lcd , ' ' , sizeof( sim_lcd ) );
+	sim_lcd_row = 0;
+	sim_lcd_col = 0;
+
+	/* An erased EEPROM, with the password of the scenario */
+	memset( sim_eeprom , 0xFF , sizeof( sim_eeprom ) );
+
+	if ( scenario->password != NULL )
+	{
+		sim_eeprom[ PASS_STATUS_ADDRESS ] = PASS_SAVED;
+		memcpy( &sim_eeprom[ PASS_ADDRESS ] , scenario->password , PASS_SIZE );
+	}
+
+	memset( result , 0 , sizeof( *result ) );
+	result->gap_min = PLANT_SONAR_RANGE;
+	result->box_time = -1.0;
+
+	latency_pending = false;
+	latency_sum = 0.0;
+
+	crossing_time = -1.0;
+	stop_pending = false;
+	detect_sum = 0.0;
+	stop_distance_sum = 0.0;
+}
+
+
+
+
+
+void SIM_Run( const SimScenario * run_scenario , SimResult * run_result )
+{
+	scenario = run_scenario;
+	result = run_result;
+
+	Sim_Init();
+
+	/* APP_Init and APP_main_loop of the car */
+	if ( setjmp( sim_exit ) == 0 )
+	{
+		CAR_Init();
+		Load_pass();
+		CAR_Start( SIM_CONNECTION_OVFS , SIM_CONNECTION_TCNT );
+
+		while ( 1 )
+		{
+			Check_Pass();
+			Obstacle_Detection();
+
+			/* SHELL_Task */
+			if ( sim_shell_exit )
+			{
+				sim_shell_active = false;
+				sim_shell_exit = false;
+				Shell_Exit();
+			}
+
+			Print_LCD_msg();
+
+			Sim_Advance( SIM_MAIN_LOOP_S );
+		}
+	}
+
+	result->end_time = Sim_Time();
+
+	/* Let the car stop after the restart (the reset stops the motors) */
+	if ( result->restarted )
+	{
+		car.right = PLANT_WHEEL_STOP;
+		car.left  = PLANT_WHEEL_STOP;
+	}
+
+	for ( double time = 0.0 ; ( time < SIM_SETTLE_S ) && !result->crashed ; time += SIM_TICK_S )
+	{
+		PLANT_Step( &car , SIM_TICK_S );
+		Sim_Measure( result->end_time + time );
+	}
+
+	if ( result->latency_count > 0 )
+	{
+		result->latency_avg = latency_sum / result->latency_count;
+	}
+
+	if ( result->stop_count > 0 )
+	{
+		result->detect_avg = detect_sum / result->stop_count;
+		result->stop_distance_avg = stop_distance_sum / result->stop_count;
+	}
+
+	if ( result->restarted )
+	{
+		double heading = fmod( fabs( car.heading ) * 180.0 / M_PI , 360.0 );
+
+		result->replay_error = hypot( car.x , car.y );
+		result->replay_heading = ( heading > 180.0 ) ? 360.0 - heading : heading;
+	}
+
+	result->car = car;
+
+	for ( int row = 0 ; row < 2 ; row++ )
+	{
+		memcpy( result->lcd[ row ] , sim_lcd[ row ] , 16 );
+		result->lcd[ row ][ 16 ] = '\0';
+	}
+
+	memcpy( result->password , &sim_eeprom[ PASS_ADDRESS ] , PASS_SIZE );
+	result->password[ PASS_SIZE ] = '\0';
+}
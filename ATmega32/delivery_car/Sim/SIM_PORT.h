@@ -0,0 +1,116 @@
+/****************************************************************************
+ * @file    SIM_PORT.h
+ * @author  Boles Medhat
+ * @brief   Delivery Car Host Simulation Port Header File
+ * @version 1.0
+ * @date    [2024-08-03]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file declares the simulated hardware of the host simulation: the
+ * CAR_PORT_ functions of `Code/APP/CAR.h` are implemented in `SIM_PORT.c`
+ * on the simulated vehicle (`PLANT.c`), Timer0, UART peer (the phone app),
+ * keypad, LCD and EEPROM, and SIM_Run() runs the real `CAR.c` main loop on
+ * them for one scenario.
+ *
+ * The time advances only inside the port functions that take time on the
+ * car (the ultrasonic echo, the LCD, the keypad scan, the delays and the
+ * EEPROM writes) and between two main loop passes, in steps of one Timer0
+ * tick (prescaler 256 at 8MHz = 32us). On each step the UART bytes and the
+ * Timer0 overflows call the CAR.c callbacks as the interrupts do.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef SIM_PORT_H_
+#define SIM_PORT_H_
+
+#include "../Code/LIB/STD_TYPES.h"
+#include "PLANT.h"
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+#define SIM_MAX_SENDS				16		/*Byte strings sent by the UART peer in one scenario*/
+#define SIM_MAX_KEYS				4		/*Key strings pressed on the keypad in one scenario*/
+#define SIM_MAX_WALLS				4		/*Wall segments of one scenario*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   types    -----------------------------------------*/
+
+/*Bytes sent by the UART peer, one after the other from time_ms*/
+typedef struct
+{
+	unsigned int time_ms;
+	const char * bytes;
+}SimSend;
+
+/*Keys pressed on the keypad, one every SIM_KEY_PERIOD_MS from time_ms*/
+typedef struct
+{
+	unsigned int time_ms;
+	const char * keys;
+}SimKeys;
+
+/*Scenario*/
+typedef struct
+{
+	const char * name;
+	SimSend sends[ SIM_MAX_SENDS ];		/*UART peer script (sorted by time, ends with a NULL string)*/
+	SimKeys keys[ SIM_MAX_KEYS ];		/*Keypad script (sorted by time, ends with a NULL string)*/
+	unsigned int heartbeat_ms;			/*NOTHING is sent every heartbeat_ms until heartbeat_end_ms (0: no heartbeat)*/
+	unsigned int heartbeat_end_ms;
+	unsigned int end_ms;				/*End of the scenario if the car does not restart (0: SIM_MAX_TIME_S)*/
+	const char * password;				/*Password saved in the EEPROM (NULL: none, it is asked at start)*/
+	PlantWall walls[ SIM_MAX_WALLS ];
+	int wall_count;
+}SimScenario;
+
+/*Results of one scenario*/
+typedef struct
+{
+	int    latency_count;				/*Motion commands that changed the wheel speeds*/
+	double latency_avg , latency_max;	/*UART byte start to 90% of the wheel speed change (s)*/
+
+	int    stop_count;					/*Obstacle stops*/
+	double detect_avg;					/*Real distance below OBSTACLE_DISTANCE to the stop (s)*/
+	double stop_distance_avg;			/*Distance driven after the stop (cm)*/
+	double gap_min;						/*Smallest distance to the obstacle after a stop (cm)*/
+
+	bool   crashed;						/*The car reached a wall*/
+	double crash_time;					/*Time of the crash (s)*/
+
+	bool   restarted;					/*The reverse playback ended and restarted the car*/
+	double replay_error;				/*Distance from the start point after the playback (cm)*/
+	double replay_heading;				/*Heading error after the playback (deg)*/
+
+	double end_time;					/*Simulated time (s)*/
+	Plant  car;							/*Final state of the car*/
+
+	char   lcd[ 2 ][ 17 ];				/*Final LCD text*/
+	double box_time;					/*Time the box is opened (s), < 0 if it is not opened*/
+	char   password[ 5 ];				/*Password in the EEPROM at the end*/
+}SimResult;
+/*_______________________________________________________________________________________________*/
+
+
+
+/*---------------------------- Function Prototypes --------------------------*/
+
+
+/*
+ * @brief Run one scenario on the real CAR.c logic.
+ *
+ * @param scenario: The scenario.
+ * @param result:   Pointer to store the results.
+ */
+void SIM_Run( const SimScenario * scenario , SimResult * result );
+
+
+#endif /* SIM_PORT_H_ */
@@ -17,6 +17,10 @@
  * - User input validation against the generated sequence
  * - Level control and game logic management
  *
+ * The game flow and the buttons polling are protothreads (`LIB/PT`), every
+ * wait returns to the main loop, so the threads run together without any
+ * blocking delay.
+ *
  *
  * @contact
  * LinkedIn : https://www.linkedin.com/in/boles-medhat
@@ -28,6 +32,133 @@
 #include "APP.h"
 
 
+/* LED and tone of each command (blue, yellow, green, red) */
+const uint8  command_led[4]  = { B_LED , Y_LED , G_LED , R_LED };
+const uint16 command_tone[4] = { B_TONE_HZ , Y_TONE_HZ , G_TONE_HZ , R_TONE_HZ };
+
+/* Milliseconds since start (counted by the system tick) */
+static volatile uint16 system_ms = 0;
+
+/* LED tag latched by the tone generator (the LEDs are written by the main loop) */
+static volatile uint8 led_tag = TONE_NO_TAG;
+static volatile bool  led_changed = false;
+
+/* Game state (kept outside the threads, their local variables are lost at every wait) */
+static uint8  commands[MAX_LEVEL];		/* Stores the LED/button sequence */
+static uint16 Level = MIN_LEVEL;		/* Current game level */
+static uint8  msg_idx = 0;				/* Index for motivational messages */
+static bool   Player_Win;				/* Result of the last check */
+
+/* Threads state */
+static pt buttons_thread;
+static pt game_thread;
+static pt display_thread;
+static pt check_thread;
+
+
+
+
+
+/*
+ * @brief Latch the LED of the note that starts playing.
+ *
+ * Called by the tone generator from the system tick interrupt at the start of
+ * every note. The LEDs share LED_PORT with the 74HC165 pins that the main loop
+ * writes, so the interrupt only latches the tag and LED_Task() writes the LEDs
+ * (a port write from the interrupt could undo a main loop write of the same port).
+ *
+ * @param tag: Command of the note (0 to 3), or TONE_NO_TAG to turn all the LEDs off.
+ */
+void Command_LED_handler( uint8 tag )
+{
+	led_tag = tag;
+	led_changed = true;
+}
+
+
+
+
+
+/*
+ * @brief Turn on the LED of the latched note.
+ *
+ * Called from the main loop, so the LEDs follow the tones within one loop pass.
+ */
+void LED_Task( void )
+{
+	uint8 tag;
+
+	/* Save global interrupt flag and disable it, so a new tag is not lost between the read and the clear */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	if ( led_changed == false )
+	{
+		SREG = sreg;
+		return;
+	}
+
+	tag = led_tag;
+	led_changed = false;
+
+	/* Restore global interrupt flag */
+	SREG = sreg;
+
+	/* Turn all the LEDs OFF */
+	for( uint8 cmd = 0 ; cmd < 4 ; cmd++ )
+	{
+		DIO_SetPinValue( LED_PORT , command_led[ cmd ] , LOW );
+	}
+
+	/* Turn the LED of the note ON */
+	if ( tag < 4 )
+	{
+		DIO_SetPinValue( LED_PORT , command_led[ tag ] , HIGH );
+	}
+}
+
+
+
+
+
+/*
+ * @brief 1 ms system tick (TIMER2 compare match).
+ *
+ * Counts the system time of the protothreads and advances the notes queue.
+ */
+void System_Tick( void )
+{
+	system_ms++;
+
+	TONE_Tick();
+}
+
+
+
+
+
+/*
+ * @brief Get the system time (time base of PT_DELAY_MS).
+ *
+ * @return (uint16) Milliseconds since start (wraps around after 65535).
+ */
+uint16 APP_GetTime_ms( void )
+{
+	uint16 time;
+
+	/* Save global interrupt flag and disable it, so the 16-bit time is not changed while it is read */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	time = system_ms;
+
+	/* Restore global interrupt flag */
+	SREG = sreg;
+
+	return time;
+}
+
+
 
 
 
@@ -40,15 +171,17 @@
  *
  * Key Initialization Steps:
  * - ADC initialized to generate random seed values.
- * - LCD initialized to display instructions and feedback.
- * - Input buttons configured with pull-up resistors.
+ * - LCD initialized to display instructions and feedback (big numbers and bar graph).
+ * - Input buttons service (74HC165 shift-in register) initialized.
+ * - Tone generator (TIMER0 on the buzzer) and 1 ms system tick (TIMER2) started.
  * - Game memory (sequence array) cleared.
  */
 void APP_Init()
 {
 
-	/* Initialize the LCD */
+	/* Initialize the LCD and its custom characters cache */
 	LCD_Init();
+	LCD_GLYPH_Init();
 
 	/* Initialize the ADC */
 	ADC_Init();
@@ -66,11 +199,17 @@ void APP_Init()
 	DIO_SetPinDirection( LED_PORT , G_LED , OUTPUT );
 	DIO_SetPinDirection( LED_PORT , R_LED , OUTPUT );
 
-	/* Configure input pins for control buttons with pull-up resistors */
-	DIO_SetPinDirection( BUTTON_PORT , B_BUTTON , INPUT_PULLUP );
-	DIO_SetPinDirection( BUTTON_PORT , Y_BUTTON , INPUT_PULLUP );
-	DIO_SetPinDirection( BUTTON_PORT , G_BUTTON , INPUT_PULLUP );
-	DIO_SetPinDirection( BUTTON_PORT , R_BUTTON , INPUT_PULLUP );
+	/* Initialize the control buttons (74HC165 shift-in register) */
+	BUTTONS_Init();
+
+	/* Initialize the tone generator, its LEDs follow the played notes */
+	TIMER0_Init();
+	TONE_Init();
+	TONE_SetCallback( Command_LED_handler );
+
+	/* Start the 1 ms system tick that counts the time and advances the notes queue */
+	TIMER2_SetCallback( TIMER2_COMP_ID , System_Tick );
+	TIMER2_Init();
 }
 
 
@@ -78,62 +217,65 @@ void APP_Init()
 
 
 /*
- * @brief Display a sequence of directional commands to the player.
+ * @brief Thread that reads and debounces all the buttons every BUTTONS_POLL_MS.
  *
- * Iterates through a given array of directions and displays each one briefly using LEDs
- * or an LCD screen, depending on the hardware setup. Used to show the player the pattern
- * they must later replicate.
+ * @param thread: Pointer to the thread state.
  *
- * @param commands: Pointer to an array of command directions (UP, DOWN, LEFT, RIGHT).
- * @param Size:     The number of commands in the sequence.
+ * @return (uint8) Thread status (it never ends).
  */
-void DisplayCommands ( uint8 * commands , uint16 Size )
+uint8 Buttons_Thread( pt * thread )
 {
+	PT_BEGIN( thread );
 
-	uint8 LED_PIN = 0;
-
-	/* Loop through each command in the sequence */
-	for(uint16 cmd_num = 0 ; cmd_num < Size ; cmd_num++ )
+	while(1)
 	{
+		/* Read and debounce all the buttons in one shift */
+		BUTTONS_Update();
 
-		/* Map the command value to the corresponding LED pin */
-		switch (commands[cmd_num])
-		{
-			/* Blue LED */
-			case 0:
-				LED_PIN = B_LED;
-				break;
+		PT_DELAY_MS( thread , BUTTONS_POLL_MS );
+	}
 
-			/* Yellow LED */
-			case 1:
-				LED_PIN = Y_LED;
-				break;
+	PT_END( thread );
+}
 
-			/* Green LED */
-			case 2:
-				LED_PIN = G_LED;
-				break;
 
-			/* Red LED */
-			default:
 
-				LED_PIN = R_LED;
-				break;
 
-		}
 
-		/* Turn the corresponding LED ON to indicate the command */
-		DIO_SetPinValue( LED_PORT , LED_PIN , HIGH );
+/*
+ * @brief Thread that displays a sequence of directional commands to the player.
+ *
+ * Queues the tone of every command followed by a short pause. The tone generator
+ * plays them in the background and turns the LED of each tone on while it plays.
+ * Used to show the player the pattern they must later replicate.
+ *
+ * @param thread:   Pointer to the thread state.
+ * @param commands: Pointer to an array of command directions (UP, DOWN, LEFT, RIGHT).
+ * @param Size:     The number of commands in the sequence.
+ *
+ * @return (uint8) PT_ENDED when the whole sequence is shown, PT_WAITING before.
+ */
+uint8 DisplayCommands_Thread ( pt * thread , uint8 * commands , uint16 Size )
+{
+	/* Kept between the waits */
+	static uint16 cmd_num;
 
-		/* Wait to let the player see the LED */
-		_delay_ms( 900 );
+	PT_BEGIN( thread );
 
-		/* Turn the LED OFF */
-		DIO_SetPinValue( LED_PORT , LED_PIN , LOW );
+	/* Loop through each command in the sequence */
+	for( cmd_num = 0 ; cmd_num < Size ; cmd_num++ )
+	{
+		/* Queue the command tone (its LED is ON while it plays), wait while the queue is full */
+		PT_WAIT_UNTIL( thread , TONE_Play( command_tone[ commands[cmd_num] ] , COMMAND_ON_MS , commands[cmd_num] ) );
 
-		/* Short pause before the next command */
-		_delay_ms( 100 );
+		/* Short pause (all LEDs OFF) before the next command */
+		PT_WAIT_UNTIL( thread , TONE_Play( TONE_REST , COMMAND_OFF_MS , TONE_NO_TAG ) );
 	}
+
+	/* Wait until the whole sequence is shown */
+	PT_WAIT_WHILE( thread , TONE_IsPlaying() );
+
+	PT_END( thread );
 }
 
 
@@ -141,91 +283,90 @@ void DisplayCommands ( uint8 * commands , uint16 Size )
 
 
 /*
- * @brief Verify if the player’s input matches the expected command sequence.
+ * @brief Thread that verifies if the player’s input matches the expected command sequence.
  *
- * Waits for the player to input a sequence of directions using buttons or ADC-based analog controls.
- * Compares the input with the original command list and returns true only if all inputs match exactly.
+ * Waits for the player to press the buttons (debounced by Buttons_Thread),
+ * compares every press with the original command list and sets the result
+ * to true only if all inputs match exactly.
  *
- * @param  commands: Pointer to the original command sequence.
- * @param  Size:     Number of commands in the sequence.
+ * @param thread:   Pointer to the thread state.
+ * @param commands: Pointer to the original command sequence.
+ * @param Size:     Number of commands in the sequence.
+ * @param win:      Pointer to store the result (true if the player input matches the sequence).
  *
- * @return (bool) true if the player input matches the expected sequence.
- * 				  false if any mismatch occurs in the input.
+ * @return (uint8) PT_ENDED when the result is known, PT_WAITING before.
  */
-bool CheckCommands ( uint8 * commands , uint16 Size )
+uint8 CheckCommands_Thread ( pt * thread , uint8 * commands , uint16 Size , bool * win )
 {
-	/* Array to track button states */
-	uint8 buttons[4] = {0,0,0,0};
+	/* Button of each command (blue, yellow, green, red) */
+	const uint8 command_button[4] = { B_BUTTON , Y_BUTTON , G_BUTTON , R_BUTTON };
+
+	/* Mask of the four color buttons */
+	const uint16 color_buttons = ( 1 << B_BUTTON ) | ( 1 << Y_BUTTON ) | ( 1 << G_BUTTON ) | ( 1 << R_BUTTON );
+
+	/* Debounced buttons held and newly pressed (read again after every wait) */
+	uint16 held, pressed;
+
+	/* Kept between the waits */
+	static uint16 cmd_num;
+
+	PT_BEGIN( thread );
 
 	/* Tracks whether the player succeeds */
-	bool Player_Win = true;
+	*win = true;
 
-	/* Ensures one valid press per command */
-	bool Button_flag = true;
+	/* Ignore the presses done while the commands were displayed */
+	BUTTONS_GetPressed();
 
 	/* Loop through all expected commands */
-	for(uint16 cmd_num = 0 ; cmd_num < Size ; cmd_num++ )
+	for( cmd_num = 0 ; cmd_num < Size ; cmd_num++ )
 	{
-		while(1)
+		/* Wait for a new press (a held button is pressed once, so no wait for release is needed) */
+		PT_WAIT_UNTIL( thread , ( pressed = BUTTONS_GetPressed() & color_buttons ) != 0 );
+
+		held = BUTTONS_GetState() & color_buttons;
+
+		/* If multiple buttons pressed, or wrong button, player loses */
+		if ( ( held & ( held - 1 ) ) || ( pressed != ( 1 << command_button[ commands[ cmd_num ] ] ) ) )
 		{
-			/* Read the state of each button (active LOW) */
-			buttons[0] = ! DIO_GetPinValue( BUTTON_PORT , B_BUTTON );
-			buttons[1] = ! DIO_GetPinValue( BUTTON_PORT , Y_BUTTON );
-			buttons[2] = ! DIO_GetPinValue( BUTTON_PORT , G_BUTTON );
-			buttons[3] = ! DIO_GetPinValue( BUTTON_PORT , R_BUTTON );
+			*win = false;
+
+			/* Play the wrong choice tone instead of any press tone */
+			TONE_Stop();
+			TONE_Play( ERROR_TONE_HZ , ERROR_TONE_MS , TONE_NO_TAG );
 
-			/* Debounce delay */
-			_delay_ms( 20 );
+			/* Early exit if player already failed */
+			break;
+		}
 
-			/* The sum of total buttons pressed */
-			uint8 sum = buttons[0] + buttons[1] + buttons[2] + buttons[3];
+		/* Play the tone and flash the LED of the pressed color (in the background) */
+		TONE_Stop();
+		TONE_Play( command_tone[ commands[ cmd_num ] ] , PRESS_TONE_MS , commands[ cmd_num ] );
 
-			/* Check that single button press detected */
-			if ( (sum == 1) && (Button_flag == true) )
-			{
-				/* Check that this is the correct button */
-				if( buttons[ commands[ cmd_num ] ] == HIGH )
-				{
-					/* Wait for release before accepting next input */
-					Button_flag = false;
-
-					/* Move to the next command */
-					break;
-				}
-				/* If wrong button */
-				else
-				{
-					/* Player loses */
-					Player_Win = false;
-					break;
-				}
+		/* Show the entered commands on the progress bar */
+		LCD_GLYPH_DrawBar( 1 , 0 , PROGRESS_BAR_WIDTH , cmd_num + 1 , Size );
+	}
 
-			}
+	PT_END( thread );
+}
 
-			/* If all buttons released enable buttons pressed */
-			else if(sum == 0)
-			{
-				Button_flag = true;
-			}
 
-			/* If multiple buttons pressed player loses */
-			else if (sum > 1 )
-			{
-				Player_Win = false;
-				break;
-			}
 
-		}
 
-		/* Early exit if player already failed */
-		if (Player_Win == false)
-		{
-			break;
-		}
-	}
 
-	/* ereturn if player wins or loses */
-	return Player_Win;
+/*
+ * @brief Generate a new random sequence for the first level.
+ */
+void New_Game( void )
+{
+	/* Reset level */
+	Level = MIN_LEVEL;
+
+	/* Generate a random command for the first level */
+	for(uint16 cmd_num = 0 ; cmd_num < Level - 1 ; cmd_num++ )
+	{
+		commands[ cmd_num ] = rand() & 0x03;
+	}
 }
 
 
@@ -233,7 +374,7 @@ bool CheckCommands ( uint8 * commands , uint16 Size )
 
 
 /*
- * @brief Main loop for running the Simon Says memory game.
+ * @brief Thread of the Simon Says game flow.
  *
  * Continuously manages the game's progression through levels by:
  * - Generating and displaying a random sequence.
@@ -241,22 +382,14 @@ bool CheckCommands ( uint8 * commands , uint16 Size )
  * - Checking input correctness.
  * - Advancing to higher levels or ending the game on failure.
  *
- * The game increases in difficulty by extending the command sequence at each level.
- * Feedback is displayed through LEDs or an LCD after each round.
+ * @param thread: Pointer to the thread state.
+ *
+ * @return (uint8) Thread status (it never ends).
  */
-void APP_main_loop()
+uint8 Game_Thread( pt * thread )
 {
-	/* Stores the LED/button sequence */
-	uint8 commands[MAX_LEVEL] ={};
-
-	/* Current game level */
-	uint16 Level = MIN_LEVEL;
-
-	/* Index for motivational messages */
-	uint8 msg_idx = 0;
-
 	/* Predefined motivational messages shown after each successful level */
-	const char lvl_msg[8][2][17] = {
+	static const char lvl_msg[8][2][17] = {
 	    { "   LEVEL UP!!   ", "  KEEP GOING!!  " },
 	    { "   NICE WORK!   ", " NEXT ONE AHEAD " },
 	    { " YOU LEVELED UP ", "  STAY SHARP!!  " },
@@ -267,28 +400,30 @@ void APP_main_loop()
 	    { "NEXT LEVEL READY", "CAN YOU SURVIVE?" }
 	};
 
-	/* Generate a random command for the first level */
-	for(uint16 cmd_num = 0 ; cmd_num < Level - 1 ; cmd_num++ )
-	{
-		commands[ cmd_num ] = rand() & 0x03;
-	}
+	PT_BEGIN( thread );
 
 	while(1)
 	{
-		/* Show current level on the LCD */
+		/* Show current level on the LCD (the old custom characters are not on the screen anymore) */
 		LCD_ClearScreen();
-		LCD_SetCursor( 0 , 4 );
-		LCD_PrintString( "LEVEL " );
-		LCD_PrintNumber( Level - MIN_LEVEL + 1 );
+		LCD_GLYPH_NewFrame();
+		LCD_SetCursor( 0 , 1 );
+		LCD_PrintString( "LEVEL" );
+		LCD_GLYPH_PrintBigNumber( 0 , LEVEL_NUMBER_COL , Level - MIN_LEVEL + 1 );
+
+		/* Empty progress bar of the commands to be entered */
+		LCD_GLYPH_DrawBar( 1 , 0 , PROGRESS_BAR_WIDTH , 0 , Level );
 
 		/* Generate a new random command for the current level */
 		commands[ Level - 1 ] = rand() & 0x03;
 
 		/* Display the sequence of commands using LEDs */
-		DisplayCommands( commands , Level );
+		PT_SPAWN( thread , &display_thread , DisplayCommands_Thread( &display_thread , commands , Level ) );
 
 		/* Check player's response to the sequence */
-		if ( CheckCommands( commands , Level ) )
+		PT_SPAWN( thread , &check_thread , CheckCommands_Thread( &check_thread , commands , Level , &Player_Win ) );
+
+		if ( Player_Win )
 		{
 			/* Advance to next level */
 			Level++;
@@ -297,13 +432,7 @@ void APP_main_loop()
 			if ( Level == MAX_LEVEL)
 			{
 				/* Reset to level 1 */
-				Level = MIN_LEVEL;
-
-				/* Generate a random command for the first level */
-				for(uint16 cmd_num = 0 ; cmd_num < Level - 1 ; cmd_num++ )
-				{
-					commands[ cmd_num ] = rand() & 0x03;
-				}
+				New_Game();
 
 				/* Show that maximum level reached on the LCD */
 				LCD_ClearScreen();
@@ -312,13 +441,13 @@ void APP_main_loop()
 				LCD_SetCursor( 1 , 1 );
 				LCD_PrintString( "YOU BROKE IT!!" );
 
-				_delay_ms( 1000 );
+				PT_DELAY_MS( thread , 1000 );
 
 				LCD_ClearScreen();
 				LCD_SetCursor( 0 , 0 );
 				LCD_PrintString( "WRAP TO LVL 1 :(" );
 
-				_delay_ms( 1000 );
+				PT_DELAY_MS( thread , 1000 );
 
 			}
 			else
@@ -333,7 +462,7 @@ void APP_main_loop()
 				/* Loop message index */
 				msg_idx = (msg_idx + 1) & 0x07;
 
-				_delay_ms( 1000 );
+				PT_DELAY_MS( thread , 1000 );
 			}
 
 
@@ -341,13 +470,7 @@ void APP_main_loop()
 		else
 		{
 			/* Player failed — reset level */
-			Level = MIN_LEVEL;
-
-			/* Generate a random command for the first level */
-			for(uint16 cmd_num = 0 ; cmd_num < Level - 1 ; cmd_num++ )
-			{
-				commands[ cmd_num ] = rand() & 0x03;
-			}
+			New_Game();
 
 			/* Show game over message */
 			LCD_ClearScreen();
@@ -356,23 +479,42 @@ void APP_main_loop()
 			LCD_SetCursor( 1 , 1 );
 			LCD_PrintString( "GAME OVER :(" );
 
-			_delay_ms( 500 );
+			PT_DELAY_MS( thread , 500 );
 
 			LCD_ClearScreen();
 			LCD_SetCursor( 0 , 3 );
 			LCD_PrintString( "Try Again!" );
 
-			_delay_ms( 500 );
+			PT_DELAY_MS( thread , 500 );
 		}
 	}
-}
-
-
 
+	PT_END( thread );
+}
 
 
 
 
 
+/*
+ * @brief Main loop for running the Simon Says memory game.
+ *
+ * Runs the game flow and the buttons polling threads together. Every thread
+ * returns at its next wait, so new threads (for example an idle animation)
+ * can be added to the loop without changing the others.
+ */
+void APP_main_loop()
+{
+	/* Generate a random command for the first level */
+	New_Game();
 
+	PT_INIT( &buttons_thread );
+	PT_INIT( &game_thread );
 
+	while(1)
+	{
+		Buttons_Thread( &buttons_thread );
+		Game_Thread( &game_thread );
+		LED_Task();
+	}
+}
@@ -31,8 +31,15 @@
 
 #include "../MCAL/DIO/DIO.h"
 #include "../MCAL/ADC/ADC.h"
+#include "../MCAL/TIMER0/TIMER0.h"
+#include "../MCAL/TIMER2/TIMER2.h"
 
 #include "../HAL/LCD/LCD.h"
+#include "../HAL/LCD_GLYPH/LCD_GLYPH.h"
+#include "../HAL/BUTTONS/BUTTONS.h"
+#include "../HAL/TONE/TONE.h"
+
+#include "../LIB/PT/PT.h"
 
 #include <stdlib.h>
 
@@ -49,8 +56,9 @@
  *
  * Key Initialization Steps:
  * - ADC initialized to generate random seed values.
- * - LCD initialized to display instructions and feedback.
- * - Input buttons configured with pull-up resistors.
+ * - LCD initialized to display instructions and feedback (big numbers and bar graph).
+ * - Input buttons service (74HC165 shift-in register) initialized.
+ * - Tone generator (TIMER0 on the buzzer) and 1 ms system tick (TIMER2) started.
  * - Game memory (sequence array) cleared.
  */
 void APP_Init(void);
@@ -67,8 +75,17 @@ void APP_Init(void);
  *
  * The game increases in difficulty by extending the command sequence at each level.
  * Feedback is displayed through LEDs or an LCD after each round.
+ * The game flow and the buttons polling run together as protothreads.
  */
 void APP_main_loop(void);
 
 
+/*
+ * @brief Get the system time (time base of PT_DELAY_MS).
+ *
+ * @return (uint16) Milliseconds since start (wraps around after 65535).
+ */
+uint16 APP_GetTime_ms(void);
+
+
 #endif /* APP_H_ */
@@ -22,32 +22,15 @@
 #define APP_CONFIG_H_
 
 
-/*Set the DIO Ports for blue, yellow, green, and red buttons:
+/*Set the 74HC165 input (button number) of blue, yellow, green, and red buttons
+ * (the 74HC165 pins are set in `Shift_config.h`):
  * choose between:
- * 1. DIO_PORTA
- * 2. DIO_PORTB
- * 3. DIO_PORTC
- * 4. DIO_PORTD
- */
-#define BUTTON_PORT					DIO_PORTD
-
-
-
-/*Set the DIO Pin for blue, yellow, green, and red buttons:
- * choose between:
- * 1. DIO_PIN0
- * 2. DIO_PIN1
- * 3. DIO_PIN2
- * 4. DIO_PIN3
- * 5. DIO_PIN4
- * 6. DIO_PIN5
- * 7. DIO_PIN6
- * 8. DIO_PIN7
+ * 0 to ( BUTTONS_COUNT - 1 )  (input D0 of the first register is 0)
  */
-#define B_BUTTON					DIO_PIN0
-#define Y_BUTTON					DIO_PIN1
-#define G_BUTTON					DIO_PIN2
-#define R_BUTTON					DIO_PIN3
+#define B_BUTTON					0
+#define Y_BUTTON					1
+#define G_BUTTON					2
+#define R_BUTTON					3
 
 
 
@@ -23,6 +23,22 @@
 
 #define MAX_LEVEL					50	/*Max level a user can access (number of Commands)*/
 #define MIN_LEVEL					2	/*Start level (number of Commands in first level)*/
+
+#define LEVEL_NUMBER_COL			9	/*Column of the big level number (2 rows high, 7 columns for 2 digits)*/
+#define PROGRESS_BAR_WIDTH			8	/*Width of the entered commands bar on the second row (characters)*/
+
+#define BUTTONS_POLL_MS				10	/*Time between two buttons samples (debounce time = BUTTONS_DEBOUNCE_SAMPLES * BUTTONS_POLL_MS)*/
+
+#define COMMAND_ON_MS				900	/*Time a command LED and tone are on*/
+#define COMMAND_OFF_MS				100	/*Pause between two commands*/
+#define PRESS_TONE_MS				200	/*Time the LED and tone of a correct press are on*/
+#define ERROR_TONE_MS				500	/*Time of the wrong choice tone*/
+
+#define B_TONE_HZ					330	/*Blue   tone (E4)*/
+#define Y_TONE_HZ					277	/*Yellow tone (C#4)*/
+#define G_TONE_HZ					165	/*Green  tone (E3)*/
+#define R_TONE_HZ					440	/*Red    tone (A4)*/
+#define ERROR_TONE_HZ				130	/*Wrong choice tone (low buzz)*/
 /*_______________________________________________________________________________________________*/
 
 
@@ -0,0 +1,173 @@
+/****************************************************************************
+ * @file    BUTTONS.c
+ * @author  Boles Medhat
+ * @brief   Shift-In Buttons Driver Source File
+ * @version 1.0
+ * @date    [2024-12-07]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file implements the Shift-In Buttons Driver. The last
+ * BUTTONS_DEBOUNCE_SAMPLES samples are kept in a ring, then:
+ * - Bits that are 1 in all the samples (AND of the samples) become pressed.
+ * - Bits that are 0 in all the samples (OR  of the samples) become released.
+ * - Other bits (still bouncing) keep their previous state.
+ * So all the buttons are debounced with a few bitwise operations.
+ *
+ * @note
+ * - BUTTONS_Update() and the Get functions must be called from the same
+ *   context (all from the main loop, or all from the same ISR).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include "BUTTONS.h"
+
+
+/* Last raw samples (1 = pressed) */
+static uint16 g_BUTTONS_Samples[ BUTTONS_DEBOUNCE_SAMPLES ];
+static uint8  g_BUTTONS_SampleIdx = 0;
+
+/* Debounced state of the buttons (1 = pressed) */
+static uint16 g_BUTTONS_State = 0;
+
+/* Edges not read yet */
+static uint16 g_BUTTONS_Pressed  = 0;
+static uint16 g_BUTTONS_Released = 0;
+
+
+
+
+
+/*
+ * @brief Initializes the Shift-In pins and clears the buttons state.
+ */
+void BUTTONS_Init( void )
+{
+	/* Initialize the Shift-In Pins */
+	SHIFT_IN_Init();
+
+	/* All the Buttons start released */
+	for( uint8 i = 0 ; i < BUTTONS_DEBOUNCE_SAMPLES ; i++ )
+	{
+		g_BUTTONS_Samples[ i ] = 0;
+	}
+
+	g_BUTTONS_SampleIdx = 0;
+	g_BUTTONS_State     = 0;
+	g_BUTTONS_Pressed   = 0;
+	g_BUTTONS_Released  = 0;
+}
+
+
+
+
+
+/*
+ * @brief Samples all the buttons and updates the debounced state and edges.
+ *
+ * Latches the 74HC165 inputs and reads BUTTONS_REGISTERS bytes in one
+ * transaction, then debounces the new sample with the previous ones.
+ */
+void BUTTONS_Update( void )
+{
+	uint16 sample = 0;
+	uint16 all_pressed = 0xFFFF;
+	uint16 any_pressed = 0;
+	uint16 new_state;
+
+	/* Load all the Inputs at once, then shift them in (first byte is from the register next to the MCU) */
+	SHIFT_IN_Latch();
+
+	for( uint8 reg = 0 ; reg < BUTTONS_REGISTERS ; reg++ )
+	{
+		sample |= (uint16)SHIFT_IN_Byte() << ( reg << 3 );
+	}
+
+	/* Make the pressed Buttons 1 */
+	#if BUTTONS_ACTIVE_LEVEL == BUTTONS_ACTIVE_LOW
+		sample = ~sample;
+	#endif
+
+	#if BUTTONS_REGISTERS == 1
+		sample &= 0x00FF;
+	#endif
+
+	/* Store the Sample in the Ring */
+	g_BUTTONS_Samples[ g_BUTTONS_SampleIdx ] = sample;
+	g_BUTTONS_SampleIdx++;
+	if ( g_BUTTONS_SampleIdx >= BUTTONS_DEBOUNCE_SAMPLES )
+	{
+		g_BUTTONS_SampleIdx = 0;
+	}
+
+	/* Find the Buttons that are stable in all the Samples */
+	for( uint8 i = 0 ; i < BUTTONS_DEBOUNCE_SAMPLES ; i++ )
+	{
+		all_pressed &= g_BUTTONS_Samples[ i ];
+		any_pressed |= g_BUTTONS_Samples[ i ];
+	}
+
+	/* Stable pressed Buttons are set, stable released Buttons are cleared, the others are kept */
+	new_state = all_pressed | ( g_BUTTONS_State & any_pressed );
+
+	/* Keep the Edges until they are read */
+	g_BUTTONS_Pressed  |= new_state & ~g_BUTTONS_State;
+	g_BUTTONS_Released |= g_BUTTONS_State & ~new_state;
+
+	g_BUTTONS_State = new_state;
+}
+
+
+
+
+
+/*
+ * @brief Gets the debounced state of all the buttons.
+ *
+ * @return (uint16) Bitmask of the held buttons (bit n is 1 while button n is pressed).
+ */
+uint16 BUTTONS_GetState( void )
+{
+	return g_BUTTONS_State;
+}
+
+
+
+
+
+/*
+ * @brief Gets and clears the buttons pressed since the last call.
+ *
+ * @return (uint16) Bitmask of the new presses (bit n is 1 if button n was pressed).
+ */
+uint16 BUTTONS_GetPressed( void )
+{
+	uint16 pressed = g_BUTTONS_Pressed;
+
+	g_BUTTONS_Pressed = 0;
+
+	return pressed;
+}
+
+
+
+
+
+/*
+ * @brief Gets and clears the buttons released since the last call.
+ *
+ * @return (uint16) Bitmask of the new releases (bit n is 1 if button n was released).
+ */
+uint16 BUTTONS_GetReleased( void )
+{
+	uint16 released = g_BUTTONS_Released;
+
+	g_BUTTONS_Released = 0;
+
+	return released;
+}
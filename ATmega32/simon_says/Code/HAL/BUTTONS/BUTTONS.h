@@ -0,0 +1,87 @@
+/****************************************************************************
+ * @file    BUTTONS.h
+ * @author  Boles Medhat
+ * @brief   Shift-In Buttons Driver Header File
+ * @version 1.0
+ * @date    [2024-12-07]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file provides an input service for push buttons connected to the
+ * parallel inputs of chained 74HC165 shift registers, so up to 16 buttons
+ * use only the 3 Shift-In pins.
+ *
+ * Every BUTTONS_Update() call latches all the buttons at once and reads them
+ * in one shift, then debounces all of them together as a bitmask (bit n is
+ * button n): a bit of the state changes only when it has the same value in
+ * the last BUTTONS_DEBOUNCE_SAMPLES samples. The press and release edges are
+ * kept until they are read, so no press is lost between two reads.
+ *
+ * @note
+ * - Call BUTTONS_Update() at a regular rate (every 5 to 20 ms).
+ * - A pressed button is a 1 in all the masks, whatever BUTTONS_ACTIVE_LEVEL is.
+ *
+ * @example for up and down buttons on inputs D0 and D1:
+ * 		BUTTONS_Init();
+ * 		BUTTONS_Update();
+ * 		uint16 pressed = BUTTONS_GetPressed();
+ * 		if( GET_BIT( pressed , 0 ) ) { ... }
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef BUTTONS_H_
+#define BUTTONS_H_
+
+#include "../ShiftRegister/Shift.h"
+#include "BUTTONS_config.h"
+
+
+/*
+ * @brief Initializes the Shift-In pins and clears the buttons state.
+ */
+void BUTTONS_Init( void );
+
+
+
+/*
+ * @brief Samples all the buttons and updates the debounced state and edges.
+ *
+ * Latches the 74HC165 inputs and reads BUTTONS_REGISTERS bytes in one
+ * transaction, then debounces the new sample with the previous ones.
+ */
+void BUTTONS_Update( void );
+
+
+
+/*
+ * @brief Gets the debounced state of all the buttons.
+ *
+ * @return (uint16) Bitmask of the held buttons (bit n is 1 while button n is pressed).
+ */
+uint16 BUTTONS_GetState( void );
+
+
+
+/*
+ * @brief Gets and clears the buttons pressed since the last call.
+ *
+ * @return (uint16) Bitmask of the new presses (bit n is 1 if button n was pressed).
+ */
+uint16 BUTTONS_GetPressed( void );
+
+
+
+/*
+ * @brief Gets and clears the buttons released since the last call.
+ *
+ * @return (uint16) Bitmask of the new releases (bit n is 1 if button n was released).
+ */
+uint16 BUTTONS_GetReleased( void );
+
+
+#endif /* BUTTONS_H_ */
@@ -0,0 +1,134 @@
+/****************************************************************************
+ * @file    LCD.hpp
+ * @author  Boles Medhat
+ * @brief   LCD Compile-Time Templates Header File (C++)
+ * @version 1.0
+ * @date    [2024-12-02]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This optional C++ header is the 4-bit LCD hot path (LCD_SendCommand and
+ * LCD_SendData) with the pins as template parameters (see `DIO.hpp`). Each
+ * nibble is written with register bit instructions instead of six
+ * DIO_SetPinValue calls, the delays are the same as the C driver.
+ *
+ * The pins of the C driver configuration can be used directly:
+ *
+ *     typedef io::Lcd< io::Pin< io::Port< LCD_RS_PORT >   , LCD_RS_PIN >    ,
+ *                      io::Pin< io::Port< LCD_E_PORT >    , LCD_E_PIN >     ,
+ *                      io::Pin< io::Port< LCD_DATA_PORT > , LCD_DATA_PIN0 > ,
+ *                      io::Pin< io::Port< LCD_DATA_PORT > , LCD_DATA_PIN1 > ,
+ *                      io::Pin< io::Port< LCD_DATA_PORT > , LCD_DATA_PIN2 > ,
+ *                      io::Pin< io::Port< LCD_DATA_PORT > , LCD_DATA_PIN3 > > Lcd;
+ *     LCD_Init();
+ *     Lcd::PrintString( "Level 1" );
+ *
+ * Both paths drive the same LCD, so the C driver can keep the
+ * initialization and the rarely used functions.
+ *
+ * @note
+ * - Needs a C++ compiler, see `DIO.hpp`.
+ * - Only the 4-bit mode (LCD_4_BITS_MODE), the data pins can be on any ports.
+ * - Does not update LCD_CurrentRow/LCD_CurrentCol of the C driver, set the
+ *   cursor with LCD_SetCursor() after printing with the template.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ******************************************************************************/
+
+#ifndef LCD_HPP_
+#define LCD_HPP_
+
+#include "../../MCAL/DIO/DIO.hpp"
+
+extern "C"
+{
+	#include "LCD.h"
+}
+
+
+namespace io
+{
+
+/*
+ * @brief 4-bit HD44780 LCD on six pin types.
+ */
+template< class RS , class E , class D4 , class D5 , class D6 , class D7 >
+struct Lcd
+{
+	/* Sets the pins as outputs and sends the initialization commands (same as LCD_Init) */
+	static void Init( void )
+	{
+		RS::SetOutput();
+		E::SetOutput();
+		D4::SetOutput();
+		D5::SetOutput();
+		D6::SetOutput();
+		D7::SetOutput();
+
+		_delay_ms( 50 );
+
+		SendCommand( LCD_RETURN_TO_HOME );
+		_delay_ms( 2 );
+		SendCommand( LCD_4_BITS_MODE );
+		SendCommand( LCD_CURSOR_STATUS );
+		SendCommand( LCD_CURSOR_SHIFT_RIGHT );
+		SendCommand( LCD_CLEAR_SCREEN );
+		_delay_ms( 2 );
+	}
+
+	/* Sends a command byte */
+	static void SendCommand( uint8 command )
+	{
+		RS::Low();
+		Write( command );
+	}
+
+	/* Sends a data byte (character) */
+	static void SendData( char data )
+	{
+		RS::High();
+		Write( data );
+	}
+
+	/* Prints a null-terminated string at the current cursor position */
+	static void PrintString( const char * str )
+	{
+		while ( *str != '\0' )
+		{
+			SendData( *str++ );
+		}
+	}
+
+private:
+
+	/* Writes the higher nibble of a value to the data pins and pulses E */
+	static void WriteNibble( uint8 value )
+	{
+		D4::Set( value & 0x10 );
+		D5::Set( value & 0x20 );
+		D6::Set( value & 0x40 );
+		D7::Set( value & 0x80 );
+
+		E::High();
+		_delay_us( 10 );
+		E::Low();
+	}
+
+	/* Writes a byte as two nibbles with the delays of the C driver */
+	static void Write( uint8 value )
+	{
+		WriteNibble( value );
+		_delay_us( 10 );
+		WriteNibble( value << 4 );
+		_delay_us( 60 );
+	}
+};
+
+}
+
+
+#endif /* LCD_HPP_ */
@@ -0,0 +1,319 @@
+/****************************************************************************
+ * @file    LCD_GLYPH.c
+ * @author  Boles Medhat
+ * @brief   LCD Glyph Cache Source File
+ * @version 1.0
+ * @date    [2024-12-02]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file implements the LCD Glyph Cache. Every slot has an age in frames:
+ * 0 means used in the current frame (locked), LCD_GLYPH_AGE_FREE means empty.
+ * LCD_GLYPH_NewFrame() makes all the used slots one frame older, and a miss
+ * takes a free slot or the oldest one.
+ *
+ * The big digits are drawn with 3 glyphs (top bar, bottom bar, top and
+ * bottom bars) plus the ROM full block and space.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include "LCD_GLYPH.h"
+
+
+/* Age of a free slot, the oldest age of a used slot is one less */
+#define LCD_GLYPH_AGE_FREE			0xFF
+
+/* Cells of the big digits */
+#define E		0	/* empty      */
+#define F		1	/* full block */
+#define T		2	/* top bar    */
+#define B		3	/* bottom bar */
+#define M		4	/* top and bottom bars */
+
+
+/* Copy of the pattern in every slot */
+static uint8 g_LCD_GLYPH_Patterns[ LCD_GLYPH_SLOTS ][ 8 ];
+
+/* Frames since every slot was last used */
+static uint8 g_LCD_GLYPH_Age[ LCD_GLYPH_SLOTS ];
+
+/* Number of CGRAM uploads (cache misses) */
+static uint16 g_LCD_GLYPH_Uploads = 0;
+
+/* Glyphs of the big digits cells (T, B, M) */
+static const uint8 g_LCD_GLYPH_BigCells[ 3 ][ 8 ] =
+{
+	{ 0x1F , 0x1F , 0x1F , 0x00 , 0x00 , 0x00 , 0x00 , 0x00 },	/* T */
+	{ 0x00 , 0x00 , 0x00 , 0x00 , 0x00 , 0x1F , 0x1F , 0x1F },	/* B */
+	{ 0x1F , 0x1F , 0x1F , 0x00 , 0x00 , 0x1F , 0x1F , 0x1F }	/* M */
+};
+
+/* Cells of every big digit: top row (3 cells), then bottom row (3 cells) */
+static const uint8 g_LCD_GLYPH_BigDigits[ 10 ][ 6 ] =
+{
+	{ F , T , F ,   F , B , F },	/* 0 */
+	{ T , F , E ,   B , F , B },	/* 1 */
+	{ M , M , F ,   F , B , B },	/* 2 */
+	{ M , M , F ,   B , B , F },	/* 3 */
+	{ F , B , F ,   E , E , F },	/* 4 */
+	{ F , M , M ,   B , B , F },	/* 5 */
+	{ F , M , M ,   F , B , F },	/* 6 */
+	{ T , T , F ,   E , E , F },	/* 7 */
+	{ F , M , F ,   F , B , F },	/* 8 */
+	{ F , M , F ,   B , B , F }		/* 9 */
+};
+
+
+
+
+
+/*
+ * @brief Initializes the glyph cache (all the slots are free).
+ *
+ * @note Call it after LCD_Init().
+ */
+void LCD_GLYPH_Init( void )
+{
+	for( uint8 slot = 0 ; slot < LCD_GLYPH_SLOTS ; slot++ )
+	{
+		g_LCD_GLYPH_Age[ slot ] = LCD_GLYPH_AGE_FREE;
+	}
+
+	g_LCD_GLYPH_Uploads = 0;
+}
+
+
+
+
+
+/*
+ * @brief Starts a new frame, the glyphs of the previous frames can be evicted.
+ *
+ * Call it after LCD_ClearScreen() or before redrawing all the custom characters.
+ */
+void LCD_GLYPH_NewFrame( void )
+{
+	for( uint8 slot = 0 ; slot < LCD_GLYPH_SLOTS ; slot++ )
+	{
+		/* Make the used Slots older (saturate before the free value) */
+		if ( g_LCD_GLYPH_Age[ slot ] < LCD_GLYPH_AGE_FREE - 1 )
+		{
+			g_LCD_GLYPH_Age[ slot ]++;
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Gets the character code of a glyph, uploads it to the CGRAM only if it is not cached.
+ *
+ * @param pattern: Pointer to 8 bytes (rows, top first, 5 low bits per row).
+ *
+ * @return (uint8) Character code to be printed (LCD_GLYPH_CODE_BASE + slot),
+ * 				   or LCD_GLYPH_NO_SLOT if all the slots are used by the current frame.
+ */
+uint8 LCD_GLYPH_Get( const uint8 * pattern )
+{
+	uint8 victim = LCD_GLYPH_SLOTS;
+	uint8 oldest = 0;
+	uint8 slot;
+	uint8 row;
+
+	for( slot = 0 ; slot < LCD_GLYPH_SLOTS ; slot++ )
+	{
+		if ( g_LCD_GLYPH_Age[ slot ] == LCD_GLYPH_AGE_FREE )
+		{
+			/* Prefer a free Slot on a miss */
+			if ( oldest != LCD_GLYPH_AGE_FREE )
+			{
+				victim = slot;
+				oldest = LCD_GLYPH_AGE_FREE;
+			}
+			continue;
+		}
+
+		/* Compare the cached Pattern */
+		for( row = 0 ; row < 8 ; row++ )
+		{
+			if ( g_LCD_GLYPH_Patterns[ slot ][ row ] != ( pattern[ row ] & 0x1F ) )
+			{
+				break;
+			}
+		}
+
+		/* Hit: the Glyph is already in the CGRAM */
+		if ( row == 8 )
+		{
+			g_LCD_GLYPH_Age[ slot ] = 0;
+			return LCD_GLYPH_CODE_BASE + LCD_GLYPH_FIRST_SLOT + slot;
+		}
+
+		/* Remember the least recently used Slot (not used in this frame) */
+		if ( g_LCD_GLYPH_Age[ slot ] > oldest )
+		{
+			victim = slot;
+			oldest = g_LCD_GLYPH_Age[ slot ];
+		}
+	}
+
+	/* All the Slots are on the screen */
+	if ( victim == LCD_GLYPH_SLOTS )
+	{
+		return LCD_GLYPH_NO_SLOT;
+	}
+
+	/* Miss: store the Pattern and upload it */
+	for( row = 0 ; row < 8 ; row++ )
+	{
+		g_LCD_GLYPH_Patterns[ victim ][ row ] = pattern[ row ] & 0x1F;
+	}
+
+	LCD_SaveCustomChar( g_LCD_GLYPH_Patterns[ victim ] , LCD_GLYPH_FIRST_SLOT + victim );
+
+	g_LCD_GLYPH_Age[ victim ] = 0;
+	g_LCD_GLYPH_Uploads++;
+
+	return LCD_GLYPH_CODE_BASE + LCD_GLYPH_FIRST_SLOT + victim;
+}
+
+
+
+
+
+/*
+ * @brief Gets the number of glyphs uploaded to the CGRAM (cache misses).
+ *
+ * @return (uint16) Number of uploads since initialization.
+ */
+uint16 LCD_GLYPH_GetUploads( void )
+{
+	return g_LCD_GLYPH_Uploads;
+}
+
+
+
+
+
+/*
+ * @brief Draws a horizontal bar graph with a resolution of one pixel column.
+ *
+ * @param row:   Row of the bar.
+ * @param col:   First column of the bar.
+ * @param width: Width of the bar in characters (5 pixel columns each).
+ * @param value: Filled part of the bar (from 0 to max).
+ * @param max:   Value of a full bar.
+ */
+void LCD_GLYPH_DrawBar( uint8 row , uint8 col , uint8 width , uint16 value , uint16 max )
+{
+	uint8  pattern[ 8 ];
+	uint8  code;
+	uint16 pixels = 0;
+
+	/* Convert the Value to filled pixel Columns */
+	if ( max > 0 )
+	{
+		if ( value > max )
+		{
+			value = max;
+		}
+
+		pixels = ( (uint32)value * width * LCD_GLYPH_CHAR_WIDTH ) / max;
+	}
+
+	LCD_SetCursor( row , col );
+
+	for( uint8 cell = 0 ; cell < width ; cell++ )
+	{
+		if ( pixels >= LCD_GLYPH_CHAR_WIDTH )
+		{
+			/* Full Character from the ROM */
+			LCD_PrintCharacter( LCD_GLYPH_FULL_BLOCK );
+			pixels -= LCD_GLYPH_CHAR_WIDTH;
+		}
+		else if ( pixels > 0 )
+		{
+			/* Partial Character: the left pixel Columns are on (bit 4 is the left Column) */
+			for( uint8 pattern_row = 0 ; pattern_row < 8 ; pattern_row++ )
+			{
+				pattern[ pattern_row ] = ( 0x1F << ( LCD_GLYPH_CHAR_WIDTH - pixels ) ) & 0x1F;
+			}
+
+			code = LCD_GLYPH_Get( pattern );
+			LCD_PrintCharacter( ( code == LCD_GLYPH_NO_SLOT ) ? LCD_GLYPH_EMPTY : code );
+			pixels = 0;
+		}
+		else
+		{
+			LCD_PrintCharacter( LCD_GLYPH_EMPTY );
+		}
+	}
+}
+
+
+
+
+
+/*
+ * @brief Prints a number with big digits (3 characters wide, 2 rows high, 1 column between digits).
+ *
+ * @param row:    Top row of the digits.
+ * @param col:    Column of the first digit.
+ * @param number: Number to be printed.
+ */
+void LCD_GLYPH_PrintBigNumber( uint8 row , uint8 col , uint16 number )
+{
+	uint8 digits[ 5 ];
+	uint8 digits_count = 0;
+	uint8 cell_code[ 5 ];
+
+	/* Get the Character of every Cell type (from the ROM or the cache) */
+	cell_code[ E ] = LCD_GLYPH_EMPTY;
+	cell_code[ F ] = LCD_GLYPH_FULL_BLOCK;
+
+	for( uint8 cell = T ; cell <= M ; cell++ )
+	{
+		cell_code[ cell ] = LCD_GLYPH_Get( g_LCD_GLYPH_BigCells[ cell - T ] );
+
+		/* No free Slot: draw the Cell as a full block */
+		if ( cell_code[ cell ] == LCD_GLYPH_NO_SLOT )
+		{
+			cell_code[ cell ] = LCD_GLYPH_FULL_BLOCK;
+		}
+	}
+
+	/* Split the Number into Digits (least significant first) */
+	do
+	{
+		digits[ digits_count++ ] = number % 10;
+		number /= 10;
+	}
+	while ( number > 0 );
+
+	/* Draw the top half, then the bottom half of all the Digits */
+	for( uint8 half = 0 ; half < 2 ; half++ )
+	{
+		LCD_SetCursor( row + half , col );
+
+		for( uint8 digit_idx = digits_count ; digit_idx > 0 ; digit_idx-- )
+		{
+			for( uint8 cell = 0 ; cell < LCD_GLYPH_BIG_DIGIT_WIDTH ; cell++ )
+			{
+				LCD_PrintCharacter( cell_code[ g_LCD_GLYPH_BigDigits[ digits[ digit_idx - 1 ] ][ half * 3 + cell ] ] );
+			}
+
+			/* Space between the Digits */
+			if ( digit_idx > 1 )
+			{
+				LCD_PrintCharacter( LCD_GLYPH_EMPTY );
+			}
+		}
+	}
+}
@@ -0,0 +1,104 @@
+/****************************************************************************
+ * @file    LCD_GLYPH.h
+ * @author  Boles Medhat
+ * @brief   LCD Glyph Cache Header File
+ * @version 1.0
+ * @date    [2024-12-02]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file provides a cache for the 8 custom characters (CGRAM) of the
+ * HD44780 LCD, with a horizontal bar graph and big (2 rows) numbers built
+ * on it. The cache keeps a copy of the pattern of every slot:
+ * - A pattern that is already in a slot is reused (no LCD transfer).
+ * - A new pattern takes a free slot, or the least recently used one,
+ *   and only then its 8 bytes are sent to the LCD.
+ *
+ * A slot used in the current frame is never evicted, because the characters
+ * on the screen would change with it. Call LCD_GLYPH_NewFrame() after
+ * clearing (or fully redrawing) the screen to release the old glyphs.
+ *
+ * @note
+ * - The bar graph and big numbers use only 4 custom glyphs (and the ROM full block).
+ *
+ * @example progress bar of 8 characters on the second row:
+ * 		LCD_GLYPH_Init();
+ * 		LCD_GLYPH_DrawBar( 1 , 0 , 8 , done , total );
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef LCD_GLYPH_H_
+#define LCD_GLYPH_H_
+
+#include "../LCD/LCD.h"
+#include "LCD_GLYPH_config.h"
+
+
+/*
+ * @brief Initializes the glyph cache (all the slots are free).
+ *
+ * @note Call it after LCD_Init().
+ */
+void LCD_GLYPH_Init( void );
+
+
+
+/*
+ * @brief Starts a new frame, the glyphs of the previous frames can be evicted.
+ *
+ * Call it after LCD_ClearScreen() or before redrawing all the custom characters.
+ */
+void LCD_GLYPH_NewFrame( void );
+
+
+
+/*
+ * @brief Gets the character code of a glyph, uploads it to the CGRAM only if it is not cached.
+ *
+ * @param pattern: Pointer to 8 bytes (rows, top first, 5 low bits per row).
+ *
+ * @return (uint8) Character code to be printed (LCD_GLYPH_CODE_BASE + slot),
+ * 				   or LCD_GLYPH_NO_SLOT if all the slots are used by the current frame.
+ */
+uint8 LCD_GLYPH_Get( const uint8 * pattern );
+
+
+
+/*
+ * @brief Gets the number of glyphs uploaded to the CGRAM (cache misses).
+ *
+ * @return (uint16) Number of uploads since initialization.
+ */
+uint16 LCD_GLYPH_GetUploads( void );
+
+
+
+/*
+ * @brief Draws a horizontal bar graph with a resolution of one pixel column.
+ *
+ * @param row:   Row of the bar.
+ * @param col:   First column of the bar.
+ * @param width: Width of the bar in characters (5 pixel columns each).
+ * @param value: Filled part of the bar (from 0 to max).
+ * @param max:   Value of a full bar.
+ */
+void LCD_GLYPH_DrawBar( uint8 row , uint8 col , uint8 width , uint16 value , uint16 max );
+
+
+
+/*
+ * @brief Prints a number with big digits (3 characters wide, 2 rows high, 1 column between digits).
+ *
+ * @param row:    Top row of the digits.
+ * @param col:    Column of the first digit.
+ * @param number: Number to be printed.
+ */
+void LCD_GLYPH_PrintBigNumber( uint8 row , uint8 col , uint16 number );
+
+
+#endif /* LCD_GLYPH_H_ */
@@ -0,0 +1,36 @@
+/****************************************************************************
+ * @file    LCD_GLYPH_config.h
+ * @author  Boles Medhat
+ * @brief   LCD Glyph Cache Configuration Header File
+ * @version 1.0
+ * @date    [2024-12-02]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @note
+ * - Slots outside the cache can still be used with LCD_SaveCustomChar().
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef LCD_GLYPH_CONFIG_H_
+#define LCD_GLYPH_CONFIG_H_
+
+#include "LCD_GLYPH_def.h"
+
+
+/*Set the CGRAM slots managed by the cache (from LCD_GLYPH_FIRST_SLOT to LCD_GLYPH_FIRST_SLOT + LCD_GLYPH_SLOTS - 1)*/
+#define LCD_GLYPH_FIRST_SLOT				0
+#define LCD_GLYPH_SLOTS						8
+
+
+
+#if ( LCD_GLYPH_SLOTS < 1 ) || ( LCD_GLYPH_FIRST_SLOT + LCD_GLYPH_SLOTS > LCD_GLYPH_CGRAM_SLOTS )
+	#error "Wrong \"LCD_GLYPH_FIRST_SLOT\" or \"LCD_GLYPH_SLOTS\" configuration option"
+#endif
+
+
+#endif /* LCD_GLYPH_CONFIG_H_ */
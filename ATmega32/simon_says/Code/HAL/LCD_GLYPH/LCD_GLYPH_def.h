@@ -0,0 +1,43 @@
+/****************************************************************************
+ * @file    LCD_GLYPH_def.h
+ * @author  Boles Medhat
+ * @brief   LCD Glyph Cache Definitions Header File
+ * @version 1.0
+ * @date    [2024-12-02]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the macro definitions used by the LCD Glyph Cache
+ * (CGRAM custom characters, bar graphs and big numbers).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef LCD_GLYPH_DEF_H_
+#define LCD_GLYPH_DEF_H_
+
+#include "../../LIB/STD_TYPES.h"
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+#define LCD_GLYPH_CGRAM_SLOTS				8			/*Number of custom characters in the HD44780 CGRAM*/
+
+#define LCD_GLYPH_CODE_BASE					0x08		/*Character code of CGRAM slot 0 (codes 8 to 15 are a copy of 0 to 7, and are never a string end)*/
+
+#define LCD_GLYPH_NO_SLOT					0x00		/*Returned when all the slots are used by the current frame*/
+
+#define LCD_GLYPH_FULL_BLOCK				0xFF		/*ROM character with all the pixels on (HD44780 A00 ROM)*/
+#define LCD_GLYPH_EMPTY						' '			/*ROM character with all the pixels off*/
+
+#define LCD_GLYPH_CHAR_WIDTH				5			/*Pixel columns in one character*/
+
+#define LCD_GLYPH_BIG_DIGIT_WIDTH			3			/*Characters per big digit (2 rows high)*/
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* LCD_GLYPH_DEF_H_ */
@@ -0,0 +1,160 @@
+/****************************************************************************
+ * @file    Shift.hpp
+ * @author  Boles Medhat
+ * @brief   Shift Register Compile-Time Templates Header File (C++)
+ * @version 1.0
+ * @date    [2024-12-02]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This optional C++ header is the Shift driver with the pins as template
+ * parameters (see `DIO.hpp`), so every bit costs a few register bit
+ * instructions instead of DIO_SetPinValue calls:
+ *
+ *     typedef io::ShiftOut< io::Pin< io::PortD , DIO_PIN1 > ,		// DS
+ *                           io::Pin< io::PortD , DIO_PIN0 > ,		// SHCP
+ *                           io::Pin< io::PortD , DIO_PIN2 > > Leds;	// STCP
+ *     Leds::Init();
+ *     Leds::Byte( 0xAA );
+ *     Leds::Latch();
+ *
+ * The bit order is SHIFT_ORDER and the clock delay is 5 us, the same as the C
+ * driver, both can be changed by the template parameters (a delay of 0
+ * removes it, for registers that follow the MCU clock).
+ *
+ * @note
+ * - Needs a C++ compiler, see `DIO.hpp`.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ******************************************************************************/
+
+#ifndef SHIFT_HPP_
+#define SHIFT_HPP_
+
+#include "../../MCAL/DIO/DIO.hpp"
+
+extern "C"
+{
+	#include "Shift.h"
+}
+
+
+namespace io
+{
+
+/*
+ * @brief Shift-Out register (74HC595) on three pin types.
+ */
+template< class DATA , class CLOCK , class LATCH , uint8 ORDER = SHIFT_ORDER , uint8 DELAY_US = 5 >
+struct ShiftOut
+{
+	/* Sets the pins as outputs with Low values */
+	static void Init( void )
+	{
+		DATA::SetOutput();
+		CLOCK::SetOutput();
+		LATCH::SetOutput();
+
+		DATA::Low();
+		CLOCK::Low();
+		LATCH::Low();
+	}
+
+	/* Sends one byte in the ORDER bit order */
+	static void Byte( uint8 data )
+	{
+		for ( uint8 bit_num = 0 ; bit_num < 8 ; bit_num++ )
+		{
+			if ( ORDER == SHIFT_LSB_FIRST )
+			{
+				DATA::Set( data & 0x01 );
+				data >>= 1;
+			}
+			else
+			{
+				DATA::Set( data & 0x80 );
+				data <<= 1;
+			}
+
+			/* Pulse the clock pin to shift the bit into the register */
+			CLOCK::High();
+			if ( DELAY_US ) { _delay_us( DELAY_US ); }
+			CLOCK::Low();
+			if ( DELAY_US ) { _delay_us( DELAY_US ); }
+		}
+	}
+
+	/* Moves the shifted data to the output pins */
+	static void Latch( void )
+	{
+		LATCH::High();
+		if ( DELAY_US ) { _delay_us( DELAY_US ); }
+		LATCH::Low();
+	}
+};
+
+
+
+
+/*
+ * @brief Shift-In register (74HC165) on three pin types.
+ */
+template< class DATA , class CLOCK , class LOAD , uint8 ORDER = SHIFT_ORDER , uint8 DELAY_US = 5 >
+struct ShiftIn
+{
+	/* Sets the clock and load pins as outputs with Low values and the data pin as input */
+	static void Init( void )
+	{
+		CLOCK::SetOutput();
+		LOAD::SetOutput();
+		DATA::SetInput();
+
+		CLOCK::Low();
+		LOAD::Low();
+	}
+
+	/* Reads one byte in the ORDER bit order */
+	static uint8 Byte( void )
+	{
+		uint8 data = 0;
+
+		for ( uint8 bit_num = 0 ; bit_num < 8 ; bit_num++ )
+		{
+			if ( ORDER == SHIFT_LSB_FIRST )
+			{
+				data >>= 1;
+				if ( DATA::Get() ) { data |= 0x80; }
+			}
+			else
+			{
+				data <<= 1;
+				if ( DATA::Get() ) { data |= 0x01; }
+			}
+
+			/* Pulse the clock pin to shift the next bit out of the register */
+			CLOCK::High();
+			if ( DELAY_US ) { _delay_us( DELAY_US ); }
+			CLOCK::Low();
+			if ( DELAY_US ) { _delay_us( DELAY_US ); }
+		}
+
+		return data;
+	}
+
+	/* Loads the input pins into the register */
+	static void Latch( void )
+	{
+		LOAD::Low();
+		if ( DELAY_US ) { _delay_us( DELAY_US ); }
+		LOAD::High();
+	}
+};
+
+}
+
+
+#endif /* SHIFT_HPP_ */
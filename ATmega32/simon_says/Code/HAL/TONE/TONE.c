@@ -0,0 +1,262 @@
+/****************************************************************************
+ * @file    TONE.c
+ * @author  Boles Medhat
+ * @brief   Tone Generator Driver Source File
+ * @version 1.0
+ * @date    [2024-12-02]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file implements the Tone Generator Driver. The notes are kept in a
+ * ring buffer filled by TONE_Play() (application) and emptied by TONE_Tick()
+ * (system tick interrupt). The frequency is converted to the OCR0 value when
+ * the note is queued, so starting a note in the interrupt only writes OCR0,
+ * TCNT0 and the OC0 mode.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#include "TONE.h"
+
+
+/* Notes queue (one extra slot to tell a full queue from an empty one) */
+static ToneNote g_TONE_Queue[ TONE_QUEUE_SIZE + 1 ];
+static volatile uint8 g_TONE_Head = 0;		/* next note to be played (changed by TONE_Tick) */
+static volatile uint8 g_TONE_Tail = 0;		/* next free slot (changed by TONE_Play) */
+
+/* Remaining ticks of the current note */
+static volatile uint16 g_TONE_Remaining = 0;
+
+/* A note (or a rest) is playing */
+static volatile bool g_TONE_Active = false;
+
+/* Pointer to the function called when a note starts */
+static void (*g_TONE_CallBack)(uint8) = NULL;
+
+
+
+
+
+/*
+ * @brief Turns off the buzzer output (OC0 returns to its DIO LOW value).
+ */
+static void TONE_Silence( void )
+{
+	TIMER0_SetCompareOutputMode( TIMER0_COM_DISCONNECT_OC0 );
+}
+
+
+
+
+
+/*
+ * @brief Starts a note from the queue and notifies the callback.
+ *
+ * @param note: Pointer to the note.
+ */
+static void TONE_Start( const ToneNote * note )
+{
+	if ( note->compare == TONE_REST_COMPARE )
+	{
+		TONE_Silence();
+	}
+	else
+	{
+		/* Restart the Timer with the new half period, then let the hardware toggle OC0 */
+		TIMER0_SetCompareValue( (uint8)note->compare );
+		TIMER0_SetTimerValue( 0 );
+		TIMER0_SetCompareOutputMode( TIMER0_COM_TOGGLE_OC0 );
+	}
+
+	/* A note lasts at least one tick */
+	g_TONE_Remaining = ( note->duration > 0 ) ? note->duration : 1;
+	g_TONE_Active    = true;
+
+	if ( g_TONE_CallBack != NULL )
+	{
+		g_TONE_CallBack( note->tag );
+	}
+}
+
+
+
+
+
+/*
+ * @brief Initializes the tone generator (silent, empty queue).
+ */
+void TONE_Init( void )
+{
+	/* OC0 pin is LOW while it is disconnected from the Timer */
+	DIO_SetPinDirection( DIO_PORTB , DIO_PIN3 , OUTPUT );
+	DIO_SetPinValue( DIO_PORTB , DIO_PIN3 , LOW );
+
+	TONE_Silence();
+
+	g_TONE_Head      = 0;
+	g_TONE_Tail      = 0;
+	g_TONE_Remaining = 0;
+	g_TONE_Active    = false;
+}
+
+
+
+
+
+/*
+ * @brief Adds a note to the end of the queue.
+ *
+ * @param frequency: Note frequency in Hz (from TONE_FREQ_MIN to TONE_FREQ_MAX), or TONE_REST.
+ * @param duration:  Note duration in ms (system ticks).
+ * @param tag:       Value passed to the note callback when the note starts.
+ *
+ * @return (bool) true if the note is queued, false if the queue is full.
+ */
+bool TONE_Play( uint16 frequency , uint16 duration , uint8 tag )
+{
+	uint8 next = g_TONE_Tail + 1;
+
+	if ( next > TONE_QUEUE_SIZE )
+	{
+		next = 0;
+	}
+
+	/* Check that the Queue is not full */
+	if ( next == g_TONE_Head )
+	{
+		return false;
+	}
+
+	/* Convert the Frequency to the OCR0 value (clamped to the Timer range) */
+	if ( frequency == TONE_REST )
+	{
+		g_TONE_Queue[ g_TONE_Tail ].compare = TONE_REST_COMPARE;
+	}
+	else if ( frequency < TONE_FREQ_MIN )
+	{
+		g_TONE_Queue[ g_TONE_Tail ].compare = TIMER0_MAX_CAPACITY;
+	}
+	else if ( frequency > TONE_FREQ_MAX )
+	{
+		g_TONE_Queue[ g_TONE_Tail ].compare = 0;
+	}
+	else
+	{
+		g_TONE_Queue[ g_TONE_Tail ].compare = TONE_FREQ_TO_OCR( frequency );
+	}
+
+	g_TONE_Queue[ g_TONE_Tail ].duration = duration;
+	g_TONE_Queue[ g_TONE_Tail ].tag      = tag;
+
+	/* Publish the Note to the Tick after it is written */
+	g_TONE_Tail = next;
+
+	return true;
+}
+
+
+
+
+
+/*
+ * @brief Stops the current note and removes all the queued notes.
+ */
+void TONE_Stop( void )
+{
+	/* Save global interrupt flag */
+	uint8 sreg = SREG;
+
+	/* Disable global interrupt so the Tick does not start a removed note */
+	CLR_BIT( SREG , I );
+
+	g_TONE_Head      = g_TONE_Tail;
+	g_TONE_Remaining = 0;
+
+	if ( g_TONE_Active )
+	{
+		g_TONE_Active = false;
+		TONE_Silence();
+
+		if ( g_TONE_CallBack != NULL )
+		{
+			g_TONE_CallBack( TONE_NO_TAG );
+		}
+	}
+
+	/* Restore global interrupt flag */
+	SREG = sreg;
+}
+
+
+
+
+
+/*
+ * @brief Checks if a note is playing or waiting in the queue.
+ *
+ * @return (bool) true while the queue is not finished, false otherwise.
+ */
+bool TONE_IsPlaying( void )
+{
+	return ( g_TONE_Active || ( g_TONE_Head != g_TONE_Tail ) );
+}
+
+
+
+
+
+/*
+ * @brief Sets the function called when a note starts.
+ *
+ * @param CopyFuncPtr: Pointer to the callback function, it receives the tag of the note
+ * 					   (or TONE_NO_TAG when the queue becomes empty).
+ */
+void TONE_SetCallback( void (*CopyFuncPtr)(uint8) )
+{
+	g_TONE_CallBack = CopyFuncPtr;
+}
+
+
+
+
+
+/*
+ * @brief Advances the queue by one system tick.
+ *
+ * Must be called every 1 ms (e.g. registered as the TIMER2 Compare Match callback).
+ */
+void TONE_Tick( void )
+{
+	/* The current Note is still playing */
+	if ( g_TONE_Remaining > 1 )
+	{
+		g_TONE_Remaining--;
+		return;
+	}
+
+	g_TONE_Remaining = 0;
+
+	/* Start the next Note */
+	if ( g_TONE_Head != g_TONE_Tail )
+	{
+		TONE_Start( &g_TONE_Queue[ g_TONE_Head ] );
+
+		g_TONE_Head = ( g_TONE_Head >= TONE_QUEUE_SIZE ) ? 0 : ( g_TONE_Head + 1 );
+	}
+
+	/* The Queue is finished */
+	else if ( g_TONE_Active )
+	{
+		g_TONE_Active = false;
+		TONE_Silence();
+
+		if ( g_TONE_CallBack != NULL )
+		{
+			g_TONE_CallBack( TONE_NO_TAG );
+		}
+	}
+}
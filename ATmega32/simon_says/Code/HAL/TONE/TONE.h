@@ -0,0 +1,98 @@
+/****************************************************************************
+ * @file    TONE.h
+ * @author  Boles Medhat
+ * @brief   Tone Generator Driver Header File
+ * @version 1.0
+ * @date    [2024-12-02]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file provides a background tone and melody service for a buzzer on
+ * the TIMER0 OC0 pin. The tone is generated by TIMER0 in CTC mode with OC0
+ * toggled by the hardware on every compare match, so a playing note takes no
+ * CPU time. The notes wait in a queue and TONE_Tick(), called from the 1 ms
+ * system tick, ends the current note and starts the next one.
+ *
+ * Every note has a tag that is passed to the note callback when the note
+ * starts (TONE_NO_TAG when the queue becomes empty), so LEDs or other
+ * outputs can follow the melody exactly without blocking the application.
+ *
+ * @note
+ * - The note callback is called from the system tick interrupt, keep it short.
+ *
+ * @example play two notes and a pause:
+ * 		TONE_Init();
+ * 		TONE_Play( 440 , 200 , 0 );
+ * 		TONE_Play( TONE_REST , 50 , TONE_NO_TAG );
+ * 		TONE_Play( 330 , 200 , 1 );
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef TONE_H_
+#define TONE_H_
+
+#include "../../MCAL/DIO/DIO.h"
+#include "../../MCAL/TIMER0/TIMER0.h"
+#include "TONE_config.h"
+
+
+/*
+ * @brief Initializes the tone generator (silent, empty queue).
+ */
+void TONE_Init( void );
+
+
+
+/*
+ * @brief Adds a note to the end of the queue.
+ *
+ * @param frequency: Note frequency in Hz (from TONE_FREQ_MIN to TONE_FREQ_MAX), or TONE_REST.
+ * @param duration:  Note duration in ms (system ticks).
+ * @param tag:       Value passed to the note callback when the note starts.
+ *
+ * @return (bool) true if the note is queued, false if the queue is full.
+ */
+bool TONE_Play( uint16 frequency , uint16 duration , uint8 tag );
+
+
+
+/*
+ * @brief Stops the current note and removes all the queued notes.
+ */
+void TONE_Stop( void );
+
+
+
+/*
+ * @brief Checks if a note is playing or waiting in the queue.
+ *
+ * @return (bool) true while the queue is not finished, false otherwise.
+ */
+bool TONE_IsPlaying( void );
+
+
+
+/*
+ * @brief Sets the function called when a note starts.
+ *
+ * @param CopyFuncPtr: Pointer to the callback function, it receives the tag of the note
+ * 					   (or TONE_NO_TAG when the queue becomes empty).
+ */
+void TONE_SetCallback( void (*CopyFuncPtr)(uint8) );
+
+
+
+/*
+ * @brief Advances the queue by one system tick.
+ *
+ * Must be called every 1 ms (e.g. registered as the TIMER2 Compare Match callback).
+ */
+void TONE_Tick( void );
+
+
+#endif /* TONE_H_ */
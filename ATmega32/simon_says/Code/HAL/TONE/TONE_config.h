@@ -0,0 +1,49 @@
+/****************************************************************************
+ * @file    TONE_config.h
+ * @author  Boles Medhat
+ * @brief   Tone Generator Driver Configuration Header File
+ * @version 1.0
+ * @date    [2024-12-02]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @note
+ * - ⚠️ IMPORTANT: You must initialize the TIMER0 module in TIMER0_CTC_MODE mode
+ * 				   with OC0 disconnected (this driver connects it only while a note
+ * 				   is played), and call TONE_Tick() every 1 ms (system tick).
+ * - The buzzer is connected to the OC0 pin (PB3).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef TONE_CONFIG_H_
+#define TONE_CONFIG_H_
+
+#include "TONE_def.h"
+#include "../../MCAL/TIMER0/TIMER0.h"
+
+
+/*Set the number of notes that can wait in the queue (from 2 to 255)*/
+#define TONE_QUEUE_SIZE						8
+
+
+
+/* Configure Timer0 to CTC mode (OCR0 is the half period of the tone) */
+#if TIMER0_WAVEFORM_GENERATION_MODE != TIMER0_CTC_MODE
+	#warning "⚠️ Configure Timer0 in TIMER0_CTC_MODE mode."
+#endif
+
+/* OC0 must start disconnected, the driver toggles it only while a note is played */
+#if TIMER0_OC0_MODE != TIMER0_COM_DISCONNECT_OC0
+	#warning "⚠️ Configure Timer0 OC0 as TIMER0_COM_DISCONNECT_OC0."
+#endif
+
+#if ( TONE_QUEUE_SIZE < 2 ) || ( TONE_QUEUE_SIZE > 255 )
+	#error "Wrong \"TONE_QUEUE_SIZE\" configuration option"
+#endif
+
+
+#endif /* TONE_CONFIG_H_ */
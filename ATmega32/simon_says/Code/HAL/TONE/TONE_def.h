@@ -0,0 +1,55 @@
+/****************************************************************************
+ * @file    TONE_def.h
+ * @author  Boles Medhat
+ * @brief   Tone Generator Driver Definitions Header File
+ * @version 1.0
+ * @date    [2024-12-02]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the types and macro definitions used by the Tone
+ * Generator Driver (buzzer on the TIMER0 OC0 pin).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef TONE_DEF_H_
+#define TONE_DEF_H_
+
+#include "../../LIB/STD_TYPES.h"
+
+
+/*------------------------------------------   types    -----------------------------------------*/
+
+/*One note of the queue*/
+typedef struct
+{
+	uint16 compare;			/*OCR0 value of the note (calculated when queued), TONE_REST_COMPARE for silence*/
+	uint16 duration;		/*Note duration in system ticks (ms)*/
+	uint8  tag;				/*User value passed to the note callback when the note starts*/
+}ToneNote;
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+#define TONE_REST							0			/*Frequency of a silent note (pause)*/
+#define TONE_REST_COMPARE					0xFFFF		/*Compare value stored for a silent note*/
+
+#define TONE_NO_TAG							0xFF		/*Tag passed to the note callback when the queue becomes empty*/
+
+/*OCR0 value of a frequency in CTC toggle mode: f = F_CPU / ( 2 * prescaler * ( OCR0 + 1 ) )*/
+#define TONE_FREQ_TO_OCR( freq )			( ( F_CPU / ( 2UL * TIMER0_PRESCALER * (uint32)( freq ) ) ) - 1 )
+
+/*Lowest and highest frequencies that can be generated with the TIMER0 prescaler*/
+#define TONE_FREQ_MIN						( ( F_CPU / ( 2UL * TIMER0_PRESCALER * 256 ) ) + 1 )
+#define TONE_FREQ_MAX						( F_CPU / ( 2UL * TIMER0_PRESCALER ) )
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* TONE_DEF_H_ */
@@ -0,0 +1,94 @@
+/****************************************************************************
+ * @file    PT.h
+ * @author  Boles Medhat
+ * @brief   Protothreads (Stackless Coroutines) Header File
+ * @version 1.0
+ * @date    [2024-12-02]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file provides protothreads: functions that are written as one
+ * sequential flow (wait for a button, wait some time, continue) but return
+ * to the caller at every wait, so many flows run together from one main loop
+ * without blocking delays, without an RTOS and without a stack per thread.
+ *
+ * A thread is a function that takes a pointer to its pt state and returns
+ * PT_WAITING, PT_YIELDED, PT_EXITED or PT_ENDED. The state holds only the
+ * line to continue from and a delay timer (4 bytes). The macros build a
+ * switch on that line inside the function (PT_BEGIN ... PT_END).
+ *
+ * @example a LED that blinks without blocking:
+ * 		uint8 Blink_Thread( pt * thread )
+ * 		{
+ * 			PT_BEGIN( thread );
+ * 			while( 1 )
+ * 			{
+ * 				DIO_TogglePinValue( DIO_PORTD , DIO_PIN4 );
+ * 				PT_DELAY_MS( thread , 500 );
+ * 			}
+ * 			PT_END( thread );
+ * 		}
+ *
+ * 		pt blink;
+ * 		PT_INIT( &blink );
+ * 		while( 1 ) { Blink_Thread( &blink ); Other_Thread( &other ); }
+ *
+ * @note
+ * - ⚠️ IMPORTANT: Local variables are lost at every wait, keep the values used
+ * 				   after a wait in static or global variables.
+ * - Do not use a switch statement around a wait inside a thread (the waits
+ *   are case labels of the thread switch).
+ * - Only one wait per source line.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef PT_H_
+#define PT_H_
+
+#include "PT_config.h"
+
+
+/* Sets a thread to start from its beginning */
+#define PT_INIT( thread )					( (thread)->line = 0 )
+
+/* Starts the body of a thread function */
+#define PT_BEGIN( thread )					switch( (thread)->line ) { case 0:
+
+/* Ends the body of a thread function (the thread is ended and starts again at the next call) */
+#define PT_END( thread )					} PT_INIT( thread ); return PT_ENDED
+
+/* Returns from the thread until the condition is true (checked at every call) */
+#define PT_WAIT_UNTIL( thread , condition )	\
+	do { (thread)->line = __LINE__; case __LINE__: if( !(condition) ) { return PT_WAITING; } } while( 0 )
+
+/* Returns from the thread while the condition is true */
+#define PT_WAIT_WHILE( thread , condition )	PT_WAIT_UNTIL( thread , !(condition) )
+
+/* Returns from the thread once, the other threads run before it continues */
+#define PT_YIELD( thread )					\
+	do { (thread)->line = __LINE__; return PT_YIELDED; case __LINE__: ; } while( 0 )
+
+/* Returns from the thread until the time passes */
+#define PT_DELAY_MS( thread , ms )			\
+	do { (thread)->timer = PT_TIME_MS(); PT_WAIT_UNTIL( thread , (uint16)( PT_TIME_MS() - (thread)->timer ) >= (uint16)(ms) ); } while( 0 )
+
+/* Starts a child thread and returns from the thread until the child ends */
+#define PT_SPAWN( thread , child , call )	\
+	do { PT_INIT( child ); PT_WAIT_UNTIL( thread , (call) >= PT_EXITED ); } while( 0 )
+
+/* Ends the thread now (it starts again at the next call) */
+#define PT_EXIT( thread )					do { PT_INIT( thread ); return PT_EXITED; } while( 0 )
+
+/* Starts the thread again from its beginning at the next call */
+#define PT_RESTART( thread )				do { PT_INIT( thread ); return PT_WAITING; } while( 0 )
+
+/* Checks that a thread call did not end (PT_WAITING or PT_YIELDED) */
+#define PT_IS_RUNNING( call )				( (call) < PT_EXITED )
+
+
+#endif /* PT_H_ */
@@ -0,0 +1,33 @@
+/****************************************************************************
+ * @file    PT_config.h
+ * @author  Boles Medhat
+ * @brief   Protothreads Configuration Header File
+ * @version 1.0
+ * @date    [2024-12-02]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @note
+ * - The time function must read the system time atomically (it is usually
+ *   counted by a timer interrupt).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef PT_CONFIG_H_
+#define PT_CONFIG_H_
+
+#include "PT_def.h"
+
+
+/*Set the function that returns the system time in milliseconds (uint16, wraps around)
+ * PT_DELAY_MS can wait up to 65535 ms
+ */
+uint16 APP_GetTime_ms( void );
+#define PT_TIME_MS()						APP_GetTime_ms()
+
+
+#endif /* PT_CONFIG_H_ */
@@ -0,0 +1,48 @@
+/****************************************************************************
+ * @file    PT_def.h
+ * @author  Boles Medhat
+ * @brief   Protothreads Definitions Header File
+ * @version 1.0
+ * @date    [2024-12-02]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the thread state type and the values returned by the
+ * protothreads.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ****************************************************************************/
+
+#ifndef PT_DEF_H_
+#define PT_DEF_H_
+
+#include "../STD_TYPES.h"
+
+
+/*------------------------------------------   types    -----------------------------------------*/
+
+/*Protothread state (4 bytes per thread)*/
+typedef struct
+{
+	uint16 line;			/*Source line to continue from (0 = start of the thread)*/
+	uint16 timer;			/*Start time of PT_DELAY_MS (milliseconds)*/
+}pt;
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Returned by the thread functions*/
+#define PT_WAITING							0			/*Blocked in PT_WAIT_UNTIL, PT_WAIT_WHILE or PT_DELAY_MS*/
+#define PT_YIELDED							1			/*Gave the CPU to the other threads with PT_YIELD*/
+#define PT_EXITED							2			/*Ended by PT_EXIT*/
+#define PT_ENDED							3			/*Reached PT_END*/
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* PT_DEF_H_ */
@@ -33,12 +33,14 @@
 #ifndef STD_TYPES_H_
 #define STD_TYPES_H_
 
-/* Boolean type definitions */
+/* Boolean type definitions (built-in in C++) */
+#ifndef __cplusplus
 typedef unsigned char			bool;		/* 8-bit Boolean type: true or false (True or False) */
 
 /* Boolean Values definitions */
 #define false					0				/* Representing 0 value as false */
 #define true					1				/* Representing 1 value as true */
+#endif
 #define False					0				/* Representing 0 value as False (alternative name) */
 #define True					1				/* Representing 1 value as True (alternative name) */
 
@@ -58,8 +60,12 @@ typedef double					float64;		/* 64-bit floating-point: Double precision */
 
 /* NULL value definitions (if not already defined) */
 #ifndef NULL
+#ifdef __cplusplus
+#define NULL					0				/* define NULL value as zero (C++ does not convert void* to other pointers) */
+#else
 #define NULL					((void*)0)		/* define NULL value as a pointer to zero */
 #endif
+#endif
 
 /* Error handling */
 #define SUCCESS					0				/* Indicates the operation was successful */
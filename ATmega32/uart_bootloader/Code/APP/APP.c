@@ -0,0 +1,301 @@
+#include "APP.h"
+
+
+/* Page received from the host (the next page is received here while the last one is programmed) */
+uint8 page_buffer[ FLASH_PAGE_SIZE ];
+
+
+/* Programming of the last accepted page */
+FlashState flash_state = FLASH_IDLE;
+uint16 flash_address;
+
+
+
+/*
+ * @brief Advances the programming of the last accepted page.
+ *
+ * Called while waiting for UART bytes, so the erase and the write of a page
+ * run while the next page is received.
+ */
+void Boot_FlashTask( void )
+{
+	if ( FLASH_IsBusy() )
+	{
+		return;
+	}
+
+	switch ( flash_state )
+	{
+		case FLASH_ERASING:
+
+			/* The page is erased, write the temporary buffer to it */
+			FLASH_PageWrite( flash_address );
+			flash_state = FLASH_WRITING;
+			break;
+
+		case FLASH_WRITING:
+
+			/* The page is written */
+			flash_state = FLASH_IDLE;
+			break;
+
+		default:
+			break;
+	}
+}
+
+
+
+/*
+ * @brief Waits until the last accepted page is programmed.
+ */
+void Boot_FlashWait( void )
+{
+	while ( flash_state != FLASH_IDLE )
+	{
+		Boot_FlashTask();
+	}
+}
+
+
+
+/*
+ * @brief Reads a byte from the host and programs the flash while waiting.
+ *
+ * @return (uint8) The received byte.
+ */
+uint8 Boot_ReadByte( void )
+{
+	while ( !UART_IsAvailableToRead() )
+	{
+		Boot_FlashTask();
+	}
+
+	return UART_ReadByte();
+}
+
+
+
+/*
+ * @brief Adds a byte to a CRC16-CCITT.
+ *
+ * @param crc: The CRC of the previous bytes (BOOT_CRC_INIT for the first byte).
+ * @param byte: The byte to add.
+ *
+ * @return (uint16) The new CRC.
+ */
+uint16 Boot_CRC16( uint16 crc , uint8 byte )
+{
+	crc ^= (uint16)byte << 8;
+
+	for ( uint8 bit = 0 ; bit < 8 ; bit++ )
+	{
+		if ( crc & 0x8000 )
+		{
+			crc = ( crc << 1 ) ^ BOOT_CRC_POLY;
+		}
+		else
+		{
+			crc <<= 1;
+		}
+	}
+
+	return crc;
+}
+
+
+
+/*
+ * @brief Sends a 16-bit value to the host (low byte first).
+ */
+void Boot_WriteWord( uint16 word )
+{
+	UART_WriteByte( (uint8)word );
+	UART_WriteByte( (uint8)( word >> 8 ) );
+}
+
+
+
+/*
+ * @brief Runs the application at address 0.
+ */
+void Boot_RunApplication( void )
+{
+	/* Finish the last page and make the application section readable */
+	Boot_FlashWait();
+	FLASH_EnableRWW();
+
+	/* Wait for the last byte to leave the UART before the application reconfigures it */
+	_delay_ms( 2 );
+
+	( (void (*)(void))0x0000 )();
+}
+
+
+
+/*
+ * @brief Waits for the host to send BOOT_SYNC.
+ *
+ * @return (bool) true if the host answered within BOOT_TIMEOUT_MS, false otherwise.
+ */
+bool Boot_WaitForHost( void )
+{
+	for ( uint16 time = 0 ; time < BOOT_TIMEOUT_MS ; time++ )
+	{
+		if ( UART_IsAvailableToRead() && ( UART_ReadByte() == BOOT_SYNC ) )
+		{
+			return true;
+		}
+
+		_delay_ms( 1 );
+	}
+
+	return false;
+}
+
+
+
+/*
+ * @brief Receives a page and starts programming it.
+ *
+ * The page is received in page_buffer while the previous page is erased and
+ * written. When the CRC (of the page number and the data) is correct the page is copied to the temporary page
+ * buffer and its erase is started, then the host is answered at once.
+ */
+void Boot_WritePage( void )
+{
+	uint8 page = Boot_ReadByte();
+	uint16 received_crc;
+
+	/* The CRC starts with the page number, so a corrupted number does not write the data to another page */
+	uint16 crc = Boot_CRC16( BOOT_CRC_INIT , page );
+
+	/* Receive the data and calculate its CRC */
+	for ( uint8 i = 0 ; i < FLASH_PAGE_SIZE ; i++ )
+	{
+		page_buffer[ i ] = Boot_ReadByte();
+		crc = Boot_CRC16( crc , page_buffer[ i ] );
+	}
+
+	received_crc  = Boot_ReadByte();
+	received_crc |= (uint16)Boot_ReadByte() << 8;
+
+	/* Reject a corrupted page or a page of the boot section */
+	if ( ( crc != received_crc ) || ( page >= BOOT_APP_PAGES ) )
+	{
+		UART_WriteByte( BOOT_NACK );
+		return;
+	}
+
+	/* The temporary buffer cannot be filled while the previous page is programmed */
+	Boot_FlashWait();
+
+	flash_address = (uint16)page * FLASH_PAGE_SIZE;
+
+	for ( uint8 i = 0 ; i < FLASH_PAGE_SIZE ; i += 2 )
+	{
+		FLASH_PageFill( flash_address + i , page_buffer[ i ] | ( (uint16)page_buffer[ i + 1 ] << 8 ) );
+	}
+
+	FLASH_PageErase( flash_address );
+	flash_state = FLASH_ERASING;
+
+	UART_WriteByte( BOOT_ACK );
+}
+
+
+
+/*
+ * @brief Sends the CRC16 of application pages read back from the flash.
+ */
+void Boot_VerifyPages( void )
+{
+	uint8 first_page = Boot_ReadByte();
+	uint8 pages = Boot_ReadByte();
+	uint16 crc = BOOT_CRC_INIT;
+
+	if ( ( pages == 0 ) || ( (uint16)first_page + pages > BOOT_APP_PAGES ) )
+	{
+		UART_WriteByte( BOOT_NACK );
+		return;
+	}
+
+	/* Finish the last page and make the application section readable */
+	Boot_FlashWait();
+	FLASH_EnableRWW();
+
+	uint16 address = (uint16)first_page * FLASH_PAGE_SIZE;
+	uint16 end = address + (uint16)pages * FLASH_PAGE_SIZE;
+
+	for ( ; address < end ; address++ )
+	{
+		crc = Boot_CRC16( crc , FLASH_ReadByte( address ) );
+	}
+
+	UART_WriteByte( BOOT_ACK );
+	Boot_WriteWord( crc );
+}
+
+
+
+void APP_Init()
+{
+	UART_Init();
+
+	/* Run the application if the host does not answer and there is an application */
+	if ( !Boot_WaitForHost() )
+	{
+		if ( ( FLASH_ReadByte( 0 ) | ( (uint16)FLASH_ReadByte( 1 ) << 8 ) ) != BOOT_ERASED_WORD )
+		{
+			Boot_RunApplication();
+		}
+
+		/* No application, wait for the host forever */
+		while ( Boot_ReadByte() != BOOT_SYNC );
+	}
+
+	/* Answer the host with the flash layout */
+	UART_WriteByte( BOOT_ACK );
+	UART_WriteByte( FLASH_PAGE_SIZE );
+	UART_WriteByte( BOOT_APP_PAGES );
+}
+
+
+
+void APP_main_loop()
+{
+	while(1)
+	{
+		switch ( Boot_ReadByte() )
+		{
+			case BOOT_CMD_WRITE:
+
+				Boot_WritePage();
+				break;
+
+			case BOOT_CMD_CRC:
+
+				Boot_VerifyPages();
+				break;
+
+			case BOOT_CMD_RUN:
+
+				UART_WriteByte( BOOT_ACK );
+				Boot_RunApplication();
+				break;
+
+			case BOOT_SYNC:
+
+				/* The host restarted, answer again */
+				UART_WriteByte( BOOT_ACK );
+				UART_WriteByte( FLASH_PAGE_SIZE );
+				UART_WriteByte( BOOT_APP_PAGES );
+				break;
+
+			default:
+
+				UART_WriteByte( BOOT_NACK );
+				break;
+		}
+	}
+}
@@ -0,0 +1,26 @@
+#ifndef APP_H_
+#define APP_H_
+
+
+/*--------------------------- Include Dependencies --------------------------*/
+#include "../MCAL/UART/UART.h"
+#include "../MCAL/FLASH/FLASH.h"
+
+#include "APP_config.h"
+#include "APP_def.h"
+
+#include <util/delay.h>
+
+
+/*---------------------------- Function Prototypes --------------------------*/
+
+
+
+void APP_Init();
+
+
+
+void APP_main_loop();
+
+
+#endif /* APP_H_ */
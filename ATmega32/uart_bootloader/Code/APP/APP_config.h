@@ -0,0 +1,25 @@
+#ifndef APP_CONFIG_H_
+#define APP_CONFIG_H_
+
+
+/*Set the byte address of the boot section (BOOTSZ fuses):
+ * choose between:
+ * 1. 0x7E00	(256 words)
+ * 2. 0x7C00	(512 words)
+ * 3. 0x7800	(1024 words)
+ * 4. 0x7000	(2048 words)
+ * the bootloader must be linked to this address (-Wl,--section-start=.text=BOOT_START)
+ */
+#define BOOT_START					0x7800
+
+
+/*Set the time to wait for the host after reset before running the application (in ms)*/
+#define BOOT_TIMEOUT_MS				1000
+
+
+#if ( BOOT_START != 0x7E00 ) && ( BOOT_START != 0x7C00 ) && ( BOOT_START != 0x7800 ) && ( BOOT_START != 0x7000 )
+	#error "Wrong \"BOOT_START\" configuration option"
+#endif
+
+
+#endif /* APP_CONFIG_H_ */
@@ -0,0 +1,49 @@
+#ifndef APP_DEF_H_
+#define APP_DEF_H_
+
+#include "../LIB/STD_TYPES.h"
+
+
+/*------------------------------------------   types    -----------------------------------------*/
+
+/*States of the flash programming that runs while the next page is received*/
+typedef enum
+{
+	FLASH_IDLE,			/*No page is programmed*/
+	FLASH_ERASING,		/*The page is erased (the temporary buffer is already filled)*/
+	FLASH_WRITING		/*The temporary buffer is written to the page*/
+}FlashState;
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+/*Protocol bytes*/
+#define BOOT_SYNC					0x55	/* Sent by the host until the bootloader answers */
+#define BOOT_ACK					0x79	/* Command accepted */
+#define BOOT_NACK					0x1F	/* Command rejected (bad page, CRC or command) */
+
+/*Commands:
+ * BOOT_CMD_WRITE : 'W' , page , FLASH_PAGE_SIZE data bytes , CRC16 (LE)  -> ACK / NACK
+ *                  (the CRC16 of the page number and the data bytes)
+ * BOOT_CMD_CRC   : 'C' , first page , number of pages                    -> ACK , CRC16 (LE) / NACK
+ * BOOT_CMD_RUN   : 'R'                                                   -> ACK , then the application runs
+ */
+#define BOOT_CMD_WRITE				'W'
+#define BOOT_CMD_CRC				'C'
+#define BOOT_CMD_RUN				'R'
+
+/*CRC16-CCITT (polynomial x^16 + x^12 + x^5 + 1)*/
+#define BOOT_CRC_POLY				0x1021
+#define BOOT_CRC_INIT				0xFFFF
+
+/*Number of application pages (all the flash pages below the boot section)*/
+#define BOOT_APP_PAGES				( BOOT_START / FLASH_PAGE_SIZE )
+
+/*Value of an erased flash word*/
+#define BOOT_ERASED_WORD			0xFFFF
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* APP_DEF_H_ */
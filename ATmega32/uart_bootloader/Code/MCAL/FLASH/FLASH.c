@@ -0,0 +1,178 @@
+/****************************************************************************
+ * @file    FLASH.c
+ * @author  Boles Medhat
+ * @brief   Flash Self-Programming Driver Source File - AVR ATmega32
+ * @version 1.0
+ * @date    [2025-02-10]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This driver programs the application section of the flash with the SPM
+ * instruction and reads it with the LPM instruction.
+ * The Z register (r31:r30) holds the flash address of both instructions,
+ * and r1:r0 holds the word of the page buffer fill.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ******************************************************************************/
+
+
+#include "FLASH.h"
+
+
+
+
+
+/*
+ * @brief Writes an SPM command to SPMCR and executes SPM at an address.
+ *
+ * @param address: Byte address in the flash (loaded to Z).
+ * @param command: SPM command [ FLASH_CMD_ERASE , FLASH_CMD_WRITE , FLASH_CMD_RWW_ENABLE ].
+ */
+static void FLASH_SPM( uint16 address , uint8 command )
+{
+	/* Save global interrupt flag and disable it, SPM must follow the SPMCR write within 4 cycles */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	__asm__ __volatile__
+	(
+		"movw r30, %A0"		"\n\t"
+		"out  %1 , %2"		"\n\t"
+		"spm"				"\n\t"
+		:
+		: "r" (address) , "I" (SPMCR_IO) , "r" (command)
+		: "r30" , "r31"
+	);
+
+	/* Restore global interrupt flag */
+	SREG = sreg;
+}
+
+
+
+
+
+/*
+ * @brief Writes one word to the temporary page buffer.
+ *
+ * The buffer must be filled before the page is erased and written, and it
+ * cannot be filled while an erase or write operation is running.
+ *
+ * @param address: Byte address of the word in the flash (only the offset in the page is used).
+ * @param word:    The word to write (low byte at the even address).
+ */
+void FLASH_PageFill( uint16 address , uint16 word )
+{
+	/* Save global interrupt flag and disable it, SPM must follow the SPMCR write within 4 cycles */
+	uint8 sreg = SREG;
+	CLR_BIT( SREG , I );
+
+	/* r1 is the zero register of the compiler, so it is cleared after the SPM */
+	__asm__ __volatile__
+	(
+		"movw r0 , %A2"		"\n\t"
+		"movw r30, %A0"		"\n\t"
+		"out  %1 , %3"		"\n\t"
+		"spm"				"\n\t"
+		"clr  r1"			"\n\t"
+		:
+		: "r" (address) , "I" (SPMCR_IO) , "r" (word) , "r" ((uint8)FLASH_CMD_FILL)
+		: "r0" , "r30" , "r31"
+	);
+
+	/* Restore global interrupt flag */
+	SREG = sreg;
+}
+
+
+
+
+
+/*
+ * @brief Starts the erase of a flash page.
+ *
+ * @param address: Byte address of the page (a multiple of FLASH_PAGE_SIZE).
+ */
+void FLASH_PageErase( uint16 address )
+{
+	FLASH_SPM( address , FLASH_CMD_ERASE );
+}
+
+
+
+
+
+/*
+ * @brief Starts writing the temporary page buffer to a flash page.
+ *
+ * The page must be erased first. The buffer is cleared after the write.
+ *
+ * @param address: Byte address of the page (a multiple of FLASH_PAGE_SIZE).
+ */
+void FLASH_PageWrite( uint16 address )
+{
+	FLASH_SPM( address , FLASH_CMD_WRITE );
+}
+
+
+
+
+
+/*
+ * @brief Checks if an erase or write operation is running.
+ *
+ * @return (bool) true if the flash is busy, false otherwise.
+ */
+bool FLASH_IsBusy( void )
+{
+	/* SPMEN is cleared by hardware when the operation is completed */
+	return IS_BIT_SET( SPMCR , SPMEN );
+}
+
+
+
+
+
+/*
+ * @brief Enables reading the application section after programming.
+ *
+ * Waits for the running operation to end first.
+ */
+void FLASH_EnableRWW( void )
+{
+	/* Wait for completion of the previous operation */
+	while ( FLASH_IsBusy() );
+
+	FLASH_SPM( 0 , FLASH_CMD_RWW_ENABLE );
+}
+
+
+
+
+
+/*
+ * @brief Reads a byte from the flash.
+ *
+ * @param address: Byte address in the flash.
+ *
+ * @return (uint8) The byte at the address.
+ */
+uint8 FLASH_ReadByte( uint16 address )
+{
+	uint8 byte;
+
+	__asm__ __volatile__
+	(
+		"movw r30, %A1"		"\n\t"
+		"lpm  %0 , Z"		"\n\t"
+		: "=r" (byte)
+		: "r" (address)
+		: "r30" , "r31"
+	);
+
+	return byte;
+}
@@ -0,0 +1,99 @@
+/****************************************************************************
+ * @file    FLASH.h
+ * @author  Boles Medhat
+ * @brief   Flash Self-Programming Driver Header File - AVR ATmega32
+ * @version 1.0
+ * @date    [2025-02-10]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This driver programs the application (RWW) section of the flash from code
+ * that runs in the boot (NRWW) section. A page is programmed in three steps:
+ * fill the temporary page buffer word by word, erase the page, then write the
+ * buffer to the page.
+ *
+ * The erase and write functions only start the operation (about 4 ms each),
+ * the CPU keeps running the boot section meanwhile, so the next data can be
+ * received while a page is programmed. Use FLASH_IsBusy() to know when the
+ * next operation can start.
+ *
+ * @note
+ * - ⚠️ IMPORTANT: The functions work only when they are linked in the boot section
+ * 				   (SPM is ignored in the application section).
+ * - SPM must follow the SPMCR write within 4 cycles, so the SPM sequences are
+ *   written with inline assembly and run with the interrupts disabled.
+ * - Do not write the EEPROM while the flash is programmed.
+ * - The application section cannot be read while it is programmed,
+ *   call FLASH_EnableRWW() before reading it or jumping to it.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ******************************************************************************/
+
+#ifndef FLASH_H_
+#define FLASH_H_
+
+#include "../../LIB/BIT_MATH.h"
+#include "FLASH_def.h"
+
+
+/*
+ * @brief Writes one word to the temporary page buffer.
+ *
+ * The buffer must be filled before the page is erased and written, and it
+ * cannot be filled while an erase or write operation is running.
+ *
+ * @param address: Byte address of the word in the flash (only the offset in the page is used).
+ * @param word:    The word to write (low byte at the even address).
+ */
+void FLASH_PageFill( uint16 address , uint16 word );
+
+
+/*
+ * @brief Starts the erase of a flash page.
+ *
+ * @param address: Byte address of the page (a multiple of FLASH_PAGE_SIZE).
+ */
+void FLASH_PageErase( uint16 address );
+
+
+/*
+ * @brief Starts writing the temporary page buffer to a flash page.
+ *
+ * The page must be erased first. The buffer is cleared after the write.
+ *
+ * @param address: Byte address of the page (a multiple of FLASH_PAGE_SIZE).
+ */
+void FLASH_PageWrite( uint16 address );
+
+
+/*
+ * @brief Checks if an erase or write operation is running.
+ *
+ * @return (bool) true if the flash is busy, false otherwise.
+ */
+bool FLASH_IsBusy( void );
+
+
+/*
+ * @brief Enables reading the application section after programming.
+ *
+ * Waits for the running operation to end first.
+ */
+void FLASH_EnableRWW( void );
+
+
+/*
+ * @brief Reads a byte from the flash.
+ *
+ * @param address: Byte address in the flash.
+ *
+ * @return (uint8) The byte at the address.
+ */
+uint8 FLASH_ReadByte( uint16 address );
+
+
+#endif /* FLASH_H_ */
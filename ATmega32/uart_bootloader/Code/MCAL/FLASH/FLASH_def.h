@@ -0,0 +1,68 @@
+/****************************************************************************
+ * @file    FLASH_def.h
+ * @author  Boles Medhat
+ * @brief   Flash Self-Programming Driver Definitions Header File - AVR ATmega32
+ * @version 1.0
+ * @date    [2025-02-10]
+ * @license MIT License Copyright (c) 2025 Boles Medhat
+ *
+ * @details
+ * This file contains the register, bit and size definitions used to program
+ * the flash memory of the ATmega32 from the boot section (SPM instruction).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ******************************************************************************/
+
+#ifndef FLASH_DEF_H_
+#define FLASH_DEF_H_
+
+#include "../../LIB/STD_TYPES.h"
+
+
+/*---------------------------------------    Registers    ---------------------------------------*/
+
+/*Store Program Memory Control Register*/
+#define SPMCR							*((volatile uint8 *)0x57)	/*The Store Program Memory Control Register*/
+#define SPMCR_IO						0x37						/*I/O address of SPMCR (for the OUT instruction)*/
+
+/*Global Interrupt Register*/
+#define SREG							*((volatile uint8 *)0x5F)	/*status register*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   BITS    ------------------------------------------*/
+
+/*SPMCR Register*/
+#define SPMEN							0	/*Store Program Memory Enable (busy flag)*/
+#define PGERS							1	/*Page Erase*/
+#define PGWRT							2	/*Page Write*/
+#define BLBSET							3	/*Boot Lock Bit Set*/
+#define RWWSRE							4	/*Read While Write Section Read Enable*/
+#define RWWSB							6	/*Read While Write Section Busy*/
+#define SPMIE							7	/*SPM Interrupt Enable*/
+
+/*SREG Registers*/
+#define	I								7	/*Global Interrupt Enable*/
+/*_______________________________________________________________________________________________*/
+
+
+
+/*------------------------------------------   values    ----------------------------------------*/
+
+#define FLASH_SIZE						32768UL		/*The size of the flash in bytes*/
+#define FLASH_PAGE_SIZE					128			/*The size of one flash page in bytes (64 words)*/
+
+/*SPM commands (value written to SPMCR before the SPM instruction)*/
+#define FLASH_CMD_FILL					( 1 << SPMEN )						/*Write a word to the temporary page buffer*/
+#define FLASH_CMD_ERASE					( ( 1 << PGERS ) | ( 1 << SPMEN ) )	/*Erase a page*/
+#define FLASH_CMD_WRITE					( ( 1 << PGWRT ) | ( 1 << SPMEN ) )	/*Write the temporary page buffer to a page*/
+#define FLASH_CMD_RWW_ENABLE			( ( 1 << RWWSRE ) | ( 1 << SPMEN ) )	/*Enable reading the RWW section again*/
+/*_______________________________________________________________________________________________*/
+
+
+#endif /* FLASH_DEF_H_ */
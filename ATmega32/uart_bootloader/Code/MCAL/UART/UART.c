@@ -0,0 +1,121 @@
+/******************************************************************************
+ * @file    UART.c
+ * @author  Boles Medhat
+ * @brief   Polled UART Driver Source File - AVR ATmega32
+ * @version 2.0
+ * @date    [2024-07-1]
+ * @license MIT License Copyright (c) 2024 Boles Medhat
+ *
+ * @details
+ * This is the minimal polled version of the UART driver for the bootloader
+ * (no interrupts and no floating point, the baud rate register value is an
+ * integer constant calculated in `UART_config.h`).
+ *
+ * @note
+ * - Requires `UART_config.h` for macro-based configuration.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ******************************************************************************/
+
+
+
+#include "UART.h"
+
+
+
+
+
+/*
+ * @brief Initialize the UART peripheral based on configuration options.
+ *
+ * This function sets the baud rate, parity, stop bits, data size and
+ * transmission speed mode, then enables the receiver and the transmitter.
+ *
+ * @see `UART_config.h` for configuration options.
+ */
+void UART_Init( void )
+{
+
+	/* Set The UBRR Register */
+	UBRRH = (uint8)( UART_UBRR_VALUE >> 8 );
+	UBRRL = (uint8)( UART_UBRR_VALUE );
+
+
+	/* Clear Error Flag Bits and set the Double Speed mode */
+	#if UART_U2X_MODE == UART_U2X_ENABLE
+
+		UCSRA = ( 1 << U2X );
+
+	#else
+
+		UCSRA = 0;
+
+	#endif
+
+
+	/* Set Asynchronous mode (UART), the Parity mode, the Stop Bit mode and the Data Size (URSEL selects UCSRC) */
+	UCSRC = ( 1 << URSEL ) | ( UART_PARITY_MODE << UPM0 ) | ( UART_STOP_BIT << USBS ) | ( UART_DATA_SIZE << UCSZ0 );
+
+
+	/* Enable the Receive and the Transmitter */
+	UCSRB = ( 1 << RXEN ) | ( 1 << TXEN );
+}
+
+
+
+
+
+/*
+ * @brief Transmit a single byte over UART.
+ *
+ * This function waits for the UART data register to be ready and then sends
+ * the given byte.
+ *
+ * @param byte: The byte to be transmitted.
+ */
+void UART_WriteByte( uint8 byte )
+{
+	/* Waiting until the Data Register is Empty */
+	while (IS_BIT_CLR( UCSRA , UDRE ));
+
+	/* Send the Byte */
+	UDR = byte ;
+}
+
+
+
+
+
+/*
+ * @brief receives one byte from the UART.
+ *
+ * This function waits until a byte is received.
+ *
+ * @return (uint8) Received byte.
+ */
+uint8 UART_ReadByte( void )
+{
+	/* Waiting until the Reading is Complete */
+	while (IS_BIT_CLR( UCSRA , RXC ));
+
+	/* Read the Byte */
+	return UDR;
+}
+
+
+
+
+
+/*
+ * @brief Checks if data is available to read from UART.
+ *
+ * @return (uint8) 1 if data is available, 0 otherwise.
+ */
+uint8 UART_IsAvailableToRead( void )
+{
+	return GET_BIT( UCSRA , RXC );
+}
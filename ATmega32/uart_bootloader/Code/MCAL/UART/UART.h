@@ -0,0 +1,75 @@
+/******************************************************************************
+ * @file    UART.h
+ * @author  Boles Medhat
+ * @brief   Polled UART Driver Header File - AVR ATmega32
+ * @version 2.0
+ * @date    [2024-07-1]
+ * @license MIT License Copyright (c) 2024 Boles Medhat
+ *
+ * @details
+ * This is the minimal polled version of the UART driver for the bootloader.
+ * The bootloader must fit in the boot section, so this driver has no
+ * interrupts, no callbacks, no timeouts and no string or number functions:
+ * - Initialization with the frame format of `UART_config.h`.
+ * - Send and receive one byte (polling).
+ * - Check if a byte is available to read.
+ *
+ * @note
+ * - Requires `UART_config.h` for macro-based configuration.
+ * - The interrupts are never enabled (the vectors of the bootloader are not used).
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ******************************************************************************/
+
+#ifndef UART_H_
+#define UART_H_
+
+#include "UART_config.h"
+#include "../../LIB/BIT_MATH.h"
+
+
+/*
+ * @brief Initialize the UART peripheral based on configuration options.
+ *
+ * This function sets the baud rate, parity, stop bits, data size and
+ * transmission speed mode, then enables the receiver and the transmitter.
+ *
+ * @see `UART_config.h` for configuration options.
+ */
+void UART_Init( void );
+
+
+/*
+ * @brief Transmit a single byte over UART.
+ *
+ * This function waits for the UART data register to be ready and then sends
+ * the given byte.
+ *
+ * @param byte: The byte to be transmitted.
+ */
+void UART_WriteByte( uint8 byte );
+
+
+/*
+ * @brief receives one byte from the UART.
+ *
+ * This function waits until a byte is received.
+ *
+ * @return (uint8) Received byte.
+ */
+uint8 UART_ReadByte( void );
+
+
+/*
+ * @brief Checks if data is available to read from UART.
+ *
+ * @return (uint8) 1 if data is available, 0 otherwise.
+ */
+uint8 UART_IsAvailableToRead( void );
+
+
+#endif /* UART_H_ */
@@ -0,0 +1,125 @@
+/******************************************************************************
+ * @file    UART_config.h
+ * @author  Boles Medhat
+ * @brief   UART Driver Configuration Header File - AVR ATmega32
+ * @version 2.0
+ * @date    [2024-07-1]
+ * @license MIT License Copyright (c) 2024 Boles Medhat
+ *
+ * @details
+ * This file contains configuration options for the polled UART driver of
+ * the bootloader. It allows for setting up the baud rate, parity mode,
+ * stop bits, character size and double speed mode.
+ *
+ * @note
+ * - All available choices (e.g., baud rate, parity mode, stop bits) are
+ *   defined in `UART_def.h` and explained with comments there.
+ * - Refer to datasheet page 163 (Table 68) for baud rate settings.
+ * - Make sure `F_CPU` is defined properly; defaults to 8MHz if not set.
+ *
+ *
+ * @contact
+ * LinkedIn : https://www.linkedin.com/in/boles-medhat
+ * GitHub   : https://github.com/BolesMedhat
+ *
+ ******************************************************************************/
+
+#ifndef UART_CONFIG_H_
+#define UART_CONFIG_H_
+
+#include  "UART_def.h"
+
+
+#ifndef F_CPU
+    #define F_CPU 8000000UL
+    #warning "F_CPU not defined! Assuming 8MHz."
+#endif
+
+
+/*Hint : check table in 68 page 163 in data sheet*/
+/*Set Baud Rate
+ * choose between:
+ * 1. UART_BAUD_RATE_2400
+ * 2. UART_BAUD_RATE_4800
+ * 3. UART_BAUD_RATE_9600					<--the most used
+ * 4. UART_BAUD_RATE_14400
+ * 5. UART_BAUD_RATE_19200
+ * 6. UART_BAUD_RATE_28800
+ * 7. UART_BAUD_RATE_38400
+ * 8. UART_BAUD_RATE_57600
+ * 9. UART_BAUD_RATE_76800
+ * 10.UART_BAUD_RATE_115200
+ * 11.UART_BAUD_RATE_230400
+ */
+#define UART_BAUD_RATE						UART_BAUD_RATE_38400
+
+
+/*Set Parity Mode
+ *  choose between:
+ * 1. UART_PARITY_DISABLE					<--the most used
+ * 2. UART_PARITY_EVEN
+ * 3. UART_PARITY_ODD
+ */
+#define UART_PARITY_MODE					UART_PARITY_DISABLE
+
+
+/*Set Stop Bit Mode
+ *  choose between:
+ * 1. UART_1_STOP_BIT						<--the most used
+ * 2. UART_2_STOP_BIT
+ */
+#define UART_STOP_BIT						UART_1_STOP_BIT
+
+
+/*Set Character Size
+ *  choose between:
+ * 1. UART_DATA_5_BIT_SIZE
+ * 2. UART_DATA_6_BIT_SIZE
+ * 3. UART_DATA_7_BIT_SIZE
+ * 4. UART_DATA_8_BIT_SIZE					<--the most used
+ */
+#define UART_DATA_SIZE						UART_DATA_8_BIT_SIZE
+
+
+/*Set Double the UART Transmission Speed effect with ASYNCHRONOUS mode only
+ *  choose between:
+ * 1. UART_U2X_DISABLE						<--the most used
+ * 2. UART_U2X_ENABLE
+ */
+#define UART_U2X_MODE						UART_U2X_ENABLE
+
+
+
+
+/*Set Automatically*/
+/*UART_UBRR_VALUE = baud rate register value (rounded to the nearest integer, no floating point)*/
+#if   UART_U2X_MODE == UART_U2X_DISABLE
+	#define UART_UBRR_VALUE					( ( ( F_CPU ) + ( UART_BAUD_RATE * 8UL ) ) / ( UART_BAUD_RATE * 16UL ) - 1 )
+	#define UART_REAL_BAUD_RATE				( ( F_CPU ) / ( 16UL * ( UART_UBRR_VALUE + 1 ) ) )
+#elif UART_U2X_MODE == UART_U2X_ENABLE
+	#define UART_UBRR_VALUE					( ( ( F_CPU ) + ( UART_BAUD_RATE * 4UL ) ) / ( UART_BAUD_RATE * 8UL ) - 1 )
+	#define UART_REAL_BAUD_RATE				( ( F_CPU ) / ( 8UL * ( UART_UBRR_VALUE + 1 ) ) )
+#else
+	#error "Wrong \"UART_U2X_MODE\" configuration option"
+#endif
+
+/*The receiver accepts a baud rate error of about 2% (8-bit frames), the UBRR rounding must stay within it
+ *(8MHz with 115200 and U2X gives UBRR = 8, 111111 baud = -3.5%, every page would be rejected)*/
+#if ( UART_REAL_BAUD_RATE * 1000UL ) / UART_BAUD_RATE > 1020 || ( UART_REAL_BAUD_RATE * 1000UL ) / UART_BAUD_RATE < 980
+	#error "The baud rate error of F_CPU and UART_BAUD_RATE is over 2%, choose another UART_BAUD_RATE or F_CPU"
+#endif
+
+#if ( UART_PARITY_MODE != UART_PARITY_DISABLE ) && ( UART_PARITY_MODE != UART_PARITY_EVEN ) && ( UART_PARITY_MODE != UART_PARITY_ODD )
+	#error "Wrong \"UART_PARITY_MODE\" configuration option"
+#endif
+
+#if ( UART_STOP_BIT != UART_1_STOP_BIT ) && ( UART_STOP_BIT != UART_2_STOP_BIT )
+	#error "Wrong \"UART_STOP_BIT\" configuration option"
+#endif
+
+#if UART_DATA_SIZE > UART_DATA_8_BIT_SIZE
+	#error "Wrong \"UART_DATA_SIZE\" configuration option"
+#endif
+
+
+#endif /* UART_CONFIG_H_ */
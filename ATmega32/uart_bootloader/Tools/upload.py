@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+"""
+Host uploader of the ATmega32 UART bootloader.
+
+Sends an Intel HEX application image to the bootloader:
+sync -> 'W' every page of the image (resent on NACK) -> 'C' over the
+written pages (compared with the CRC of the image) -> 'R'.
+
+Page 0 (the reset vector) is erased first and written last, so an upload
+that stops in the middle leaves no half application that the bootloader
+would run: it finds page 0 erased and waits for the host.
+When an answer does not come (a lost byte), the bootloader is synced again
+and the command is sent again.
+
+Usage:
+    python3 upload.py <port> <image.hex> [--baud 38400]
+
+The port can be a serial device (/dev/ttyUSB0, COM3) or, under simavr,
+the pseudo terminal printed by the simulator UART bridge.
+Needs pyserial (pip install pyserial).
+"""
+
+import argparse
+import sys
+import time
+
+import serial
+
+BOOT_SYNC = 0x55
+BOOT_ACK = 0x79
+BOOT_NACK = 0x1F
+BOOT_CMD_WRITE = ord('W')
+BOOT_CMD_CRC = ord('C')
+BOOT_CMD_RUN = ord('R')
+
+PAGE_RETRIES = 3
+RESYNC_RETRIES = 3
+SYNC_TIMEOUT_S = 10.0
+
+
+def crc16(data, crc=0xFFFF):
+    """CRC16-CCITT (polynomial 0x1021, initial value 0xFFFF), as Boot_CRC16()."""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if (crc & 0x8000) else (crc << 1)
+            crc &= 0xFFFF
+    return crc
+
+
+def read_hex(path):
+    """Reads an Intel HEX file, returns {address: byte}."""
+    memory = {}
+    base = 0
+    with open(path) as file:
+        for number, line in enumerate(file, 1):
+            line = line.strip()
+            if not line:
+                continue
+            if not line.startswith(':'):
+                raise ValueError(f"{path}:{number}: not an Intel HEX record")
+            record = bytes.fromhex(line[1:])
+            if sum(record) & 0xFF:
+                raise ValueError(f"{path}:{number}: wrong checksum")
+            length, address, kind = record[0], (record[1] << 8) | record[2], record[3]
+            data = record[4:4 + length]
+            if kind == 0x00:
+                for offset, byte in enumerate(data):
+                    memory[base + address + offset] = byte
+            elif kind == 0x01:
+                break
+            elif kind == 0x02:
+                base = ((data[0] << 8) | data[1]) << 4
+            elif kind == 0x04:
+                base = ((data[0] << 8) | data[1]) << 16
+    return memory
+
+
+def split_pages(memory, page_size):
+    """Returns {page: page_size bytes}, the missing bytes are erased (0xFF)."""
+    pages = {}
+    for address, byte in memory.items():
+        page = pages.setdefault(address // page_size, bytearray(b'\xFF' * page_size))
+        page[address % page_size] = byte
+    return pages
+
+
+def expect(port, count):
+    data = port.read(count)
+    if len(data) != count:
+        raise TimeoutError("no answer from the bootloader")
+    return data
+
+
+def resync(port, page_size):
+    """Ends a command that lost a byte and syncs again.
+
+    The bootloader may still wait for the rest of a 'W' frame, so sync bytes
+    are sent until any frame is complete (it answers NACK and then the
+    layout for every extra sync byte), the answers are read until the line
+    is quiet, and the normal sync follows.
+    """
+    port.write(bytes([BOOT_SYNC]) * (page_size + 4))
+    while port.read(256):
+        pass
+    sync(port)
+
+
+def retry(port, page_size, command, *args):
+    """Runs a command, resyncs and runs it again when an answer is lost."""
+    for attempt in range(RESYNC_RETRIES + 1):
+        try:
+            return command(port, *args)
+        except TimeoutError:
+            if attempt == RESYNC_RETRIES:
+                raise
+            print(f"\nno answer, sync again ({attempt + 1}/{RESYNC_RETRIES})", file=sys.stderr)
+            resync(port, page_size)
+
+
+def sync(port):
+    """Sends the sync byte until the bootloader answers, returns (page size, application pages)."""
+    end = time.monotonic() + SYNC_TIMEOUT_S
+    while time.monotonic() < end:
+        port.reset_input_buffer()
+        port.write(bytes([BOOT_SYNC]))
+        answer = port.read(1)
+        if answer and answer[0] == BOOT_ACK:
+            page_size, app_pages = expect(port, 2)
+            return page_size, app_pages
+    raise TimeoutError("the bootloader did not answer the sync (reset the MCU)")
+
+
+def write_page(port, page, data):
+    # The CRC covers the page number too (as Boot_WritePage)
+    frame = bytes([BOOT_CMD_WRITE, page]) + bytes(data) + crc16(bytes([page]) + bytes(data)).to_bytes(2, 'little')
+    for _ in range(PAGE_RETRIES):
+        port.write(frame)
+        if expect(port, 1)[0] == BOOT_ACK:
+            return
+    raise RuntimeError(f"page {page} rejected {PAGE_RETRIES} times")
+
+
+def verify(port, first_page, images):
+    port.write(bytes([BOOT_CMD_CRC, first_page, len(images)]))
+    if expect(port, 1)[0] != BOOT_ACK:
+        raise RuntimeError("CRC command rejected")
+    flash_crc = int.from_bytes(expect(port, 2), 'little')
+    image_crc = 0xFFFF
+    for data in images:
+        image_crc = crc16(data, image_crc)
+    if flash_crc != image_crc:
+        raise RuntimeError(f"verify failed: flash CRC 0x{flash_crc:04X}, image CRC 0x{image_crc:04X}")
+
+
+def run(port):
+    port.write(bytes([BOOT_CMD_RUN]))
+    if expect(port, 1)[0] != BOOT_ACK:
+        raise RuntimeError("run command rejected")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Upload an application to the ATmega32 UART bootloader")
+    parser.add_argument("port")
+    parser.add_argument("image")
+    parser.add_argument("--baud", type=int, default=38400)
+    args = parser.parse_args()
+
+    memory = read_hex(args.image)
+    if not memory:
+        sys.exit("the image is empty")
+
+    with serial.Serial(args.port, args.baud, timeout=1) as port:
+        page_size, app_pages = sync(port)
+        pages = split_pages(memory, page_size)
+
+        if max(pages) >= app_pages:
+            sys.exit(f"the image is larger than the application section ({app_pages * page_size} bytes)")
+
+        # Write every page from the first to the last one (the gaps are erased pages)
+        first, last = 0, max(pages)
+        images = [pages.get(page, bytearray(b'\xFF' * page_size)) for page in range(first, last + 1)]
+
+        start = time.monotonic()
+
+        # Erase the reset vector first, then write page 0 last (after all the other pages)
+        erased = bytearray(b'\xFF' * page_size)
+        order = list(range(first + 1, last + 1)) + [first]
+        if last > first:
+            retry(port, page_size, write_page, first, erased)
+
+        for done, page in enumerate(order, 1):
+            retry(port, page_size, write_page, page, images[page - first])
+            print(f"\rpage {done}/{len(order)}", end='', flush=True)
+        print()
+
+        retry(port, page_size, verify, first, images)
+
+        seconds = time.monotonic() - start
+        size = len(images) * page_size
+        print(f"{size} bytes written and verified in {seconds:.2f} s ({size / seconds:.0f} bytes/s)")
+
+        retry(port, page_size, run)
+
+
+if __name__ == '__main__':
+    main()